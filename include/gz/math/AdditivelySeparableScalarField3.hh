@@ -17,17 +17,46 @@
 #ifndef GZ_MATH_SEPARABLE_SCALAR_FIELD3_HH_
 #define GZ_MATH_SEPARABLE_SCALAR_FIELD3_HH_
 
+#include <algorithm>
+#include <cstddef>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #include <gz/math/Region3.hh>
 #include <gz/math/Vector3.hh>
 #include <gz/math/config.hh>
+#include <gz/math/detail/ParallelFor.hh>
 
 namespace gz::math
 {
   // Inline bracket to help doxygen filtering.
   inline namespace GZ_MATH_VERSION_NAMESPACE {
+  namespace detail {
+
+    /// \brief Evaluate `_f` at `_count` contiguous arguments through its
+    /// batch Evaluate(const T *, T *, std::size_t) overload.
+    template<typename FunctionT, typename T>
+    auto EvaluateScalarFunction(const FunctionT &_f, const T *_x, T *_y,
+                                std::size_t _count, int)
+      -> decltype(_f.Evaluate(_x, _y, _count), void())
+    {
+      _f.Evaluate(_x, _y, _count);
+    }
+
+    /// \brief Evaluate `_f` at `_count` contiguous arguments, one at
+    /// a time, for callables lacking a batch overload.
+    template<typename FunctionT, typename T>
+    void EvaluateScalarFunction(const FunctionT &_f, const T *_x, T *_y,
+                                std::size_t _count, long)
+    {
+      for (std::size_t i = 0; i < _count; ++i)
+      {
+        _y[i] = _f(_x[i]);
+      }
+    }
+  }  // namespace detail
+
   //
   /** \class AdditivelySeparableScalarField3\
    * AdditivelySeparableScalarField3.hh\
@@ -81,6 +110,97 @@ namespace gz::math
           this->r(_point.Z()));
     }
 
+    /// \brief Evaluate the scalar field at many points. Each of p, q and
+    /// r is evaluated over a block of coordinates at once, using a batch
+    /// Evaluate(const ScalarT *, ScalarT *, std::size_t) overload when
+    /// ScalarFunctionT has one (e.g. Polynomial3). Results are the same as
+    /// those of calling Evaluate() on each point.
+    /// \param[in] _points scalar field arguments
+    /// \param[out] _values the result of evaluating `F` at each point
+    /// \param[in] _threads number of threads to use, 0 for one per core
+    public: void Evaluate(const std::vector<Vector3<ScalarT>> &_points,
+                          std::vector<ScalarT> &_values,
+                          unsigned int _threads = 1) const
+    {
+      // Number of points whose coordinates are gathered at once.
+      constexpr std::size_t kBlock = 256;
+
+      _values.resize(_points.size());
+      const unsigned int threads = detail::ThreadCount(
+        _threads, _points.size());
+      detail::ParallelFor(_points.size(), threads,
+        [&](std::size_t _begin, std::size_t _end, unsigned int)
+        {
+          std::vector<ScalarT> buffer(6 * kBlock);
+          ScalarT *x = buffer.data();
+          ScalarT *y = x + kBlock;
+          ScalarT *z = y + kBlock;
+          ScalarT *px = z + kBlock;
+          ScalarT *qy = px + kBlock;
+          ScalarT *rz = qy + kBlock;
+          for (std::size_t i = _begin; i < _end; i += kBlock)
+          {
+            const std::size_t n = std::min(kBlock, _end - i);
+            for (std::size_t j = 0; j < n; ++j)
+            {
+              x[j] = _points[i + j].X();
+              y[j] = _points[i + j].Y();
+              z[j] = _points[i + j].Z();
+            }
+            detail::EvaluateScalarFunction(this->p, x, px, n, 0);
+            detail::EvaluateScalarFunction(this->q, y, qy, n, 0);
+            detail::EvaluateScalarFunction(this->r, z, rz, n, 0);
+            for (std::size_t j = 0; j < n; ++j)
+            {
+              _values[i + j] = this->k * (px[j] + qy[j] + rz[j]);
+            }
+          }
+        });
+    }
+
+    /// \brief Evaluate the scalar field over the lattice spanned by
+    /// `_xs`, `_ys` and `_zs`. Separability is exploited by evaluating p,
+    /// q and r once per coordinate and then only adding up their values,
+    /// which takes O(nx + ny + nz) function evaluations instead of
+    /// O(nx ny nz). Results are the same as those of calling Evaluate()
+    /// on each lattice point.
+    /// \param[in] _xs x coordinates of the lattice
+    /// \param[in] _ys y coordinates of the lattice
+    /// \param[in] _zs z coordinates of the lattice
+    /// \param[out] _values the result of evaluating `F` at each lattice
+    ///   point, with x varying fastest, i.e. `F(_xs[i], _ys[j], _zs[l])` is
+    ///   stored at index `i + nx * (j + ny * l)`
+    public: void EvaluateLattice(const std::vector<ScalarT> &_xs,
+                                 const std::vector<ScalarT> &_ys,
+                                 const std::vector<ScalarT> &_zs,
+                                 std::vector<ScalarT> &_values) const
+    {
+      const std::size_t nx = _xs.size();
+      const std::size_t ny = _ys.size();
+      const std::size_t nz = _zs.size();
+      std::vector<ScalarT> px(nx), qy(ny), rz(nz);
+      detail::EvaluateScalarFunction(this->p, _xs.data(), px.data(), nx, 0);
+      detail::EvaluateScalarFunction(this->q, _ys.data(), qy.data(), ny, 0);
+      detail::EvaluateScalarFunction(this->r, _zs.data(), rz.data(), nz, 0);
+
+      _values.resize(nx * ny * nz);
+      const ScalarT scale = this->k;
+      ScalarT *out = _values.data();
+      for (std::size_t l = 0; l < nz; ++l)
+      {
+        const ScalarT rl = rz[l];
+        for (std::size_t j = 0; j < ny; ++j)
+        {
+          const ScalarT qj = qy[j];
+          for (std::size_t i = 0; i < nx; ++i)
+          {
+            out[i] = scale * (px[i] + qj + rl);
+          }
+          out += nx;
+        }
+      }
+    }
+
     /// \brief Call operator overload
     /// \see SeparableScalarField3::Evaluate()
     /// \param[in] _point scalar field argument
@@ -0,0 +1,506 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_FIXEDPOLYNOMIAL_HH_
+#define GZ_MATH_FIXEDPOLYNOMIAL_HH_
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+#include <gz/math/Interval.hh>
+#include <gz/math/Polynomial3.hh>
+#include <gz/math/Vector4.hh>
+#include <gz/math/config.hh>
+
+namespace gz::math
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace GZ_MATH_VERSION_NAMESPACE {
+  namespace detail {
+
+    /// \brief Absolute value, usable in constant expressions.
+    /// \param[in] _x argument
+    /// \return |`_x`|
+    template<typename T>
+    constexpr T ConstexprAbs(T _x)
+    {
+      return _x < T(0) ? -_x : _x;
+    }
+
+    /// \brief Square root by Newton's method, usable in constant
+    /// expressions.
+    /// \param[in] _x argument
+    /// \return the square root of `_x`, or NaN if `_x` is negative
+    template<typename T>
+    constexpr T ConstexprSqrt(T _x)
+    {
+      if (_x < T(0))
+        return std::numeric_limits<T>::quiet_NaN();
+      if (!(_x > T(0)) || _x > std::numeric_limits<T>::max())
+        return _x;
+      // Iterates decrease monotonically towards the root from above,
+      // so stop as soon as they do not.
+      T y = _x < T(1) ? T(1) : _x;
+      for (;;)
+      {
+        const T next = (y + _x / y) / T(2);
+        if (!(next < y))
+          return y;
+        y = next;
+      }
+    }
+
+    /// \brief Evaluate a x^3 + b x^2 + c x + d the same way as
+    /// Polynomial3::Evaluate() does for finite `_x`.
+    template<typename T>
+    constexpr T EvaluateCubic(T _a, T _b, T _c, T _d, T _x)
+    {
+      const T x2 = _x * _x;
+      const T x3 = x2 * _x;
+      return _a * x3 + _b * x2 + _c * _x + _d;
+    }
+
+    /// \brief Real roots of a x^2 + b x + c, with a != 0.
+    /// \param[out] _roots roots in ascending order, room for 2 is needed
+    /// \return number of roots
+    template<typename T>
+    constexpr std::size_t QuadraticRoots(T _a, T _b, T _c, T *_roots)
+    {
+      const T discriminant = _b * _b - T(4) * _a * _c;
+      if (discriminant < T(0))
+        return 0;
+      if (!(discriminant > T(0)))
+      {
+        _roots[0] = -_b / (T(2) * _a);
+        return 1;
+      }
+      // Pick the sign that avoids cancellation between b and the
+      // square root, and get the other root from their product c / a.
+      const T s = ConstexprSqrt(discriminant);
+      const T q = _b < T(0) ? (s - _b) / T(2) : -(_b + s) / T(2);
+      T first = q / _a;
+      T second = _c / q;
+      if (second < first)
+      {
+        const T tmp = first;
+        first = second;
+        second = tmp;
+      }
+      _roots[0] = first;
+      _roots[1] = second;
+      return 2;
+    }
+
+    /// \brief Real roots of a x^3 + b x^2 + c x + d, with a != 0.
+    /// The real line is split at the critical points into pieces where
+    /// the polynomial is monotonic, and the root of every piece with a
+    /// sign change is bisected. Multiple roots are found when the
+    /// polynomial evaluates to exactly zero at them.
+    /// \param[out] _roots roots in ascending order, room for 3 is needed
+    /// \return number of roots
+    template<typename T>
+    constexpr std::size_t CubicRoots(T _a, T _b, T _c, T _d, T *_roots)
+    {
+      // Cauchy bound, all roots lie in (-bound, bound).
+      T bound = ConstexprAbs(_b / _a);
+      if (ConstexprAbs(_c / _a) > bound)
+        bound = ConstexprAbs(_c / _a);
+      if (ConstexprAbs(_d / _a) > bound)
+        bound = ConstexprAbs(_d / _a);
+      bound += T(1);
+
+      T points[4]{};
+      std::size_t pointCount = 0;
+      points[pointCount++] = -bound;
+      T critical[2]{};
+      const std::size_t criticalCount =
+        QuadraticRoots(T(3) * _a, T(2) * _b, _c, critical);
+      for (std::size_t i = 0; i < criticalCount; ++i)
+      {
+        if (-bound < critical[i] && critical[i] < bound)
+          points[pointCount++] = critical[i];
+      }
+      points[pointCount++] = bound;
+
+      std::size_t count = 0;
+      T fLeft = EvaluateCubic(_a, _b, _c, _d, points[0]);
+      for (std::size_t i = 1; i < pointCount; ++i)
+      {
+        T left = points[i - 1];
+        T right = points[i];
+        const T fRight = EvaluateCubic(_a, _b, _c, _d, right);
+        if (ConstexprAbs(fLeft) <= T(0))
+        {
+          if (count == 0 || _roots[count - 1] < left)
+            _roots[count++] = left;
+        }
+        else if (ConstexprAbs(fRight) > T(0) &&
+                 (fLeft < T(0)) != (fRight < T(0)))
+        {
+          const bool negativeLeft = fLeft < T(0);
+          for (;;)
+          {
+            const T mid = left + (right - left) / T(2);
+            if (!(left < mid && mid < right))
+              break;
+            const T fMid = EvaluateCubic(_a, _b, _c, _d, mid);
+            if (ConstexprAbs(fMid) <= T(0))
+            {
+              left = right = mid;
+              break;
+            }
+            if ((fMid < T(0)) == negativeLeft)
+              left = mid;
+            else
+              right = mid;
+          }
+          _roots[count++] =
+            ConstexprAbs(EvaluateCubic(_a, _b, _c, _d, left)) <=
+            ConstexprAbs(EvaluateCubic(_a, _b, _c, _d, right)) ? left : right;
+        }
+        fLeft = fRight;
+      }
+      return count;
+    }
+  }  // namespace detail
+
+  /// \class FixedPolynomial FixedPolynomial.hh gz/math/FixedPolynomial.hh
+  /// \brief The FixedPolynomial class represents a polynomial of a degree
+  /// known at compile time, p(x) = c0 x^n + c1 x^(n-1) + ... + cn, with
+  /// coefficients ordered as in Polynomial3. All operations but printing
+  /// are constexpr, so that polynomials built from constants are folded by
+  /// the compiler.
+  ///
+  /// Evaluation gives the same results as Polynomial3 for a cubic, and
+  /// FixedPolynomial satisfies the requirements of
+  /// AdditivelySeparableScalarField3 on its scalar functions.
+  /// \tparam T a floating point type
+  /// \tparam Degree polynomial degree
+  template<typename T, std::size_t Degree>
+  class FixedPolynomial
+  {
+    /// \brief Polynomial coefficients, highest degree first
+    public: using Coefficients = std::array<T, Degree + 1>;
+
+    /// \brief Constructor, for the zero polynomial
+    public: constexpr FixedPolynomial() = default;
+
+    /// \brief Constructor
+    /// \param[in] _coeffs coefficients c0 through cn, highest degree
+    ///   first
+    public: constexpr explicit FixedPolynomial(const Coefficients &_coeffs)
+    : coeffs(_coeffs)
+    {
+    }
+
+    /// \brief Constructor
+    /// \param[in] _coeffs Degree + 1 coefficients c0 through cn, highest
+    ///   degree first
+    public: template<typename... Args, typename = std::enable_if_t<
+      sizeof...(Args) == Degree + 1 &&
+      std::conjunction_v<std::is_arithmetic<Args>...>>>
+    constexpr explicit FixedPolynomial(Args... _coeffs)
+    : coeffs{{static_cast<T>(_coeffs)...}}
+    {
+    }
+
+    /// \brief Constructor from a cubic polynomial, with leading zero
+    /// coefficients if Degree is larger than 3.
+    /// \param[in] _poly cubic polynomial
+    public: template<std::size_t D = Degree,
+                     typename = std::enable_if_t<(D >= 3)>>
+    explicit FixedPolynomial(const Polynomial3<T> &_poly)
+    {
+      for (std::size_t i = 0; i < 4; ++i)
+        this->coeffs[Degree - 3 + i] = _poly.Coeffs()[i];
+    }
+
+    /// \brief Make a constant polynomial
+    /// \param[in] _value constant value
+    /// \return a constant polynomial
+    public: static constexpr FixedPolynomial Constant(T _value)
+    {
+      FixedPolynomial poly;
+      poly.coeffs[Degree] = _value;
+      return poly;
+    }
+
+    /// \brief Get the polynomial coefficients
+    /// \return the coefficients, highest degree first
+    public: constexpr const Coefficients &Coeffs() const
+    {
+      return this->coeffs;
+    }
+
+    /// \brief Convert to a cubic polynomial, with leading zero
+    /// coefficients if Degree is lower than 3.
+    /// \return the equivalent Polynomial3
+    public: Polynomial3<T> ToPolynomial3() const
+    {
+      static_assert(Degree <= 3, "Polynomial degree is larger than 3");
+      T c[4]{};
+      for (std::size_t i = 0; i <= Degree; ++i)
+        c[3 - Degree + i] = this->coeffs[i];
+      return Polynomial3<T>(Vector4<T>(c[0], c[1], c[2], c[3]));
+    }
+
+    /// \brief Evaluate the polynomial at `_x`
+    /// For non-finite `_x`, this function
+    /// computes p(z) as z tends to `_x`.
+    /// \param[in] _x polynomial argument
+    /// \return the result of evaluating p(`_x`)
+    public: constexpr T Evaluate(const T &_x) const
+    {
+      // NaN fails both comparisons
+      if (!(_x < T(0)) && !(_x >= T(0)))
+      {
+        return _x;
+      }
+      if (_x > std::numeric_limits<T>::max() ||
+          _x < std::numeric_limits<T>::lowest())
+      {
+        constexpr T epsilon = std::numeric_limits<T>::epsilon();
+        for (std::size_t i = 0; i < Degree; ++i)
+        {
+          const T c = this->coeffs[i];
+          if (detail::ConstexprAbs(c) >= epsilon)
+          {
+            const T sign = c < T(0) ? T(-1) : T(1);
+            if ((Degree - i) % 2 == 1)
+            {
+              return _x * sign;
+            }
+            return detail::ConstexprAbs(_x) * sign;
+          }
+        }
+        return this->coeffs[Degree];
+      }
+      // Sum terms from the highest degree with powers computed by
+      // successive products, as Polynomial3::Evaluate() does.
+      T powers[Degree + 1]{};
+      powers[0] = T(1);
+      for (std::size_t i = 1; i <= Degree; ++i)
+        powers[i] = powers[i - 1] * _x;
+      T result = this->coeffs[0] * powers[Degree];
+      for (std::size_t i = 1; i <= Degree; ++i)
+        result += this->coeffs[i] * powers[Degree - i];
+      return result;
+    }
+
+    /// \brief Call operator overload
+    /// \see FixedPolynomial::Evaluate()
+    public: constexpr T operator()(const T &_x) const
+    {
+      return this->Evaluate(_x);
+    }
+
+    /// \brief Compute the polynomial derivative
+    /// \return p', a polynomial of degree Degree - 1 (or 0 for a
+    ///   constant polynomial)
+    public: constexpr FixedPolynomial<T, (Degree > 0 ? Degree - 1 : 0)>
+    Derivative() const
+    {
+      typename FixedPolynomial<T, (Degree > 0 ? Degree - 1 : 0)>::
+        Coefficients c{};
+      for (std::size_t i = 0; i < Degree; ++i)
+        c[i] = this->coeffs[i] * static_cast<T>(Degree - i);
+      return FixedPolynomial<T, (Degree > 0 ? Degree - 1 : 0)>(c);
+    }
+
+    /// \brief Compute the real roots of the polynomial. Only available
+    /// for polynomials of degree 3 or lower. Leading coefficients with a
+    /// magnitude below machine epsilon are taken as zero, as in
+    /// Polynomial3::Minimum().
+    /// \param[out] _roots real roots, in ascending order
+    /// \return number of real roots written to `_roots`, 0 for constant
+    ///   polynomials
+    public: constexpr std::size_t Roots(std::array<T, Degree> &_roots) const
+    {
+      static_assert(Degree <= 3, "Roots() requires a degree of 3 or lower");
+      constexpr T epsilon = std::numeric_limits<T>::epsilon();
+      T c[4]{};
+      for (std::size_t i = 0; i <= Degree; ++i)
+        c[3 - Degree + i] = this->coeffs[i];
+
+      T roots[3]{};
+      std::size_t count = 0;
+      if (detail::ConstexprAbs(c[0]) >= epsilon)
+      {
+        count = detail::CubicRoots(c[0], c[1], c[2], c[3], roots);
+      }
+      else if (detail::ConstexprAbs(c[1]) >= epsilon)
+      {
+        count = detail::QuadraticRoots(c[1], c[2], c[3], roots);
+      }
+      else if (detail::ConstexprAbs(c[2]) >= epsilon)
+      {
+        roots[0] = -c[3] / c[2];
+        count = 1;
+      }
+      for (std::size_t i = 0; i < count; ++i)
+        _roots[i] = roots[i];
+      return count;
+    }
+
+    /// \brief Compute polynomial minimum in an `_interval`. Only
+    /// available for polynomials of degree 4 or lower, whose critical
+    /// points are the roots of a cubic or lower degree derivative.
+    /// \param[in] _interval polynomial argument interval to check
+    /// \param[out] _xMin polynomial argument that yields minimum,
+    ///   or NaN if the interval is empty
+    /// \return the polynomial minimum in the given interval,
+    ///   or NaN if the interval is empty
+    public: constexpr T Minimum(const Interval<T> &_interval, T &_xMin) const
+    {
+      static_assert(Degree <= 4,
+                    "Minimum() requires a degree of 4 or lower");
+      if (_interval.Empty())
+      {
+        _xMin = std::numeric_limits<T>::quiet_NaN();
+        return std::numeric_limits<T>::quiet_NaN();
+      }
+      // For open intervals, assume continuity in the limit
+      const T xLeft = _interval.LeftValue();
+      const T xRight = _interval.RightValue();
+      const T yLeft = this->Evaluate(xLeft);
+      const T yRight = this->Evaluate(xRight);
+      T yMin = yLeft;
+      _xMin = xLeft;
+      if (yRight < yLeft)
+      {
+        yMin = yRight;
+        _xMin = xRight;
+      }
+      if constexpr (Degree >= 2)
+      {
+        // Local minima are among the roots of p'(x)
+        std::array<T, Degree - 1> critical{};
+        const std::size_t count = this->Derivative().Roots(critical);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          if (_interval.Contains(critical[i]))
+          {
+            const T y = this->Evaluate(critical[i]);
+            if (y < yMin)
+            {
+              _xMin = critical[i];
+              yMin = y;
+            }
+          }
+        }
+      }
+      return yMin;
+    }
+
+    /// \brief Compute polynomial minimum in an `_interval`
+    /// \param[in] _interval polynomial argument interval to check
+    /// \return the polynomial minimum in the given interval (may
+    ///   not be finite), or NaN if the interval is empty
+    public: constexpr T Minimum(const Interval<T> &_interval) const
+    {
+      T xMin{};
+      return this->Minimum(_interval, xMin);
+    }
+
+    /// \brief Compute polynomial minimum
+    /// \param[out] _xMin polynomial argument that yields minimum
+    /// \return the polynomial minimum (may not be finite)
+    public: constexpr T Minimum(T &_xMin) const
+    {
+      return this->Minimum(detail::gUnboundedInterval<T>, _xMin);
+    }
+
+    /// \brief Compute polynomial minimum
+    /// \return the polynomial minimum (may not be finite)
+    public: constexpr T Minimum() const
+    {
+      T xMin{};
+      return this->Minimum(detail::gUnboundedInterval<T>, xMin);
+    }
+
+    /// \brief Prints polynomial as p(`_x`) to `_out` stream
+    /// \param[in] _out Output stream to print to
+    /// \param[in] _x Argument name to be used
+    public: void Print(std::ostream &_out, const std::string &_x = "x") const
+    {
+      constexpr T epsilon = std::numeric_limits<T>::epsilon();
+      bool streamStarted = false;
+      for (std::size_t i = 0; i <= Degree; ++i)
+      {
+        const T magnitude = detail::ConstexprAbs(this->coeffs[i]);
+        const bool sign = this->coeffs[i] < T(0);
+        const std::size_t exponent = Degree - i;
+        if (magnitude >= epsilon)
+        {
+          if (streamStarted)
+          {
+            _out << (sign ? " - " : " + ");
+          }
+          else if (sign)
+          {
+            _out << "-";
+          }
+          if (exponent > 0)
+          {
+            if ((magnitude - T(1)) > epsilon)
+            {
+              _out << magnitude << " ";
+            }
+            _out << _x;
+            if (exponent > 1)
+            {
+              _out << "^" << exponent;
+            }
+          }
+          else
+          {
+            _out << magnitude;
+          }
+          streamStarted = true;
+        }
+      }
+      if (!streamStarted)
+      {
+        _out << this->coeffs[Degree];
+      }
+    }
+
+    /// \brief Stream insertion operator
+    /// \param _out output stream
+    /// \param _p FixedPolynomial to output
+    /// \return the stream
+    public: friend std::ostream &operator<<(
+      std::ostream &_out, const FixedPolynomial &_p)
+    {
+      _p.Print(_out, "x");
+      return _out;
+    }
+
+    /// \brief Polynomial coefficients, highest degree first
+    private: Coefficients coeffs{};
+  };
+
+  template<std::size_t Degree>
+  using FixedPolynomialf = FixedPolynomial<float, Degree>;
+  template<std::size_t Degree>
+  using FixedPolynomiald = FixedPolynomial<double, Degree>;
+  }  // namespace GZ_MATH_VERSION_NAMESPACE
+}  // namespace gz::math
+#endif  // GZ_MATH_FIXEDPOLYNOMIAL_HH_
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_GAUSSMARKOVPROCESSBANK_HH_
+#define GZ_MATH_GAUSSMARKOVPROCESSBANK_HH_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gz/math/Export.hh>
+#include <gz/math/GaussMarkovProcess.hh>
+#include <gz/math/config.hh>
+#include <gz/utils/ImplPtr.hh>
+
+namespace gz::math
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace GZ_MATH_VERSION_NAMESPACE {
+  /** \class GaussMarkovProcessBank GaussMarkovProcessBank.hh\
+   * gz/math/GaussMarkovProcessBank.hh
+   **/
+  /// \brief A set of independent stationary Gauss-Markov (Ornstein
+  /// Uhlenbeck) processes updated together, e.g. the biases of many IMUs.
+  ///
+  /// Process parameters and values are stored in contiguous arrays, and
+  /// the noise of each update is drawn in bulk from a RandStream owned by
+  /// the bank. Results only depend on the seed, the stream index and the
+  /// sequence of updates, not on the number of threads.
+  ///
+  /// Unlike GaussMarkovProcess::Update(double), processes are advanced
+  /// with the exact solution of
+  ///
+  /// \f$dx_t = \theta (\mu - x_t) dt + \sigma dW_t\f$
+  ///
+  /// over the time step, where \f$W_t\f$ is a Wiener process:
+  ///
+  /// \f$x_{t+dt} = \mu + (x_t - \mu) e^{-\theta dt} +
+  /// \sigma \sqrt{(1 - e^{-2 \theta dt}) / (2 \theta)} N(0, 1)\f$
+  ///
+  /// so the statistics of a process do not depend on the time step, and
+  /// its stationary standard deviation is \f$\sigma / \sqrt{2 \theta}\f$.
+  class GZ_MATH_VISIBLE GaussMarkovProcessBank
+  {
+    /// \brief Constructor of an empty bank, seeded from Rand::Seed().
+    /// \param[in] _stream Index of the random stream of the bank.
+    public: explicit GaussMarkovProcessBank(uint64_t _stream = 0);
+
+    /// \brief Constructor of an empty bank.
+    /// \param[in] _seed Seed of the random stream of the bank.
+    /// \param[in] _stream Index of the random stream of the bank.
+    public: GaussMarkovProcessBank(unsigned int _seed, uint64_t _stream);
+
+    /// \brief Reseed the random stream of the bank.
+    /// \param[in] _seed Seed of the random stream.
+    /// \param[in] _stream Index of the random stream.
+    public: void Seed(unsigned int _seed, uint64_t _stream);
+
+    /// \brief Add a process.
+    /// \param[in] _start The start value of the process.
+    /// \param[in] _theta The theta (\f$\theta\f$) parameter. A value of
+    /// zero will be used if this parameter is negative.
+    /// \param[in] _mu The mu (\f$\mu\f$) parameter.
+    /// \param[in] _sigma The sigma (\f$\sigma\f$) parameter. A value of
+    /// zero will be used if this parameter is negative.
+    /// \return Index of the new process.
+    public: std::size_t Add(double _start, double _theta, double _mu,
+                            double _sigma);
+
+    /// \brief Set the parameters of a process, and reset it to its start
+    /// value.
+    /// \param[in] _index Index of the process.
+    /// \param[in] _start The start value of the process.
+    /// \param[in] _theta The theta (\f$\theta\f$) parameter.
+    /// \param[in] _mu The mu (\f$\mu\f$) parameter.
+    /// \param[in] _sigma The sigma (\f$\sigma\f$) parameter.
+    /// \return False if _index is out of range.
+    public: bool Set(std::size_t _index, double _start, double _theta,
+                     double _mu, double _sigma);
+
+    /// \brief Get the number of processes.
+    /// \return Number of processes.
+    public: std::size_t Size() const;
+
+    /// \brief Remove all processes.
+    public: void Clear();
+
+    /// \brief Reset all processes to their start values.
+    public: void Reset();
+
+    /// \brief Get the current process values.
+    /// \return Values, indexed by process.
+    public: const std::vector<double> &Values() const;
+
+    /// \brief Get the start values.
+    /// \return Start values, indexed by process.
+    public: const std::vector<double> &Start() const;
+
+    /// \brief Get the theta (\f$\theta\f$) values.
+    /// \return Theta values, indexed by process.
+    public: const std::vector<double> &Theta() const;
+
+    /// \brief Get the mu (\f$\mu\f$) values.
+    /// \return Mu values, indexed by process.
+    public: const std::vector<double> &Mu() const;
+
+    /// \brief Get the sigma (\f$\sigma\f$) values.
+    /// \return Sigma values, indexed by process.
+    public: const std::vector<double> &Sigma() const;
+
+    /// \brief Update all processes over a time step.
+    /// \param[in] _dt Length of the time step. The processes are left
+    /// unchanged if it is not positive.
+    /// \param[in] _threads Number of threads to use, 0 for one per core.
+    /// \return The new process values.
+    public: const std::vector<double> &Update(const clock::duration &_dt,
+                                              unsigned int _threads = 1);
+
+    /// \brief Update all processes over a time step.
+    /// \param[in] _dt Length of the time step in seconds. The processes are
+    /// left unchanged, and the noise stream is not advanced, if it is not
+    /// positive or is NaN.
+    /// \param[in] _threads Number of threads to use, 0 for one per core.
+    /// \return The new process values.
+    public: const std::vector<double> &Update(double _dt,
+                                              unsigned int _threads = 1);
+
+    /// \brief Private data pointer.
+    GZ_UTILS_IMPL_PTR(dataPtr)
+  };
+  }  // namespace GZ_MATH_VERSION_NAMESPACE
+}  // namespace gz::math
+#endif  // GZ_MATH_GAUSSMARKOVPROCESSBANK_HH_
@@ -114,25 +114,25 @@ namespace gz::math
 
     /// \brief Get the leftmost interval value
     /// \return the leftmost interval value
-    public: const T &LeftValue() const { return this->leftValue; }
+    public: constexpr const T &LeftValue() const { return this->leftValue; }
 
     /// \brief Check if the interval is left-closed
     /// \return true if the interval is left-closed, false otherwise
-    public: bool IsLeftClosed() const { return this->leftClosed; }
+    public: constexpr bool IsLeftClosed() const { return this->leftClosed; }
 
     /// \brief Get the rightmost interval value
     /// \return the rightmost interval value
-    public: const T &RightValue() const { return this->rightValue; }
+    public: constexpr const T &RightValue() const { return this->rightValue; }
 
     /// \brief Check if the interval is right-closed
     /// \return true if the interval is right-closed, false otherwise
-    public: bool IsRightClosed() const { return this->rightClosed; }
+    public: constexpr bool IsRightClosed() const { return this->rightClosed; }
 
     /// \brief Check if the interval is empty
     /// Some examples of empty intervals include
     /// (a, a), [a, a), and [a + 1, a].
     /// \return true if it is empty, false otherwise
-    public: bool Empty() const
+    public: constexpr bool Empty() const
     {
       if (this->leftClosed && this->rightClosed)
       {
@@ -144,7 +144,7 @@ namespace gz::math
     /// \brief Check if the interval contains `_value`
     /// \param[in] _value value to check for membership
     /// \return true if it is contained, false otherwise
-    public: bool Contains(const T &_value) const
+    public: constexpr bool Contains(const T &_value) const
     {
       if (this->leftClosed && this->rightClosed)
       {
@@ -29,6 +29,23 @@ namespace gz::math
   // Inline bracket to help doxygen filtering.
   inline namespace GZ_MATH_VERSION_NAMESPACE {
 
+  /// \enum KmeansSeeding
+  /// \brief Strategy used by Kmeans to choose the initial centroids.
+  enum class KmeansSeeding
+  {
+    /// \brief Use the first k observations as initial centroids. This is
+    /// the fastest option and it is deterministic, but it can produce poor
+    /// clusters when the observations are sorted.
+    FirstK,
+
+    /// \brief k-means++ seeding: the first centroid is a random
+    /// observation and every following centroid is drawn with probability
+    /// proportional to its squared distance to the closest centroid chosen
+    /// so far. The random numbers are drawn from Rand, so the result is
+    /// reproducible after calling Rand::Seed().
+    KmeansPlusPlus
+  };
+
   /// \class Kmeans Kmeans.hh math/gzmath.hh
   /// \brief K-Means clustering algorithm. Given a set of observations,
   /// k-means partitions the observations into k sets so as to minimize the
@@ -69,6 +86,61 @@ namespace gz::math
                          std::vector<Vector3d> &_centroids,
                          std::vector<unsigned int> &_labels);
 
+    /// \brief Executes the mini-batch k-means algorithm. Each iteration
+    /// draws _batchSize random observations and moves their closest
+    /// centroids towards them with a per-centroid learning rate. If a
+    /// previous call to Cluster() or MiniBatchCluster() used the same _k
+    /// and the observations were not replaced since, the previous centroids
+    /// are used as a warm start. This makes it possible to refine the
+    /// clusters incrementally after AppendObservations().
+    /// \param[in] _k Number of partitions to cluster.
+    /// \param[in] _batchSize Number of observations sampled per iteration.
+    /// \param[in] _iterations Number of mini-batch iterations to run.
+    /// \param[out] _centroids Vector of centroids. Each element contains the
+    /// centroid of one cluster.
+    /// \param[out] _labels Vector of labels. The size of this vector is
+    /// equals to the number of observations. Each element represents the
+    /// cluster to which observation belongs.
+    /// \return True when the operation succeed or false otherwise. The
+    /// operation fails for the same reasons as Cluster() or if _batchSize
+    /// is zero.
+    public: bool MiniBatchCluster(int _k,
+                                  unsigned int _batchSize,
+                                  unsigned int _iterations,
+                                  std::vector<Vector3d> &_centroids,
+                                  std::vector<unsigned int> &_labels);
+
+    /// \brief Get the strategy used to choose the initial centroids.
+    /// \return The seeding strategy. The default is KmeansSeeding::FirstK.
+    public: KmeansSeeding Seeding() const;
+
+    /// \brief Set the strategy used to choose the initial centroids.
+    /// \param[in] _seeding The new seeding strategy.
+    public: void Seeding(KmeansSeeding _seeding);
+
+    /// \brief Get the number of threads used to label the observations.
+    /// \return The number of threads. The default is 1.
+    public: unsigned int Threads() const;
+
+    /// \brief Set the number of threads used to label the observations and
+    /// to accumulate the centroids. The partial sums are combined in a
+    /// fixed order, but the centroids may differ in the last bits for
+    /// different number of threads.
+    /// \param[in] _threads Number of threads. A value of 0 uses the number
+    /// of concurrent threads supported by the hardware.
+    public: void Threads(unsigned int _threads);
+
+    /// \brief Get the number of iterations executed by the last call to
+    /// Cluster() or MiniBatchCluster().
+    /// \return The number of iterations.
+    public: unsigned int Iterations() const;
+
+    /// \brief Get the inertia of the last clustering, i.e. the sum of the
+    /// squared distances from each observation to its centroid.
+    /// \return The inertia of the last clustering, or 0 if no clustering
+    /// was executed.
+    public: double Inertia() const;
+
     /// \brief Given an observation, it returns the closest centroid to it.
     /// \param[in] _p Point to check.
     /// \return The index of the closest centroid to the point _p.
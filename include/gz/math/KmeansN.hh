@@ -0,0 +1,603 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_KMEANSN_HH_
+#define GZ_MATH_KMEANSN_HH_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+#include <gz/math/Kmeans.hh>
+#include <gz/math/Rand.hh>
+#include <gz/math/config.hh>
+#include <gz/math/detail/Error.hh>
+#include <gz/math/detail/ParallelFor.hh>
+
+namespace gz::math
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace GZ_MATH_VERSION_NAMESPACE {
+
+  /// \class KmeansN KmeansN.hh gz/math/KmeansN.hh
+  /// \brief K-Means clustering of points of any dimension stored in a
+  /// contiguous, caller-owned buffer. This is the implementation behind
+  /// Kmeans (Hamerly's bounds on top of Lloyd's iterations, optional
+  /// k-means++ seeding and threads) but the observations are never copied:
+  /// point i is made of the _Dim values starting at _obs[i * _Dim].
+  /// Centroids and labels are written into caller buffers as well.
+  /// Using float observations halves the memory traffic; the centroids are
+  /// accumulated in double precision regardless.
+  ///
+  /// ## Example
+  ///
+  /// \code{.cpp}
+  /// std::vector<float> colors = LoadRGBA();  // 4 floats per pixel
+  /// gz::math::KmeansN<float, 4> kmeans(colors.data(), colors.size() / 4);
+  /// std::vector<float> palette(16 * 4);
+  /// std::vector<unsigned int> labels(colors.size() / 4);
+  /// kmeans.Cluster(16, palette.data(), labels.data());
+  /// \endcode
+  ///
+  /// \tparam T Floating point type of the observations.
+  /// \tparam Dim Number of values per observation.
+  template<typename T, std::size_t Dim>
+  class KmeansN
+  {
+    static_assert(std::is_floating_point_v<T>,
+                  "KmeansN requires floating point observations");
+    static_assert(Dim > 0, "KmeansN requires a positive dimension");
+
+    /// \brief Type used to accumulate the centroids.
+    private: using AccumT =
+      std::conditional_t<(sizeof(T) < sizeof(double)), double, T>;
+
+    /// \brief Constructor without observations.
+    public: KmeansN() = default;
+
+    /// \brief Constructor.
+    /// \param[in] _obs Buffer with _count * Dim values. It is not copied,
+    /// so it must remain valid while this object clusters it.
+    /// \param[in] _count Number of observations in the buffer.
+    public: KmeansN(const T *_obs, std::size_t _count)
+    {
+      this->Observations(_obs, _count);
+    }
+
+    /// \brief Get the observations buffer.
+    /// \return Pointer to the first value of the observations.
+    public: const T *Observations() const
+    {
+      return this->obs;
+    }
+
+    /// \brief Get the number of observations.
+    /// \return The number of observations.
+    public: std::size_t ObservationCount() const
+    {
+      return this->count;
+    }
+
+    /// \brief Set the observations to cluster.
+    /// \param[in] _obs Buffer with _count * Dim values. It is not copied.
+    /// \param[in] _count Number of observations in the buffer.
+    /// \return True if the buffer is not empty or false otherwise.
+    public: bool Observations(const T *_obs, std::size_t _count)
+    {
+      if (_obs == nullptr || _count == 0)
+      {
+        detail::LogErrorMessage(
+            "KmeansN::Observations() error: Observations buffer is empty");
+        return false;
+      }
+      this->obs = _obs;
+      this->count = _count;
+      return true;
+    }
+
+    /// \brief Get the strategy used to choose the initial centroids.
+    /// \return The seeding strategy.
+    public: KmeansSeeding Seeding() const
+    {
+      return this->seeding;
+    }
+
+    /// \brief Set the strategy used to choose the initial centroids.
+    /// \param[in] _seeding The new seeding strategy.
+    public: void Seeding(KmeansSeeding _seeding)
+    {
+      this->seeding = _seeding;
+    }
+
+    /// \brief Get the number of threads used to label the observations.
+    /// \return The number of threads.
+    public: unsigned int Threads() const
+    {
+      return this->threads;
+    }
+
+    /// \brief Set the number of threads used to label the observations.
+    /// \param[in] _threads Number of threads. A value of 0 uses the number
+    /// of concurrent threads supported by the hardware.
+    public: void Threads(unsigned int _threads)
+    {
+      this->threads = _threads;
+    }
+
+    /// \brief Get the number of iterations executed by the last call to
+    /// Cluster().
+    /// \return The number of iterations.
+    public: unsigned int Iterations() const
+    {
+      return this->iterations;
+    }
+
+    /// \brief Get the sum of the squared distances from each observation
+    /// to its centroid after the last call to Cluster() or Label().
+    /// \return The inertia of the last clustering.
+    public: double Inertia() const
+    {
+      return this->inertia;
+    }
+
+    /// \brief Executes the k-means algorithm.
+    /// \param[in] _k Number of partitions to cluster.
+    /// \param[out] _centroids Buffer of _k * Dim values that receives the
+    /// centroids.
+    /// \param[out] _labels Buffer of ObservationCount() values that receives
+    /// the cluster of each observation.
+    /// \return True when the operation succeed or false otherwise. The
+    /// operation will fail if there are no observations, if _k is zero or
+    /// greater than the number of observations, or if an output buffer is
+    /// null.
+    public: bool Cluster(unsigned int _k, T *_centroids,
+                         unsigned int *_labels)
+    {
+      if (!this->ValidArgs(_k, _centroids) || !this->ValidLabels(_labels))
+        return false;
+
+      const std::size_t n = this->count;
+      const unsigned int numThreads = this->UsefulThreads();
+
+      this->Seed(_k, numThreads, _centroids);
+
+      std::fill(_labels, _labels + n, 0u);
+      this->upper.assign(n, T(0));
+      this->lower.assign(n, T(0));
+
+      std::vector<std::vector<AccumT>> partialSums(numThreads,
+          std::vector<AccumT>(_k * Dim));
+      std::vector<std::vector<std::size_t>> partialCounters(numThreads,
+          std::vector<std::size_t>(_k));
+      std::vector<std::size_t> partialChanged(numThreads);
+
+      std::vector<T> halfMinDist(_k);
+      std::vector<T> moved(_k, T(0));
+      T maxMoved = 0;
+      T secondMaxMoved = 0;
+      unsigned int maxMovedIdx = 0;
+
+      std::size_t changed = 0;
+      this->iterations = 0;
+
+      do
+      {
+        for (auto i = 0u; i < _k; ++i)
+        {
+          T minDist = std::numeric_limits<T>::infinity();
+          for (auto j = 0u; j < _k; ++j)
+          {
+            if (i != j)
+            {
+              minDist = std::min(minDist,
+                  Distance(_centroids + i * Dim, _centroids + j * Dim));
+            }
+          }
+          halfMinDist[i] = T(0.5) * minDist;
+        }
+
+        const bool firstIteration = this->iterations == 0;
+        detail::ParallelFor(n, numThreads,
+            [&](std::size_t _begin, std::size_t _end, unsigned int _t)
+            {
+              auto &sums = partialSums[_t];
+              auto &counters = partialCounters[_t];
+              std::fill(sums.begin(), sums.end(), AccumT(0));
+              std::fill(counters.begin(), counters.end(), 0u);
+              std::size_t localChanged = 0;
+
+              for (auto i = _begin; i < _end; ++i)
+              {
+                const T *p = this->obs + i * Dim;
+                unsigned int label = _labels[i];
+                if (firstIteration)
+                {
+                  label = ClosestTwo(p, _centroids, _k,
+                                     this->upper[i], this->lower[i]);
+                }
+                else
+                {
+                  this->upper[i] += moved[label];
+                  this->lower[i] -=
+                    (label == maxMovedIdx) ? secondMaxMoved : maxMoved;
+                  const T bound = std::max(halfMinDist[label], this->lower[i]);
+                  if (this->upper[i] > bound)
+                  {
+                    this->upper[i] = Distance(p, _centroids + label * Dim);
+                    if (this->upper[i] > bound)
+                    {
+                      label = ClosestTwo(p, _centroids, _k,
+                                         this->upper[i], this->lower[i]);
+                    }
+                  }
+                }
+
+                if (_labels[i] != label)
+                {
+                  _labels[i] = label;
+                  localChanged++;
+                }
+                for (std::size_t d = 0; d < Dim; ++d)
+                  sums[label * Dim + d] += p[d];
+                counters[label]++;
+              }
+              partialChanged[_t] = localChanged;
+            });
+
+        changed = 0;
+        for (auto t = 1u; t < numThreads; ++t)
+        {
+          for (std::size_t i = 0; i < _k * Dim; ++i)
+            partialSums[0][i] += partialSums[t][i];
+          for (std::size_t i = 0; i < _k; ++i)
+            partialCounters[0][i] += partialCounters[t][i];
+        }
+        for (auto t = 0u; t < numThreads; ++t)
+          changed += partialChanged[t];
+
+        // Update the centroids. An empty cluster keeps its centroid.
+        maxMoved = 0;
+        secondMaxMoved = 0;
+        maxMovedIdx = 0;
+        for (auto i = 0u; i < _k; ++i)
+        {
+          moved[i] = 0;
+          if (partialCounters[0][i] == 0)
+            continue;
+
+          T *c = _centroids + i * Dim;
+          AccumT dist2 = 0;
+          for (std::size_t d = 0; d < Dim; ++d)
+          {
+            const T value = static_cast<T>(partialSums[0][i * Dim + d] /
+                static_cast<AccumT>(partialCounters[0][i]));
+            dist2 += static_cast<AccumT>(value - c[d]) * (value - c[d]);
+            c[d] = value;
+          }
+          moved[i] = static_cast<T>(std::sqrt(dist2));
+
+          if (moved[i] > maxMoved)
+          {
+            secondMaxMoved = maxMoved;
+            maxMoved = moved[i];
+            maxMovedIdx = i;
+          }
+          else if (moved[i] > secondMaxMoved)
+          {
+            secondMaxMoved = moved[i];
+          }
+        }
+        this->iterations++;
+      }
+      while (changed > (n >> 10));
+
+      // Inertia with respect to the final centroids.
+      this->inertia = this->ComputeInertia(_centroids, _labels, numThreads);
+      return true;
+    }
+
+    /// \brief Choose initial centroids with the current seeding strategy,
+    /// as done by Cluster().
+    /// \param[in] _k Number of centroids.
+    /// \param[out] _centroids Buffer of _k * Dim values that receives the
+    /// centroids.
+    /// \return False if there are no observations, if _k is zero or greater
+    /// than the number of observations, or if _centroids is null.
+    public: bool SeedCentroids(unsigned int _k, T *_centroids) const
+    {
+      if (!this->ValidArgs(_k, _centroids))
+        return false;
+
+      this->Seed(_k, this->UsefulThreads(), _centroids);
+      return true;
+    }
+
+    /// \brief Label every observation with its closest centroid, without
+    /// moving the centroids. Inertia() returns the inertia of this
+    /// labelling afterwards.
+    /// \param[in] _k Number of centroids.
+    /// \param[in] _centroids Buffer of _k * Dim values with the centroids.
+    /// \param[out] _labels Buffer of ObservationCount() values that receives
+    /// the closest centroid of each observation.
+    /// \return False for the same reasons as Cluster().
+    public: bool Label(unsigned int _k, const T *_centroids,
+                       unsigned int *_labels)
+    {
+      if (!this->ValidArgs(_k, _centroids) || !this->ValidLabels(_labels))
+        return false;
+
+      const unsigned int numThreads = this->UsefulThreads();
+      detail::ParallelFor(this->count, numThreads,
+          [&](std::size_t _begin, std::size_t _end, unsigned int)
+          {
+            for (auto i = _begin; i < _end; ++i)
+            {
+              _labels[i] =
+                ClosestCentroid(this->obs + i * Dim, _centroids, _k);
+            }
+          });
+      this->inertia = this->ComputeInertia(_centroids, _labels, numThreads);
+      return true;
+    }
+
+    /// \brief Find the closest centroid to a point.
+    /// \param[in] _p Point with Dim values.
+    /// \param[in] _centroids Buffer of _k * Dim values with the centroids.
+    /// \param[in] _k Number of centroids, positive.
+    /// \return Index of the closest centroid. Ties resolve to the lowest
+    /// index.
+    public: static unsigned int ClosestCentroid(const T *_p,
+                                                const T *_centroids,
+                                                unsigned int _k)
+    {
+      T closest, second;
+      return ClosestTwo(_p, _centroids, _k, closest, second);
+    }
+
+    /// \brief Check the number of clusters and the centroids buffer.
+    /// \param[in] _k Number of clusters.
+    /// \param[in] _centroids Centroids buffer.
+    /// \return True if they are valid.
+    private: bool ValidArgs(unsigned int _k, const T *_centroids) const
+    {
+      if (this->count == 0)
+      {
+        detail::LogErrorMessage(
+            "KmeansN error: The set of observations is empty");
+        return false;
+      }
+
+      if (_k == 0 || _k > this->count)
+      {
+        std::ostringstream errStream;
+        errStream << "KmeansN error: The number of clusters [" << _k
+                  << "] has to be positive and lower or equal to the number"
+                  << " of observations [" << this->count << "]";
+        detail::LogErrorMessage(errStream.str());
+        return false;
+      }
+
+      if (_centroids == nullptr)
+      {
+        detail::LogErrorMessage("KmeansN error: Centroids buffer is null");
+        return false;
+      }
+      return true;
+    }
+
+    /// \brief Number of threads worth using on the observations.
+    /// \return Number of threads, always positive.
+    private: unsigned int UsefulThreads() const
+    {
+      // Each observation only takes a few distance computations.
+      return detail::ThreadCount(this->threads, this->count, 4096);
+    }
+
+    /// \brief Check the labels buffer.
+    /// \param[in] _labels Labels buffer.
+    /// \return True if it is valid.
+    private: static bool ValidLabels(const unsigned int *_labels)
+    {
+      if (_labels == nullptr)
+      {
+        detail::LogErrorMessage("KmeansN error: Labels buffer is null");
+        return false;
+      }
+      return true;
+    }
+
+    /// \brief Sum of the squared distances from each observation to its
+    /// centroid.
+    /// \param[in] _centroids Centroids buffer.
+    /// \param[in] _labels Label of each observation.
+    /// \param[in] _threads Number of threads.
+    /// \return The inertia.
+    private: double ComputeInertia(const T *_centroids,
+                                   const unsigned int *_labels,
+                                   unsigned int _threads) const
+    {
+      std::vector<double> partialInertia(_threads, 0.0);
+      detail::ParallelFor(this->count, _threads,
+          [&](std::size_t _begin, std::size_t _end, unsigned int _t)
+          {
+            double sum = 0;
+            for (auto i = _begin; i < _end; ++i)
+            {
+              sum += SquaredDistance(this->obs + i * Dim,
+                                     _centroids + _labels[i] * Dim);
+            }
+            partialInertia[_t] = sum;
+          });
+      double result = 0;
+      for (double partial : partialInertia)
+        result += partial;
+      return result;
+    }
+
+    /// \brief Squared Euclidean distance between two points.
+    /// \param[in] _a First point.
+    /// \param[in] _b Second point.
+    /// \return The squared distance.
+    private: static AccumT SquaredDistance(const T *_a, const T *_b)
+    {
+      AccumT sum = 0;
+      for (std::size_t d = 0; d < Dim; ++d)
+      {
+        const AccumT diff = static_cast<AccumT>(_a[d]) - _b[d];
+        sum += diff * diff;
+      }
+      return sum;
+    }
+
+    /// \brief Euclidean distance between two points, computed in T.
+    /// \param[in] _a First point.
+    /// \param[in] _b Second point.
+    /// \return The distance.
+    private: static T Distance(const T *_a, const T *_b)
+    {
+      T sum = 0;
+      for (std::size_t d = 0; d < Dim; ++d)
+      {
+        const T diff = _a[d] - _b[d];
+        sum += diff * diff;
+      }
+      return std::sqrt(sum);
+    }
+
+    /// \brief Find the closest and the second closest centroids to a point.
+    /// \param[in] _p Point to check.
+    /// \param[in] _centroids Centroids buffer.
+    /// \param[in] _k Number of centroids.
+    /// \param[out] _closestDist Distance to the closest centroid.
+    /// \param[out] _secondDist Distance to the second closest centroid.
+    /// \return Index of the closest centroid.
+    private: static unsigned int ClosestTwo(const T *_p, const T *_centroids,
+                                            unsigned int _k, T &_closestDist,
+                                            T &_secondDist)
+    {
+      _closestDist = std::numeric_limits<T>::infinity();
+      _secondDist = std::numeric_limits<T>::infinity();
+      unsigned int minIdx = 0;
+      for (auto i = 0u; i < _k; ++i)
+      {
+        const T d = Distance(_p, _centroids + i * Dim);
+        if (d < _closestDist)
+        {
+          _secondDist = _closestDist;
+          _closestDist = d;
+          minIdx = i;
+        }
+        else if (d < _secondDist)
+        {
+          _secondDist = d;
+        }
+      }
+      return minIdx;
+    }
+
+    /// \brief Choose the initial centroids.
+    /// \param[in] _k Number of centroids.
+    /// \param[in] _threads Number of threads.
+    /// \param[out] _centroids Buffer that receives the centroids.
+    private: void Seed(unsigned int _k, unsigned int _threads,
+                       T *_centroids) const
+    {
+      const std::size_t n = this->count;
+      if (this->seeding == KmeansSeeding::FirstK)
+      {
+        std::copy(this->obs, this->obs + _k * Dim, _centroids);
+        return;
+      }
+
+      const int last = static_cast<int>(n) - 1;
+      std::size_t next = static_cast<std::size_t>(Rand::IntUniform(0, last));
+      std::vector<AccumT> dist2(n, std::numeric_limits<AccumT>::infinity());
+      for (auto c = 0u; c < _k; ++c)
+      {
+        const T *centroid = this->obs + next * Dim;
+        std::copy(centroid, centroid + Dim, _centroids + c * Dim);
+        if (c + 1 == _k)
+          break;
+
+        detail::ParallelFor(n, _threads,
+            [&](std::size_t _begin, std::size_t _end, unsigned int)
+            {
+              for (auto i = _begin; i < _end; ++i)
+              {
+                dist2[i] = std::min(dist2[i],
+                    SquaredDistance(this->obs + i * Dim, centroid));
+              }
+            });
+
+        AccumT total = 0;
+        for (auto d : dist2)
+          total += d;
+
+        if (total > 0)
+        {
+          // Sample proportionally to the squared distance.
+          const double target = Rand::DblUniform(0, total);
+          AccumT cumulative = 0;
+          next = n - 1;
+          for (std::size_t i = 0; i < n; ++i)
+          {
+            cumulative += dist2[i];
+            if (cumulative >= target && dist2[i] > 0)
+            {
+              next = i;
+              break;
+            }
+          }
+        }
+        else
+        {
+          next = static_cast<std::size_t>(Rand::IntUniform(0, last));
+        }
+      }
+    }
+
+    /// \brief Observations buffer, not owned.
+    private: const T *obs{nullptr};
+
+    /// \brief Number of observations.
+    private: std::size_t count{0};
+
+    /// \brief Strategy used to choose the initial centroids.
+    private: KmeansSeeding seeding{KmeansSeeding::FirstK};
+
+    /// \brief Number of threads used to label the observations.
+    private: unsigned int threads{1};
+
+    /// \brief Number of iterations executed by the last clustering.
+    private: unsigned int iterations{0};
+
+    /// \brief Inertia of the last clustering.
+    private: double inertia{0};
+
+    /// \brief Upper bound of the distance to the assigned centroid.
+    private: std::vector<T> upper;
+
+    /// \brief Lower bound of the distance to the second closest centroid.
+    private: std::vector<T> lower;
+  };
+  }  // namespace GZ_MATH_VERSION_NAMESPACE
+}  // namespace gz::math
+#endif  // GZ_MATH_KMEANSN_HH_
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_MAPPEDFILE_HH_
+#define GZ_MATH_MAPPEDFILE_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <gz/math/Export.hh>
+#include <gz/math/config.hh>
+#include <gz/utils/ImplPtr.hh>
+
+namespace gz::math
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace GZ_MATH_VERSION_NAMESPACE {
+  /// \class MappedFile MappedFile.hh gz/math/MappedFile.hh
+  /// \brief Read-only view of a whole file mapped in memory. Pages are
+  /// loaded by the operating system when they are first accessed, so large
+  /// datasets can be opened instantly and only the parts in use occupy
+  /// memory.
+  class GZ_MATH_VISIBLE MappedFile
+  {
+    /// \brief Constructor. The file is closed.
+    public: MappedFile();
+
+    /// \brief Destructor. Unmaps the file.
+    public: ~MappedFile();
+
+    /// \brief Move constructor.
+    /// \param[in] _other File to take the mapping from.
+    public: MappedFile(MappedFile &&_other) noexcept;
+
+    /// \brief Move assignment operator. The current file is unmapped.
+    /// \param[in] _other File to take the mapping from.
+    /// \return Reference to this file.
+    public: MappedFile &operator=(MappedFile &&_other) noexcept;
+
+    /// \brief Map a file in memory, closing the current one if any.
+    /// \param[in] _path Path of the file.
+    /// \return True on success, false if the file could not be opened or
+    /// mapped. Empty files cannot be mapped.
+    public: bool Open(const std::string &_path);
+
+    /// \brief Unmap the file. Pointers returned by Data() become invalid.
+    public: void Close();
+
+    /// \brief Check whether a file is mapped.
+    /// \return True if Open() succeeded and Close() was not called since.
+    public: bool IsOpen() const;
+
+    /// \brief Get the contents of the file.
+    /// \return Pointer to the first byte of the file, or nullptr if no
+    /// file is mapped.
+    public: const uint8_t *Data() const;
+
+    /// \brief Get the size of the file.
+    /// \return The size of the file in bytes, or 0 if no file is mapped.
+    public: std::size_t Size() const;
+
+    /// \brief Hint that a range of the file will be read soon, so that the
+    /// operating system starts loading it in the background. Ranges outside
+    /// of the file are clipped.
+    /// \param[in] _offset Offset of the range in bytes.
+    /// \param[in] _size Size of the range in bytes.
+    public: void Prefetch(std::size_t _offset, std::size_t _size) const;
+
+    /// \brief Hint that a range of the file will not be read again soon,
+    /// so that the operating system can release its memory first. The
+    /// contents remain readable. Ranges outside of the file are clipped.
+    /// \param[in] _offset Offset of the range in bytes.
+    /// \param[in] _size Size of the range in bytes.
+    public: void Release(std::size_t _offset, std::size_t _size) const;
+
+    /// \brief Private data pointer.
+    GZ_UTILS_UNIQUE_IMPL_PTR(dataPtr)
+  };
+  }  // namespace GZ_MATH_VERSION_NAMESPACE
+}  // namespace gz::math
+#endif  // GZ_MATH_MAPPEDFILE_HH_
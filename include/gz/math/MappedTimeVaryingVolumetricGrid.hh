@@ -0,0 +1,601 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_MAPPED_TIME_VARYING_VOLUMETRIC_GRID_HH_
+#define GZ_MATH_MAPPED_TIME_VARYING_VOLUMETRIC_GRID_HH_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <gz/math/MappedFile.hh>
+#include <gz/math/TimeVaryingVolumetricGrid.hh>
+#include <gz/math/VolumetricGridFile.hh>
+#include <gz/math/VolumetricGridLookupField.hh>
+
+namespace gz::math
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace GZ_MATH_VERSION_NAMESPACE {
+  namespace detail {
+    /// \brief Thread safe least recently used cache of decoded tiles of a
+    /// volumetric grid file.
+    template<typename V>
+    class VolumetricGridTileCache
+    {
+      /// \brief Pointer to the first value of a tile. Tiles stay valid
+      /// while they are in use, even if they are evicted from the cache.
+      public: using Tile = std::shared_ptr<const V>;
+
+      /// \brief Constructor.
+      /// \param[in] _capacity Maximum number of tiles, at least 1.
+      public: explicit VolumetricGridTileCache(std::size_t _capacity)
+        : capacity(std::max<std::size_t>(_capacity, 1))
+      {
+      }
+
+      /// \brief Find a tile, and mark it as the most recently used.
+      /// \param[in] _key The key of the tile.
+      /// \return The tile, nullptr if it is not in the cache.
+      public: Tile Find(uint64_t _key)
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        auto it = this->entries.find(_key);
+        if (it == this->entries.end())
+          return nullptr;
+        this->order.splice(this->order.begin(), this->order, it->second);
+        return it->second->second;
+      }
+
+      /// \brief Check whether a tile is in the cache, without changing the
+      /// order of eviction.
+      /// \param[in] _key The key of the tile.
+      /// \return True if the tile is in the cache.
+      public: bool Contains(uint64_t _key) const
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->entries.count(_key) > 0;
+      }
+
+      /// \brief Add a tile as the most recently used one, evicting the
+      /// least recently used tiles beyond the capacity.
+      /// \param[in] _key The key of the tile.
+      /// \param[in] _tile The tile.
+      /// \param[out] _evicted Keys of the evicted tiles are appended.
+      /// \return The cached tile, which is the one added by another thread
+      /// if it was faster.
+      public: Tile Insert(uint64_t _key, Tile _tile,
+                          std::vector<uint64_t> &_evicted)
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        auto it = this->entries.find(_key);
+        if (it != this->entries.end())
+        {
+          this->order.splice(this->order.begin(), this->order, it->second);
+          return it->second->second;
+        }
+        this->order.emplace_front(_key, std::move(_tile));
+        this->entries.emplace(_key, this->order.begin());
+        this->Evict(_evicted);
+        return this->order.front().second;
+      }
+
+      /// \brief Change the maximum number of tiles.
+      /// \param[in] _capacity Maximum number of tiles, at least 1.
+      /// \param[out] _evicted Keys of the evicted tiles are appended.
+      public: void SetCapacity(std::size_t _capacity,
+                               std::vector<uint64_t> &_evicted)
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->capacity = std::max<std::size_t>(_capacity, 1);
+        this->Evict(_evicted);
+      }
+
+      /// \brief Get the maximum number of tiles.
+      /// \return The capacity of the cache.
+      public: std::size_t Capacity() const
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->capacity;
+      }
+
+      /// \brief Get the number of tiles in the cache.
+      /// \return The number of tiles.
+      public: std::size_t Size() const
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->entries.size();
+      }
+
+      /// \brief Get the keys of the tiles in the cache.
+      /// \return The keys, from the most to the least recently used.
+      public: std::vector<uint64_t> Keys() const
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        std::vector<uint64_t> keys;
+        keys.reserve(this->order.size());
+        for (const auto &entry : this->order)
+          keys.push_back(entry.first);
+        return keys;
+      }
+
+      /// \brief Evict the least recently used tiles beyond the capacity.
+      /// The mutex must be locked.
+      /// \param[out] _evicted Keys of the evicted tiles are appended.
+      private: void Evict(std::vector<uint64_t> &_evicted)
+      {
+        while (this->entries.size() > this->capacity)
+        {
+          const uint64_t key = this->order.back().first;
+          this->entries.erase(key);
+          this->order.pop_back();
+          _evicted.push_back(key);
+        }
+      }
+
+      /// \brief Protects the cache.
+      private: mutable std::mutex mutex;
+
+      /// \brief Cached tiles, from the most to the least recently used.
+      private: std::list<std::pair<uint64_t, Tile>> order;
+
+      /// \brief Position of each cached tile in order.
+      private: std::unordered_map<uint64_t,
+        typename std::list<std::pair<uint64_t, Tile>>::iterator> entries;
+
+      /// \brief Maximum number of tiles.
+      private: std::size_t capacity;
+    };
+  }  // namespace detail
+  }  // namespace GZ_MATH_VERSION_NAMESPACE
+
+  /// \brief Session of a MappedTimeVaryingVolumetricGrid.
+  template<typename T>
+  class MappedTileSession
+  {
+    /// \brief Index of the time frame at or before the time of the session.
+    private: std::size_t frame{0};
+
+    /// \brief Time of last query
+    public: T time;
+
+    template<typename A, typename B, typename C, typename D>
+    friend class TimeVaryingVolumetricGrid;
+  };
+
+  /// \brief Specialization of TimeVaryingVolumetricGrid which reads its
+  /// data from a memory mapped volumetric grid file, see
+  /// VolumetricGridFileHeader and WriteVolumetricGridFile(). This is meant
+  /// for datasets that do not fit in memory.
+  ///
+  /// The values are split into tiles. A lookup only decodes the tiles of
+  /// the two time frames around the session time that hold the corners of
+  /// the queried cell, and keeps them in a least recently used cache of
+  /// bounded size. Files with float values, when V is float, or double
+  /// values, when V is double, are read in place without decoding.
+  ///
+  /// The operating system loads the pages of the file on demand. When the
+  /// session steps to a new time frame, the next frames are requested ahead
+  /// of time for the areas of the cached tiles, and evicted tiles are
+  /// released.
+  ///
+  /// Queries may run from several threads. Every frame shares the axes of
+  /// the file, and points are interpolated like
+  /// InMemoryTimeVaryingVolumetricGrid does, with missing values replaced
+  /// by zero.
+  template<typename T, typename V, typename P>
+  class TimeVaryingVolumetricGrid<T, V, MappedTileSession<T>, P>
+  {
+    /// \brief Constructor. Call Open() before querying the grid.
+    public: TimeVaryingVolumetricGrid() = default;
+
+    /// \brief Open a volumetric grid file, closing the current one if any.
+    /// \param[in] _path Path of the file.
+    /// \param[in] _cacheSize Maximum number of decoded tiles kept in memory.
+    /// A lookup needs up to 16 tiles, so use at least that.
+    /// \return True on success. Otherwise an error is logged.
+    public: bool Open(const std::string &_path, std::size_t _cacheSize = 256)
+    {
+      this->field.reset();
+      this->times.clear();
+      this->cache.reset();
+      if (!this->file.Open(_path))
+        return false;
+      if (!detail::ReadVolumetricGridHeader(
+            this->file.Data(), this->file.Size(), this->header))
+      {
+        this->file.Close();
+        return false;
+      }
+
+      std::array<std::vector<P>, 3> axes;
+      const uint8_t *data = this->file.Data() + this->header.axesOffset;
+      for (int i = 0; i < 3; ++i)
+      {
+        for (uint64_t j = 0; j < this->header.size[i]; ++j)
+        {
+          double position;
+          std::memcpy(&position, data, sizeof(position));
+          axes[i].push_back(static_cast<P>(position));
+          data += sizeof(position);
+        }
+      }
+      for (uint64_t j = 0; j < this->header.frames; ++j)
+      {
+        double time;
+        std::memcpy(&time, data, sizeof(time));
+        this->times.push_back(static_cast<T>(time));
+        data += sizeof(time);
+      }
+
+      this->field.emplace(axes[0], axes[1], axes[2]);
+      this->tileCounts = detail::VolumetricGridTileCounts(this->header);
+      this->tilesPerFrame =
+        this->tileCounts[0] * this->tileCounts[1] * this->tileCounts[2];
+      this->cache =
+        std::make_unique<detail::VolumetricGridTileCache<V>>(_cacheSize);
+      const auto encoding =
+        static_cast<VolumetricGridEncoding>(this->header.encoding);
+      this->inPlace =
+        (std::is_same_v<V, float> &&
+         encoding == VolumetricGridEncoding::FLOAT32) ||
+        (std::is_same_v<V, double> &&
+         encoding == VolumetricGridEncoding::FLOAT64);
+      return true;
+    }
+
+    /// \brief Check whether a file is open.
+    /// \return True if Open() succeeded.
+    public: bool IsOpen() const
+    {
+      return this->field.has_value();
+    }
+
+    /// \brief Set the maximum number of decoded tiles kept in memory.
+    /// \param[in] _cacheSize Maximum number of tiles, at least 1.
+    public: void SetCacheSize(std::size_t _cacheSize)
+    {
+      if (!this->cache)
+        return;
+      std::vector<uint64_t> evicted;
+      this->cache->SetCapacity(_cacheSize, evicted);
+      this->Release(evicted);
+    }
+
+    /// \brief Get the maximum number of decoded tiles kept in memory.
+    /// \return The size of the cache, 0 if no file is open.
+    public: std::size_t CacheSize() const
+    {
+      return this->cache ? this->cache->Capacity() : 0;
+    }
+
+    /// \brief Get the number of decoded tiles in memory.
+    /// \return The number of cached tiles.
+    public: std::size_t CachedTiles() const
+    {
+      return this->cache ? this->cache->Size() : 0;
+    }
+
+    /// \brief Documentation Inherited
+    public: MappedTileSession<T> CreateSession() const
+    {
+      MappedTileSession<T> session;
+      session.frame = 0;
+      session.time = T(0);
+      return session;
+    }
+
+    /// \brief Documentation Inherited
+    public: MappedTileSession<T> CreateSession(const T &_time) const
+    {
+      MappedTileSession<T> session;
+      session.frame = static_cast<std::size_t>(
+        std::lower_bound(this->times.begin(), this->times.end(), _time) -
+        this->times.begin());
+      session.time = _time;
+      return session;
+    }
+
+    /// \brief Documentation Inherited
+    public: bool IsValid(const MappedTileSession<T> &_session) const
+    {
+      return _session.frame < this->times.size();
+    }
+
+    /// \brief Documentation Inherited
+    public: std::optional<MappedTileSession<T>>
+      StepTo(const MappedTileSession<T> &_session, const T &_time) const
+    {
+      if (!this->IsValid(_session))
+        return std::nullopt;
+
+      if (_session.frame + 1 >= this->times.size() ||
+          _time < this->times[_session.frame])
+      {
+        return std::nullopt;
+      }
+
+      MappedTileSession<T> session(_session);
+      while (session.frame + 1 < this->times.size() &&
+             this->times[session.frame + 1] <= _time)
+      {
+        ++session.frame;
+      }
+      session.time = _time;
+
+      if (session.frame != _session.frame)
+        this->Prefetch(session.frame);
+      return session;
+    }
+
+    /// \brief Looks up a given point. If the point lies in between two time
+    /// frames then it performs spatio-temporal linear interpolation.
+    /// \param[in] _session The session with the time to look up.
+    /// \param[in] _pos The position to look up.
+    /// \param[in] _tol Tolerance along each axis to snap the position to
+    /// the grid.
+    /// \return nullopt if the data is out of range.
+    public: std::optional<V>
+      LookUp(const MappedTileSession<T> &_session,
+        const Vector3<P> &_pos,
+        const Vector3<P> &_tol = Vector3<P>{1e-6, 1e-6, 1e-6})
+      const
+    {
+      VolumetricGridLookupHint hint;
+      return this->LookUp(_session, hint, _pos, _tol);
+    }
+
+    /// \brief Looks up a given point, starting the search from the grid
+    /// cell of the previous lookup made with the same hint. Consecutive
+    /// lookups at nearby positions are faster. Every time frame shares the
+    /// same grid, so the hint stays useful after StepTo().
+    /// \param[in] _session The session with the time to look up.
+    /// \param[in,out] _hint Cell of the previous lookup, owned by the
+    /// caller and updated with the cell of this one. Use one per vehicle or
+    /// thread.
+    /// \param[in] _pos The position to look up.
+    /// \param[in] _tol Tolerance along each axis to snap the position to
+    /// the grid.
+    /// \return nullopt if the data is out of range.
+    public: std::optional<V>
+      LookUp(const MappedTileSession<T> &_session,
+        VolumetricGridLookupHint &_hint,
+        const Vector3<P> &_pos,
+        const Vector3<P> &_tol = Vector3<P>{1e-6, 1e-6, 1e-6}) const
+    {
+      if (!this->IsValid(_session))
+        return std::nullopt;
+
+      InterpolationCell3D<P> cell;
+      this->field->GetInterpolators(
+        _pos, cell, _hint, _tol.X(), _tol.Y(), _tol.Z());
+      if (cell.count == 0)
+        return std::nullopt;
+
+      const std::size_t frame = _session.frame;
+      const V value1 = this->Estimate(cell, frame, _pos);
+      if (frame + 1 >= this->times.size())
+        return value1;
+
+      const V value2 = this->Estimate(cell, frame + 1, _pos);
+      return detail::LinearInterpolateTime(
+        this->times[frame], value1, this->times[frame + 1], value2,
+        _session.time);
+    }
+
+    /// \brief Looks up many points at the time of a session, like calling
+    /// LookUp() on each of them in order.
+    /// \param[in] _session The session with the time to look up.
+    /// \param[in] _positions The positions to look up.
+    /// \param[out] _values The value of each position, nullopt if it is
+    /// out of range.
+    /// \param[in] _threads Number of threads to use, 0 for one per core.
+    public: void LookUp(const MappedTileSession<T> &_session,
+      const std::vector<Vector3<P>> &_positions,
+      std::vector<std::optional<V>> &_values,
+      unsigned int _threads = 1) const
+    {
+      _values.resize(_positions.size());
+      const unsigned int threads = detail::ThreadCount(
+        _threads, _positions.size());
+      detail::ParallelFor(_positions.size(), threads,
+        [&](std::size_t _begin, std::size_t _end, unsigned int)
+        {
+          VolumetricGridLookupHint hint;
+          for (std::size_t i = _begin; i < _end; ++i)
+            _values[i] = this->LookUp(_session, hint, _positions[i]);
+        });
+    }
+
+    /// \brief Get the bounds of this grid field.
+    /// \return A pair of vectors. All zeros if session is invalid.
+    public: std::pair<Vector3<P>, Vector3<P>> Bounds(
+      const MappedTileSession<T> &_session) const
+    {
+      if (!this->IsValid(_session))
+      {
+        return std::pair<Vector3<P>, Vector3<P>>(
+          Vector3<P>{0, 0, 0}, Vector3<P>{0, 0, 0});
+      }
+      return this->field->Bounds();
+    }
+
+    /// \brief Interpolate the points of a cell in one time frame.
+    /// \param[in] _cell The interpolation points.
+    /// \param[in] _frame Index of the time frame.
+    /// \param[in] _pos The position to interpolate.
+    /// \return The interpolated value.
+    private: V Estimate(const InterpolationCell3D<P> &_cell,
+                        std::size_t _frame, const Vector3<P> &_pos) const
+    {
+      const uint64_t nx = this->header.size[0];
+      const uint64_t ny = this->header.size[1];
+      const auto &tileSize = this->header.tileSize;
+
+      std::array<V, 8> values{};
+      uint64_t lastKey = ~uint64_t{0};
+      typename detail::VolumetricGridTileCache<V>::Tile tile;
+      for (std::size_t i = 0; i < _cell.count; ++i)
+      {
+        // Points of a dense grid always have an index.
+        const uint64_t index = _cell.points[i].index.value();
+        const uint64_t x = index % nx;
+        const uint64_t y = (index / nx) % ny;
+        const uint64_t z = index / (nx * ny);
+        const uint64_t tileId =
+          ((z / tileSize[2]) * this->tileCounts[1] + y / tileSize[1]) *
+          this->tileCounts[0] + x / tileSize[0];
+        const uint64_t key = _frame * this->tilesPerFrame + tileId;
+        if (key != lastKey)
+        {
+          tile = this->LoadTile(key);
+          lastKey = key;
+        }
+        const V value = tile.get()[
+          ((z % tileSize[2]) * tileSize[1] + y % tileSize[1]) * tileSize[0] +
+          x % tileSize[0]];
+        values[i] = std::isnan(value) ? V(0) : value;
+      }
+      return detail::InterpolateCell(_cell, values.data(), _pos).value();
+    }
+
+    /// \brief Get a decoded tile from the cache, decoding it if needed.
+    /// \param[in] _key Index of the tile in the file, counting from the
+    /// first tile of the first frame.
+    /// \return The tile.
+    private: typename detail::VolumetricGridTileCache<V>::Tile
+      LoadTile(uint64_t _key) const
+    {
+      auto tile = this->cache->Find(_key);
+      if (tile)
+        return tile;
+
+      const uint8_t *data = this->file.Data() + this->TileOffset(_key);
+      if (this->inPlace)
+      {
+        // Tiles are aligned, and point into the mapping, which outlives
+        // them, so they own nothing.
+        tile = typename detail::VolumetricGridTileCache<V>::Tile(
+          typename detail::VolumetricGridTileCache<V>::Tile(),
+          reinterpret_cast<const V *>(data));
+      }
+      else
+      {
+        const auto &tileSize = this->header.tileSize;
+        auto decoded = std::make_shared<std::vector<V>>(
+          std::size_t{tileSize[0]} * tileSize[1] * tileSize[2]);
+        detail::DecodeVolumetricGridValues(
+          data, this->header, decoded->size(), decoded->data());
+        tile = typename detail::VolumetricGridTileCache<V>::Tile(
+          decoded, decoded->data());
+      }
+
+      // Tiles read in place are cached too, so that they are prefetched
+      // and released like decoded ones.
+      std::vector<uint64_t> evicted;
+      tile = this->cache->Insert(_key, std::move(tile), evicted);
+      this->Release(evicted);
+      return tile;
+    }
+
+    /// \brief Get the offset of a tile in the file.
+    /// \param[in] _key Index of the tile in the file.
+    /// \return Offset of the tile in bytes.
+    private: uint64_t TileOffset(uint64_t _key) const
+    {
+      return this->header.valuesOffset +
+        (_key / this->tilesPerFrame) * this->header.frameStride +
+        (_key % this->tilesPerFrame) * this->header.tileStride;
+    }
+
+    /// \brief Ask the operating system to load the tiles of the time
+    /// frames that follow a frame, in the areas of the cached tiles.
+    /// \param[in] _frame Index of the new time frame of a session.
+    private: void Prefetch(std::size_t _frame) const
+    {
+      std::vector<uint64_t> tileIds;
+      for (const uint64_t key : this->cache->Keys())
+        tileIds.push_back(key % this->tilesPerFrame);
+      std::sort(tileIds.begin(), tileIds.end());
+      tileIds.erase(
+        std::unique(tileIds.begin(), tileIds.end()), tileIds.end());
+
+      for (std::size_t frame = _frame + 1;
+           frame <= _frame + 2 && frame < this->times.size(); ++frame)
+      {
+        for (const uint64_t tileId : tileIds)
+        {
+          const uint64_t key = frame * this->tilesPerFrame + tileId;
+          if (!this->cache->Contains(key))
+          {
+            this->file.Prefetch(
+              this->TileOffset(key), this->header.tileStride);
+          }
+        }
+      }
+    }
+
+    /// \brief Let the operating system reclaim the pages of evicted tiles.
+    /// \param[in] _keys Indices of the evicted tiles.
+    private: void Release(const std::vector<uint64_t> &_keys) const
+    {
+      for (const uint64_t key : _keys)
+        this->file.Release(this->TileOffset(key), this->header.tileStride);
+    }
+
+    /// \brief The memory mapped file.
+    private: MappedFile file;
+
+    /// \brief Header of the file.
+    private: VolumetricGridFileHeader header{};
+
+    /// \brief Time of each frame.
+    private: std::vector<T> times;
+
+    /// \brief Lookup table of the grid shared by every frame.
+    private: std::optional<VolumetricGridLookupField<P>> field;
+
+    /// \brief Number of tiles along each axis.
+    private: std::array<uint64_t, 3> tileCounts{{0, 0, 0}};
+
+    /// \brief Number of tiles in a frame.
+    private: uint64_t tilesPerFrame{0};
+
+    /// \brief Decoded tiles.
+    private: std::unique_ptr<detail::VolumetricGridTileCache<V>> cache;
+
+    /// \brief True if the values of the file are read without decoding.
+    private: bool inPlace{false};
+  };
+
+  /// \brief Alias for the specialization of TimeVaryingVolumetricGrid which
+  /// streams its data from a memory mapped file.
+  template<typename T, typename V = T, typename P = T>
+  using MappedTimeVaryingVolumetricGrid =
+    TimeVaryingVolumetricGrid<T, V, MappedTileSession<T>, P>;
+}  // namespace gz::math
+#endif  // GZ_MATH_MAPPED_TIME_VARYING_VOLUMETRIC_GRID_HH_
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include <gz/math/Helpers.hh>
+#include <gz/math/Vector2.hh>
 #include <gz/utils/ImplPtr.hh>
 
 namespace gz::math
@@ -39,6 +40,48 @@ enum class OccupancyCellState
   Unknown
 };
 
+/// \enum OccupancyLogOddsPrecision
+/// \brief Storage used for each cell in the log-odds mode of OccupancyGrid.
+enum class OccupancyLogOddsPrecision
+{
+  /// \brief One signed byte per cell.
+  Int8,
+  /// \brief Two signed bytes per cell.
+  Int16
+};
+
+/// \brief Parameters of the log-odds mode of OccupancyGrid. All the values
+/// are in log-odds units, log(p / (1 - p)), where p is the probability of
+/// the cell being occupied. Cells start at 0 (p = 0.5).
+struct OccupancyLogOddsParams
+{
+  /// \brief Added to a cell each time it is observed as occupied. Must be
+  /// positive.
+  double hit{0.85};
+
+  /// \brief Added to a cell each time it is observed as free. Must be
+  /// negative.
+  double miss{-0.4};
+
+  /// \brief Lower clamping bound. Must be negative.
+  double min{-2.0};
+
+  /// \brief Upper clamping bound. Must be positive.
+  double max{3.5};
+
+  /// \brief Cells above this value are reported as Occupied.
+  double occupiedThreshold{0.5};
+
+  /// \brief Cells below this value are reported as Free. Cells between
+  /// both thresholds are reported as Unknown.
+  double freeThreshold{-0.2};
+
+  /// \brief Storage of each cell. The range [min, max] is mapped to the
+  /// full range of the integer type, so Int8 halves the memory at the cost
+  /// of coarser increments.
+  OccupancyLogOddsPrecision precision{OccupancyLogOddsPrecision::Int16};
+};
+
   /// \class OccupancyGrid OccupancyGrid.hh gz/math/OccupancyGrid.hh
   /// \brief Class representing an occupancy grid.
 class GZ_MATH_VISIBLE OccupancyGrid
@@ -103,6 +146,9 @@ class GZ_MATH_VISIBLE OccupancyGrid
   /// \brief Use Bresenham's Line Algorithm to mark cells along a line. This
   /// function will not modify cells that are already marked as Occupied.
   /// It marks cells from (_x0, _y0) to (_x1, _y1) with the specified state.
+  /// In log-odds mode every cell of the line is updated instead: Free adds
+  /// the miss increment, Occupied adds the hit increment and Unknown resets
+  /// the cell to 0.
   /// \param[in] _x0 X coordinate of the start point in cells.
   /// \param[in] _y0 Y coordinate of the start point in cells.
   /// \param[in] _x1 X coordinate of the end point in cells.
@@ -112,7 +158,7 @@ class GZ_MATH_VISIBLE OccupancyGrid
     OccupancyCellState _state);
 
   /// \brief Mark a single point as occupied (e.g., an obstacle
-  /// detection).
+  /// detection). In log-odds mode this adds the hit increment to the cell.
   /// \param[in] _worldX World X coordinate in meters.
   /// \param[in] _worldY World Y coordinate in meters.
   /// \returns true if the grid was inside the coordinates, false otherwise
@@ -127,6 +173,156 @@ class GZ_MATH_VISIBLE OccupancyGrid
   public: bool MarkFree(double _worldX0, double _worldY0, double _worldX1,
                         double _worldY1);
 
+  /// \brief Insert a range sensor scan. Every ray from the origin to one
+  /// of the endpoints marks the cells it crosses as free, and every
+  /// endpoint inside the grid is marked as occupied. Cells that are
+  /// already occupied are not cleared. The result does not depend on the
+  /// order of the endpoints: a cell that is the endpoint of one ray and is
+  /// crossed by another one ends up occupied. This is faster than calling
+  /// MarkFree() and MarkOccupied() for each ray because cells shared by
+  /// several rays are only updated once, and the rays can be traced in
+  /// parallel. In log-odds mode, each cell crossed by the scan receives the
+  /// miss increment once and each endpoint receives the hit increment once,
+  /// regardless of the number of rays that touch it, and occupied cells are
+  /// updated as well.
+  /// \param[in] _originX World X coordinate of the sensor in meters.
+  /// \param[in] _originY World Y coordinate of the sensor in meters.
+  /// \param[in] _endpoints World coordinates of the ray endpoints in meters.
+  /// \param[in] _threads Number of threads used to trace the rays. A value
+  /// of 0 uses the number of concurrent threads supported by the hardware.
+  /// \returns true if the origin was inside the grid, false otherwise.
+  public: bool InsertScan(double _originX, double _originY,
+                          const std::vector<Vector2d> &_endpoints,
+                          unsigned int _threads = 1);
+
+  /// \brief Switch the grid to the probabilistic log-odds mode, or change
+  /// its parameters if it is already enabled. Each cell then accumulates
+  /// hits and misses as saturating fixed point log-odds, and CellState(),
+  /// RawOccupancy() and ExportToRGBImage() report the cells thresholded
+  /// with the given parameters. Known cells are converted to a single hit
+  /// or miss observation. Setting a cell with CellState() forces it to the
+  /// corresponding clamping bound, or to 0 for Unknown.
+  /// \param[in] _params Log-odds parameters.
+  /// \return True on success, false if the parameters are inconsistent.
+  public: bool EnableLogOdds(
+              const OccupancyLogOddsParams &_params = OccupancyLogOddsParams());
+
+  /// \brief Check whether the grid is in log-odds mode.
+  /// \return True if EnableLogOdds() was called successfully.
+  public: bool LogOddsEnabled() const;
+
+  /// \brief Get the log-odds parameters.
+  /// \return The parameters used in log-odds mode.
+  public: OccupancyLogOddsParams LogOddsParams() const;
+
+  /// \brief Get the log-odds of a cell, after fixed point quantization.
+  /// \param[in] _gridX Grid X coordinate in cells.
+  /// \param[in] _gridY Grid Y coordinate in cells.
+  /// \return The log-odds of the cell, or 0 if the coordinates are invalid
+  /// or the grid is not in log-odds mode.
+  public: double LogOdds(int _gridX, int _gridY) const;
+
+  /// \brief Find the frontier cells, which are the free cells with at
+  /// least one unknown 4-connected neighbor. Frontiers are the usual
+  /// candidates for the next viewpoint of an exploration planner.
+  /// \param[out] _cells Grid coordinates of the frontier cells, in
+  /// row-major order.
+  public: void Frontiers(std::vector<Vector2i> &_cells) const;
+
+  /// \brief Enable an information gain map, which stores for every cell the
+  /// number of unknown cells visible from it within a radius. A cell is
+  /// visible if the cells before it on the Bresenham line that
+  /// CalculateIGain traces from the viewpoint to it are inside the grid and
+  /// not occupied. Each cell is tested on its own line, so unlike summing
+  /// CalculateIGain over a fan of rays, no cell is counted twice. Later
+  /// changes to the grid only invalidate the tiles they touch, and
+  /// UpdateInformationGainMap() recomputes the map around those tiles.
+  /// \param[in] _radiusCells Visibility radius in cells, or 0 to disable
+  /// the map and release its memory.
+  /// \param[in] _threads Number of threads used to compute the map. 0 uses
+  /// the number of hardware threads.
+  /// \return True on success, false if the radius is negative.
+  public: bool EnableInformationGainMap(int _radiusCells,
+                                        unsigned int _threads = 1);
+
+  /// \brief Get the radius of the information gain map.
+  /// \return The visibility radius in cells, or 0 if the map is disabled.
+  public: int InformationGainRadius() const;
+
+  /// \brief Bring the information gain map up to date with the changes
+  /// made to the grid since the last update. Only viewpoints within the
+  /// radius of a changed tile are recomputed. Call it after changing the
+  /// grid and before querying InformationGain().
+  /// \param[in] _threads Number of threads. 0 uses the number of hardware
+  /// threads.
+  public: void UpdateInformationGainMap(unsigned int _threads = 1);
+
+  /// \brief Get the information gain of a viewpoint from the information
+  /// gain map. Changes made to the grid since the map was enabled or last
+  /// updated are not reflected until UpdateInformationGainMap() is called.
+  /// \param[in] _gridX Grid X coordinate of the viewpoint in cells.
+  /// \param[in] _gridY Grid Y coordinate of the viewpoint in cells.
+  /// \return The number of unknown cells visible from the viewpoint, or 0
+  /// if the coordinates are invalid or the map is disabled.
+  public: int InformationGain(int _gridX, int _gridY) const;
+
+  /// \brief Compute the Euclidean distance from every cell to the nearest
+  /// occupied cell, in linear time. After this call, changes to the grid
+  /// are tracked so that UpdateDistanceField() can refresh the field
+  /// incrementally.
+  /// \param[in] _threads Number of threads used for the row and column
+  /// passes. 0 uses the number of hardware threads.
+  public: void ComputeDistanceField(unsigned int _threads = 1);
+
+  /// \brief Update the distance field around the cells that became or
+  /// stopped being occupied since the last update. The cost depends on the
+  /// area whose nearest obstacle changed rather than on the grid size. If
+  /// the field was never computed, this computes it from scratch.
+  public: void UpdateDistanceField();
+
+  /// \brief Get the distance field, as of the last call to
+  /// ComputeDistanceField() or UpdateDistanceField().
+  /// \param[out] _distances Distance of each cell to the nearest occupied
+  /// cell in meters, in row-major order, so that the distance of cell
+  /// (x, y), centered at GridToWorld(x, y), is at index y * Width() + x.
+  /// Occupied cells are at distance 0 and cells of a grid without
+  /// obstacles are at infinite distance. Empty if the field was never
+  /// computed.
+  public: void DistanceField(std::vector<float> &_distances) const;
+
+  /// \brief Get the distance from a cell to the nearest occupied cell, as
+  /// of the last call to ComputeDistanceField() or UpdateDistanceField().
+  /// \param[in] _gridX Grid X coordinate in cells.
+  /// \param[in] _gridY Grid Y coordinate in cells.
+  /// \return The distance in meters, infinity if there are no obstacles,
+  /// or -1 if the coordinates are invalid or the field was never computed.
+  public: double Distance(int _gridX, int _gridY) const;
+
+  /// \brief Cost of occupied cells in InflationCosts().
+  public: static constexpr uint8_t kLethalCost = 254;
+
+  /// \brief Cost of the cells within the inscribed radius of an obstacle in
+  /// InflationCosts().
+  public: static constexpr uint8_t kInscribedCost = 253;
+
+  /// \brief Compute an inflated costmap from the distance field. Occupied
+  /// cells get kLethalCost, cells closer than _inscribedRadius get
+  /// kInscribedCost, and cells up to _inflationRadius get a cost decaying
+  /// as (kInscribedCost - 1) * exp(-_costScalingFactor * (d -
+  /// _inscribedRadius)). Other cells get 0.
+  /// \param[in] _inscribedRadius Inscribed radius of the robot in meters.
+  /// \param[in] _inflationRadius Distance in meters up to which costs are
+  /// inflated.
+  /// \param[in] _costScalingFactor Decay rate of the cost in 1/meters.
+  /// \param[out] _costs Cost of each cell, in the same order as
+  /// DistanceField().
+  /// \return True on success, false if the distance field was never
+  /// computed or the parameters are inconsistent.
+  public: bool InflationCosts(double _inscribedRadius,
+                              double _inflationRadius,
+                              double _costScalingFactor,
+                              std::vector<uint8_t> &_costs) const;
+
   /// \brief Export the occupancy grid to a RGB image buffer.
   /// \param[out] _pixels The output buffer to store the RGB image data.
   public: void ExportToRGBImage(std::vector<uint8_t> &_pixels) const;
@@ -18,6 +18,10 @@
 #define GZ_MATH_PIECEWISE_SCALAR_FIELD3_HH_
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <sstream>
 #include <utility>
@@ -27,6 +31,7 @@
 #include <gz/math/Vector3.hh>
 #include <gz/math/config.hh>
 #include <gz/math/detail/Error.hh>
+#include <gz/math/detail/ParallelFor.hh>
 
 namespace gz::math
 {
@@ -52,6 +57,10 @@ namespace gz::math
   /// \tparam ScalarT a numeric type for which std::numeric_limits<> traits
   ///   have been specialized.
   ///
+  /// Pieces are indexed by a bounding volume hierarchy over their regions,
+  /// built on construction, so evaluation takes logarithmic time in the
+  /// number of pieces.
+  ///
   /// ## Example
   ///
   /// \snippet examples/piecewise_scalar_field3_example.cc complete
@@ -74,6 +83,9 @@ namespace gz::math
     public: explicit PiecewiseScalarField3(const std::vector<Piece> &_pieces)
     : pieces(_pieces)
     {
+      this->BuildTree();
+
+      std::vector<std::size_t> overlaps;
       for (size_t i = 0; i < pieces.size(); ++i)
       {
         if (pieces[i].region.Empty())
@@ -82,20 +94,20 @@ namespace gz::math
           errStream << "Region #" << i << " (" << pieces[i].region
                     << ") in piecewise scalar field definition is empty.";
           detail::LogErrorMessage(errStream.str());
+          continue;
         }
-        for (size_t j = i + 1; j < pieces.size(); ++j)
+        this->FindOverlaps(i, overlaps);
+        this->overlapping = this->overlapping || !overlaps.empty();
+        for (const size_t j : overlaps)
         {
-          if (pieces[i].region.Intersects(pieces[j].region))
-          {
-            std::ostringstream errStream;
-            errStream << "Detected overlap between regions in "
-                      << "piecewise scalar field definition: "
-                      << "region #" << i << " (" << pieces[i].region
-                      << ") overlaps with region #" << j << " ("
-                      << pieces[j].region << "). Region #" << i
-                      << " will take precedence when overlapping.";
-            detail::LogErrorMessage(errStream.str());
-          }
+          std::ostringstream errStream;
+          errStream << "Detected overlap between regions in "
+                    << "piecewise scalar field definition: "
+                    << "region #" << i << " (" << pieces[i].region
+                    << ") overlaps with region #" << j << " ("
+                    << pieces[j].region << "). Region #" << i
+                    << " will take precedence when overlapping.";
+          detail::LogErrorMessage(errStream.str());
         }
       }
     }
@@ -115,17 +127,47 @@ namespace gz::math
     ///   if the scalar field is not defined at `_p`
     public: ScalarT Evaluate(const Vector3<ScalarT> &_p) const
     {
-      auto it = std::find_if(
-          this->pieces.begin(), this->pieces.end(),
-          [&](const Piece &piece)
-          {
-            return piece.region.Contains(_p);
-          });
-      if (it == this->pieces.end())
+      const std::size_t index = this->Find(_p);
+      if (index == kNoPiece)
       {
         return std::numeric_limits<ScalarT>::quiet_NaN();
       }
-      return it->field(_p);
+      return this->pieces[index].field(_p);
+    }
+
+    /// \brief Evaluate the piecewise scalar field at many points. This is
+    /// faster than calling Evaluate() on each point, in particular when
+    /// consecutive points often fall in the same region.
+    /// \param[in] _points piecewise scalar field arguments
+    /// \param[out] _values the result of evaluating `F` at each point, or
+    ///   NaN if the scalar field is not defined there
+    /// \param[in] _threads number of threads to use, 0 for one per core
+    public: void Evaluate(const std::vector<Vector3<ScalarT>> &_points,
+                          std::vector<ScalarT> &_values,
+                          unsigned int _threads = 1) const
+    {
+      _values.resize(_points.size());
+      const unsigned int threads = detail::ThreadCount(
+        _threads, _points.size());
+      detail::ParallelFor(_points.size(), threads,
+        [&](std::size_t _begin, std::size_t _end, unsigned int)
+        {
+          std::size_t last = kNoPiece;
+          for (std::size_t i = _begin; i < _end; ++i)
+          {
+            const Vector3<ScalarT> &p = _points[i];
+            // Without overlaps, a region containing the point is the only
+            // one, so the region of the previous point can be tried first.
+            if (last == kNoPiece || this->overlapping ||
+                !this->pieces[last].region.Contains(p))
+            {
+              last = this->Find(p);
+            }
+            _values[i] = last == kNoPiece ?
+              std::numeric_limits<ScalarT>::quiet_NaN() :
+              this->pieces[last].field(p);
+          }
+        });
     }
 
     /// \brief Call operator overload
@@ -205,8 +247,247 @@ namespace gz::math
                   << _field.pieces.back().region;
     }
 
+    /// \brief Node of the bounding volume hierarchy over the pieces.
+    private: struct Node
+    {
+      /// \brief Lower corner of the box bounding the regions of the node.
+      std::array<ScalarT, 3> min;
+
+      /// \brief Upper corner of the box bounding the regions of the node.
+      std::array<ScalarT, 3> max;
+
+      /// \brief Lowest index of the pieces in the node.
+      std::size_t minPiece;
+
+      /// \brief For leaves, first position of their pieces in `order`.
+      /// For inner nodes, position of the second child in `nodes`; the
+      /// first child follows the node.
+      std::size_t first;
+
+      /// \brief Number of pieces of a leaf, 0 for inner nodes.
+      std::size_t count;
+    };
+
+    /// \brief Index returned by Find() when no piece contains a point.
+    private: static constexpr std::size_t kNoPiece =
+      std::numeric_limits<std::size_t>::max();
+
+    /// \brief Maximum number of pieces in a leaf.
+    private: static constexpr std::size_t kLeafSize = 4;
+
+    /// \brief Maximum depth of the hierarchy, which bounds the stack of
+    /// the traversals.
+    private: static constexpr std::size_t kMaxDepth = 64;
+
+    /// \brief Build the bounding volume hierarchy over the non empty
+    /// regions, splitting their centers at the median along the axis of
+    /// largest spread.
+    private: void BuildTree()
+    {
+      this->order.clear();
+      this->nodes.clear();
+      for (std::size_t i = 0; i < this->pieces.size(); ++i)
+      {
+        if (!this->pieces[i].region.Empty())
+          this->order.push_back(i);
+      }
+      if (!this->order.empty())
+        this->BuildNode(0, this->order.size(), 0);
+    }
+
+    /// \brief Build a node of the hierarchy and its children.
+    /// \param[in] _begin first position in `order` of the pieces
+    /// \param[in] _end position in `order` past the last piece
+    /// \param[in] _depth depth of the node
+    private: void BuildNode(std::size_t _begin, std::size_t _end,
+                            std::size_t _depth)
+    {
+      const std::size_t index = this->nodes.size();
+      this->nodes.emplace_back();
+      Node node;
+      node.min.fill(std::numeric_limits<ScalarT>::infinity());
+      node.max.fill(-std::numeric_limits<ScalarT>::infinity());
+      node.minPiece = kNoPiece;
+      std::array<ScalarT, 3> centerMin = node.min;
+      std::array<ScalarT, 3> centerMax = node.max;
+      for (std::size_t k = _begin; k < _end; ++k)
+      {
+        const std::size_t i = this->order[k];
+        node.minPiece = std::min(node.minPiece, i);
+        const Region3<ScalarT> &region = this->pieces[i].region;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+          const Interval<ScalarT> &interval = Axis(region, axis);
+          node.min[axis] = std::min(node.min[axis], interval.LeftValue());
+          node.max[axis] = std::max(node.max[axis], interval.RightValue());
+          const ScalarT center = Center(interval);
+          centerMin[axis] = std::min(centerMin[axis], center);
+          centerMax[axis] = std::max(centerMax[axis], center);
+        }
+      }
+
+      int axis = 0;
+      for (int a = 1; a < 3; ++a)
+      {
+        if (centerMax[a] - centerMin[a] > centerMax[axis] - centerMin[axis])
+          axis = a;
+      }
+
+      if (_end - _begin <= kLeafSize || _depth + 1 >= kMaxDepth ||
+          !(centerMax[axis] > centerMin[axis]))
+      {
+        node.first = _begin;
+        node.count = _end - _begin;
+        this->nodes[index] = node;
+        return;
+      }
+
+      const std::size_t middle = _begin + (_end - _begin) / 2;
+      std::nth_element(
+        this->order.begin() + static_cast<std::ptrdiff_t>(_begin),
+        this->order.begin() + static_cast<std::ptrdiff_t>(middle),
+        this->order.begin() + static_cast<std::ptrdiff_t>(_end),
+        [&](std::size_t _a, std::size_t _b)
+        {
+          return Center(Axis(this->pieces[_a].region, axis)) <
+                 Center(Axis(this->pieces[_b].region, axis));
+        });
+      node.count = 0;
+      this->BuildNode(_begin, middle, _depth + 1);
+      node.first = this->nodes.size();
+      this->BuildNode(middle, _end, _depth + 1);
+      this->nodes[index] = node;
+    }
+
+    /// \brief Find the first piece whose region contains a point.
+    /// \param[in] _p the point
+    /// \return index of the piece, or kNoPiece if there is none
+    private: std::size_t Find(const Vector3<ScalarT> &_p) const
+    {
+      std::size_t best = kNoPiece;
+      if (this->nodes.empty())
+        return best;
+
+      std::array<std::size_t, kMaxDepth> stack;
+      std::size_t size = 0;
+      stack[size++] = 0;
+      while (size > 0)
+      {
+        const std::size_t index = stack[--size];
+        const Node &node = this->nodes[index];
+        // Earlier pieces take precedence, so nodes with later ones only
+        // can be skipped.
+        if (node.minPiece >= best ||
+            !(node.min[0] <= _p.X() && _p.X() <= node.max[0] &&
+              node.min[1] <= _p.Y() && _p.Y() <= node.max[1] &&
+              node.min[2] <= _p.Z() && _p.Z() <= node.max[2]))
+        {
+          continue;
+        }
+        if (node.count > 0)
+        {
+          for (std::size_t k = node.first; k < node.first + node.count; ++k)
+          {
+            const std::size_t i = this->order[k];
+            if (i < best && this->pieces[i].region.Contains(_p))
+              best = i;
+          }
+        }
+        else
+        {
+          stack[size++] = node.first;
+          stack[size++] = index + 1;
+        }
+      }
+      return best;
+    }
+
+    /// \brief Find the pieces after a given one whose regions intersect
+    /// its region.
+    /// \param[in] _piece index of the piece
+    /// \param[out] _overlaps indices of the intersecting pieces, sorted
+    private: void FindOverlaps(std::size_t _piece,
+                               std::vector<std::size_t> &_overlaps) const
+    {
+      _overlaps.clear();
+      const Region3<ScalarT> &region = this->pieces[_piece].region;
+      std::array<std::size_t, kMaxDepth> stack;
+      std::size_t size = 0;
+      if (!this->nodes.empty())
+        stack[size++] = 0;
+      while (size > 0)
+      {
+        const std::size_t index = stack[--size];
+        const Node &node = this->nodes[index];
+        bool disjoint = false;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+          const Interval<ScalarT> &interval = Axis(region, axis);
+          disjoint = disjoint ||
+            interval.RightValue() < node.min[axis] ||
+            node.max[axis] < interval.LeftValue();
+        }
+        if (disjoint)
+          continue;
+        if (node.count > 0)
+        {
+          for (std::size_t k = node.first; k < node.first + node.count; ++k)
+          {
+            const std::size_t j = this->order[k];
+            if (j > _piece && region.Intersects(this->pieces[j].region))
+              _overlaps.push_back(j);
+          }
+        }
+        else
+        {
+          stack[size++] = node.first;
+          stack[size++] = index + 1;
+        }
+      }
+      std::sort(_overlaps.begin(), _overlaps.end());
+    }
+
+    /// \brief Get the interval of a region along an axis.
+    /// \param[in] _region the region
+    /// \param[in] _axis 0 for x, 1 for y, 2 for z
+    /// \return the interval
+    private: static const Interval<ScalarT> &Axis(
+      const Region3<ScalarT> &_region, int _axis)
+    {
+      return _axis == 0 ? _region.Ix() :
+             _axis == 1 ? _region.Iy() : _region.Iz();
+    }
+
+    /// \brief Get a representative center of an interval, which is finite
+    /// even for unbounded intervals.
+    /// \param[in] _interval the interval
+    /// \return the center
+    private: static ScalarT Center(const Interval<ScalarT> &_interval)
+    {
+      const bool leftFinite = std::isfinite(_interval.LeftValue());
+      const bool rightFinite = std::isfinite(_interval.RightValue());
+      if (leftFinite && rightFinite)
+        return (_interval.LeftValue() + _interval.RightValue()) / 2;
+      if (leftFinite)
+        return _interval.LeftValue();
+      if (rightFinite)
+        return _interval.RightValue();
+      return ScalarT(0);
+    }
+
     /// \brief Scalar fields Pn and the regions Rn in which these are defined
     private: std::vector<Piece> pieces;
+
+    /// \brief Nodes of the bounding volume hierarchy over the pieces, the
+    /// root first.
+    private: std::vector<Node> nodes;
+
+    /// \brief Indices of the pieces with non empty regions, grouped by
+    /// leaf.
+    private: std::vector<std::size_t> order;
+
+    /// \brief True if some regions overlap.
+    private: bool overlapping{false};
   };
 
   template<typename ScalarField3T>
@@ -19,9 +19,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <gz/math/Interval.hh>
 #include <gz/math/Vector4.hh>
@@ -100,6 +102,72 @@ namespace gz::math
               this->coeffs[2] * _x + this->coeffs[3]);
     }
 
+    /// \brief Evaluate the polynomial at `_count` arguments stored
+    /// contiguously. Results are the same as those of calling Evaluate()
+    /// on each argument, but finite arguments are processed in blocks that
+    /// compilers can map onto SIMD lanes.
+    /// \param[in] _x polynomial arguments
+    /// \param[out] _y the result of evaluating p at each argument.
+    ///   It may be the same array as `_x`.
+    /// \param[in] _count number of arguments
+    public: void Evaluate(const T *_x, T *_y, std::size_t _count) const
+    {
+      // Number of arguments evaluated together. Loops over a block have
+      // a constant trip count and no branches, so they vectorize.
+      constexpr std::size_t kBlock = 8;
+
+      using std::isfinite;
+      const T c0 = this->coeffs[0];
+      const T c1 = this->coeffs[1];
+      const T c2 = this->coeffs[2];
+      const T c3 = this->coeffs[3];
+      std::size_t i = 0;
+      for (; i + kBlock <= _count; i += kBlock)
+      {
+        T x[kBlock];
+        T y[kBlock];
+        // x - x is zero for finite x and NaN otherwise.
+        T finite = T(0);
+        for (std::size_t j = 0; j < kBlock; ++j)
+        {
+          x[j] = _x[i + j];
+          const T x2 = x[j] * x[j];
+          const T x3 = x2 * x[j];
+          y[j] = c0 * x3 + c1 * x2 + c2 * x[j] + c3;
+          finite += x[j] - x[j];
+        }
+        for (std::size_t j = 0; j < kBlock; ++j)
+        {
+          _y[i + j] = y[j];
+        }
+        if (!isfinite(finite))
+        {
+          // Non-finite arguments take the limit logic of Evaluate().
+          for (std::size_t j = 0; j < kBlock; ++j)
+          {
+            if (!isfinite(x[j]))
+            {
+              _y[i + j] = this->Evaluate(x[j]);
+            }
+          }
+        }
+      }
+      for (; i < _count; ++i)
+      {
+        _y[i] = this->Evaluate(_x[i]);
+      }
+    }
+
+    /// \brief Evaluate the polynomial at many arguments
+    /// \see Polynomial3::Evaluate(const T *, T *, std::size_t)
+    /// \param[in] _x polynomial arguments
+    /// \param[out] _y the result of evaluating p at each argument
+    public: void Evaluate(const std::vector<T> &_x, std::vector<T> &_y) const
+    {
+      _y.resize(_x.size());
+      this->Evaluate(_x.data(), _y.data(), _x.size());
+    }
+
     /// \brief Call operator overload
     /// \see Polynomial3::Evaluate()
     public: T operator()(const T &_x) const
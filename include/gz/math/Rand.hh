@@ -19,9 +19,11 @@
 
 #include <random>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <gz/math/Helpers.hh>
 #include <gz/math/config.hh>
+#include <gz/utils/ImplPtr.hh>
 
 namespace gz::math
 {
@@ -41,8 +43,124 @@ namespace gz::math
   /// \brief std::uniform_int<int>
   typedef std::uniform_int_distribution<int32_t> UniformIntDist;
 
+  /// \class RandStream Rand.hh gz/math/Rand.hh
+  /// \brief A random number stream with its own generator and
+  /// distributions, for use by a single thread at a time. Unlike the
+  /// static functions of Rand, it needs no locking and does not create a
+  /// distribution per call.
+  ///
+  /// Streams are seeded from a seed and a stream index, so that several
+  /// streams with the same seed, e.g. one per sensor or per thread, are
+  /// reproducible and do not overlap in practice.
+  class GZ_MATH_VISIBLE RandStream
+  {
+    /// \brief Constructor, seeded from Rand::Seed().
+    /// \param[in] _stream Stream index.
+    public: explicit RandStream(uint64_t _stream = 0);
+
+    /// \brief Constructor.
+    /// \param[in] _seed Seed shared by all streams.
+    /// \param[in] _stream Stream index.
+    public: RandStream(unsigned int _seed, uint64_t _stream);
+
+    /// \brief Reset the stream.
+    /// \param[in] _seed Seed shared by all streams.
+    /// \param[in] _stream Stream index.
+    public: void Seed(unsigned int _seed, uint64_t _stream);
+
+    /// \brief Get the seed of the stream.
+    /// \return The seed shared by all streams.
+    public: unsigned int Seed() const;
+
+    /// \brief Get the index of the stream.
+    /// \return The stream index.
+    public: uint64_t Stream() const;
+
+    /// \brief Get a double from a uniform distribution
+    /// \param[in] _min Minimum bound for the random number
+    /// \param[in] _max Maximum bound for the random number
+    public: double DblUniform(double _min = 0, double _max = 1);
+
+    /// \brief Get a double from a normal distribution
+    /// \param[in] _mean Mean value for the distribution
+    /// \param[in] _sigma Sigma value for the distribution
+    public: double DblNormal(double _mean = 0, double _sigma = 1);
+
+    /// \brief Get an integer from a uniform distribution
+    /// \param[in] _min Minimum bound for the random number
+    /// \param[in] _max Maximum bound for the random number
+    public: int32_t IntUniform(int _min, int _max);
+
+    /// \brief Get an integer from a normal distribution
+    /// \param[in] _mean Mean value for the distribution
+    /// \param[in] _sigma Sigma value for the distribution
+    public: int32_t IntNormal(int _mean, int _sigma);
+
+    /// \brief Get the generator of the stream, e.g. for other
+    /// distributions.
+    /// \return The random generator.
+    public: GeneratorType &Generator();
+
+    /// \brief Fill a buffer with numbers from a uniform distribution.
+    ///
+    /// Bulk fills draw from a Philox4x32-10 counter-based generator keyed
+    /// by the seed and the stream index, rather than from Generator(). The
+    /// values only depend on the seed, the stream index and the amount of
+    /// numbers drawn by previous fills, not on the number of threads.
+    /// Consecutive fills continue the sequence, and Seed() restarts it.
+    /// \param[out] _values Buffer to fill.
+    /// \param[in] _count Number of values.
+    /// \param[in] _min Minimum bound for the random numbers
+    /// \param[in] _max Maximum bound for the random numbers
+    /// \param[in] _threads Number of threads to use, 0 for one per core.
+    public: void FillUniform(double *_values, std::size_t _count,
+                             double _min = 0, double _max = 1,
+                             unsigned int _threads = 1);
+
+    /// \brief Fill a buffer with numbers from a uniform distribution, in
+    /// single precision.
+    /// \sa FillUniform(double *, std::size_t, double, double, unsigned int)
+    /// \param[out] _values Buffer to fill.
+    /// \param[in] _count Number of values.
+    /// \param[in] _min Minimum bound for the random numbers
+    /// \param[in] _max Maximum bound for the random numbers
+    /// \param[in] _threads Number of threads to use, 0 for one per core.
+    public: void FillUniform(float *_values, std::size_t _count,
+                             float _min = 0, float _max = 1,
+                             unsigned int _threads = 1);
+
+    /// \brief Fill a buffer with numbers from a normal distribution, with
+    /// the Box-Muller transform.
+    /// \sa FillUniform(double *, std::size_t, double, double, unsigned int)
+    /// \param[out] _values Buffer to fill.
+    /// \param[in] _count Number of values.
+    /// \param[in] _mean Mean value for the distribution
+    /// \param[in] _sigma Sigma value for the distribution
+    /// \param[in] _threads Number of threads to use, 0 for one per core.
+    public: void FillNormal(double *_values, std::size_t _count,
+                            double _mean = 0, double _sigma = 1,
+                            unsigned int _threads = 1);
+
+    /// \brief Fill a buffer with numbers from a normal distribution, in
+    /// single precision.
+    /// \sa FillNormal(double *, std::size_t, double, double, unsigned int)
+    /// \param[out] _values Buffer to fill.
+    /// \param[in] _count Number of values.
+    /// \param[in] _mean Mean value for the distribution
+    /// \param[in] _sigma Sigma value for the distribution
+    /// \param[in] _threads Number of threads to use, 0 for one per core.
+    public: void FillNormal(float *_values, std::size_t _count,
+                            float _mean = 0, float _sigma = 1,
+                            unsigned int _threads = 1);
+
+    /// \brief Private data pointer.
+    GZ_UTILS_IMPL_PTR(dataPtr)
+  };
+
   /// \class Rand Rand.hh gz/math/Rand.hh
-  /// \brief Random number generator class
+  /// \brief Random number generator class. The static functions share a
+  /// single generator, guarded by a mutex. Threads that draw many numbers
+  /// should use their own RandStream, see ThreadStream().
   class GZ_MATH_VISIBLE Rand
   {
     /// \brief Set the seed value.
@@ -75,6 +193,13 @@ namespace gz::math
     /// \param[in] _sigma Sigma value for the distribution
     public: static int32_t IntNormal(int _mean, int _sigma);
 
+    /// \brief Get the random stream of the calling thread. Streams are
+    /// indexed in the order in which threads first call this function, and
+    /// are seeded from Seed(). They are reseeded with the same index when
+    /// the seed changes.
+    /// \return The stream of the calling thread.
+    public: static RandStream &ThreadStream();
+
     /// \brief Get a mutable reference to the seed (create the static
     /// member if it hasn't been created yet).
     private: static uint32_t &SeedMutable();
@@ -0,0 +1,444 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_SIGNALACCUMULATOR_HH_
+#define GZ_MATH_SIGNALACCUMULATOR_HH_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <gz/math/config.hh>
+
+namespace gz::math
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace GZ_MATH_VERSION_NAMESPACE {
+  /// \brief Statistics that can be composed in a SignalAccumulator. They
+  /// match the SignalStatistic classes of the same short name.
+  ///
+  /// Besides InsertData(), each statistic reduces blocks of samples in
+  /// three steps, BeginBlock(), Accumulate() per sample and EndBlock(), so
+  /// that SignalAccumulator can update all its statistics in a single loop
+  /// without branches.
+  namespace stats
+  {
+    /// \brief Block hooks for statistics that accumulate every sample the
+    /// same way.
+    class BlockStatistic
+    {
+      /// \brief Start a block.
+      /// \param[in] _first First sample of the block.
+      public: void BeginBlock(double /*_first*/)
+      {
+      }
+
+      /// \brief Finish a block.
+      /// \param[in] _blockCount Number of samples in the block.
+      /// \param[in] _count Number of samples before the block.
+      public: void EndBlock(std::size_t /*_blockCount*/,
+                            std::size_t /*_count*/)
+      {
+      }
+    };
+
+    /// \brief Mean value of a signal.
+    class Mean : public BlockStatistic
+    {
+      /// \brief Get the short name of the statistic.
+      /// \return "mean"
+      public: static const char *ShortName()
+      {
+        return "mean";
+      }
+
+      /// \brief Add a sample.
+      /// \param[in] _data New signal data point.
+      /// \param[in] _count Number of samples including this one.
+      public: void InsertData(double _data, std::size_t /*_count*/)
+      {
+        this->Accumulate(_data);
+      }
+
+      /// \brief Add a sample of the current block.
+      /// \param[in] _data New signal data point.
+      public: void Accumulate(double _data)
+      {
+        this->sum += _data;
+      }
+
+      /// \brief Get the value of the statistic.
+      /// \param[in] _count Number of samples.
+      /// \return Mean, 0 without samples.
+      public: double Value(std::size_t _count) const
+      {
+        return _count == 0 ? 0.0 : this->sum / static_cast<double>(_count);
+      }
+
+      /// \brief Sum of the samples.
+      public: double sum = 0;
+    };
+
+    /// \brief Unbiased sample variance of a signal.
+    class Variance
+    {
+      /// \brief Get the short name of the statistic.
+      /// \return "var"
+      public: static const char *ShortName()
+      {
+        return "var";
+      }
+
+      /// \brief Add a sample with Welford's algorithm.
+      /// \param[in] _data New signal data point.
+      /// \param[in] _count Number of samples including this one.
+      public: void InsertData(double _data, std::size_t _count)
+      {
+        const double delta = _data - this->mean;
+        this->mean += delta / static_cast<double>(_count);
+        this->m2 += delta * (_data - this->mean);
+      }
+
+      /// \brief Start a block. Sums within a block are shifted by its first
+      /// sample, which keeps them accurate when the mean is large compared
+      /// to the spread.
+      /// \param[in] _first First sample of the block.
+      public: void BeginBlock(double _first)
+      {
+        this->shift = _first;
+        this->blockSum = 0;
+        this->blockSum2 = 0;
+      }
+
+      /// \brief Add a sample of the current block.
+      /// \param[in] _data New signal data point.
+      public: void Accumulate(double _data)
+      {
+        const double d = _data - this->shift;
+        this->blockSum += d;
+        this->blockSum2 += d * d;
+      }
+
+      /// \brief Merge the current block, see Chan et al., "Updating
+      /// formulae and a pairwise algorithm for computing sample variances",
+      /// 1979.
+      /// \param[in] _blockCount Number of samples in the block.
+      /// \param[in] _count Number of samples before the block.
+      public: void EndBlock(std::size_t _blockCount, std::size_t _count)
+      {
+        const double n = static_cast<double>(_blockCount);
+        const double total = static_cast<double>(_count + _blockCount);
+        const double blockMean = this->shift + this->blockSum / n;
+        const double blockM2 = std::max(0.0,
+            this->blockSum2 - this->blockSum * this->blockSum / n);
+        const double delta = blockMean - this->mean;
+        this->mean += delta * n / total;
+        this->m2 += blockM2 +
+          delta * delta * static_cast<double>(_count) * n / total;
+      }
+
+      /// \brief Get the value of the statistic.
+      /// \param[in] _count Number of samples.
+      /// \return Variance, 0 with less than two samples.
+      public: double Value(std::size_t _count) const
+      {
+        return _count < 2 ? 0.0 :
+          this->m2 / static_cast<double>(_count - 1);
+      }
+
+      /// \brief Mean of the samples.
+      public: double mean = 0;
+
+      /// \brief Sum of squared differences from the mean.
+      public: double m2 = 0;
+
+      /// \brief Shift of the current block.
+      public: double shift = 0;
+
+      /// \brief Sum of the shifted samples of the current block.
+      public: double blockSum = 0;
+
+      /// \brief Sum of the squared shifted samples of the current block.
+      public: double blockSum2 = 0;
+    };
+
+    /// \brief Root mean square of a signal.
+    class RootMeanSquare : public BlockStatistic
+    {
+      /// \brief Get the short name of the statistic.
+      /// \return "rms"
+      public: static const char *ShortName()
+      {
+        return "rms";
+      }
+
+      /// \brief Add a sample.
+      /// \param[in] _data New signal data point.
+      /// \param[in] _count Number of samples including this one.
+      public: void InsertData(double _data, std::size_t /*_count*/)
+      {
+        this->Accumulate(_data);
+      }
+
+      /// \brief Add a sample of the current block.
+      /// \param[in] _data New signal data point.
+      public: void Accumulate(double _data)
+      {
+        this->sum2 += _data * _data;
+      }
+
+      /// \brief Get the value of the statistic.
+      /// \param[in] _count Number of samples.
+      /// \return Root mean square, 0 without samples.
+      public: double Value(std::size_t _count) const
+      {
+        return _count == 0 ? 0.0 :
+          std::sqrt(this->sum2 / static_cast<double>(_count));
+      }
+
+      /// \brief Sum of the squared samples.
+      public: double sum2 = 0;
+    };
+
+    /// \brief Minimum value of a signal.
+    class Minimum : public BlockStatistic
+    {
+      /// \brief Get the short name of the statistic.
+      /// \return "min"
+      public: static const char *ShortName()
+      {
+        return "min";
+      }
+
+      /// \brief Add a sample.
+      /// \param[in] _data New signal data point.
+      /// \param[in] _count Number of samples including this one.
+      public: void InsertData(double _data, std::size_t /*_count*/)
+      {
+        this->Accumulate(_data);
+      }
+
+      /// \brief Add a sample of the current block.
+      /// \param[in] _data New signal data point.
+      public: void Accumulate(double _data)
+      {
+        this->value = std::min(this->value, _data);
+      }
+
+      /// \brief Get the value of the statistic.
+      /// \param[in] _count Number of samples.
+      /// \return Minimum, 0 without samples.
+      public: double Value(std::size_t _count) const
+      {
+        return _count == 0 ? 0.0 : this->value;
+      }
+
+      /// \brief Minimum of the samples.
+      public: double value = std::numeric_limits<double>::infinity();
+    };
+
+    /// \brief Maximum value of a signal.
+    class Maximum : public BlockStatistic
+    {
+      /// \brief Get the short name of the statistic.
+      /// \return "max"
+      public: static const char *ShortName()
+      {
+        return "max";
+      }
+
+      /// \brief Add a sample.
+      /// \param[in] _data New signal data point.
+      /// \param[in] _count Number of samples including this one.
+      public: void InsertData(double _data, std::size_t /*_count*/)
+      {
+        this->Accumulate(_data);
+      }
+
+      /// \brief Add a sample of the current block.
+      /// \param[in] _data New signal data point.
+      public: void Accumulate(double _data)
+      {
+        this->value = std::max(this->value, _data);
+      }
+
+      /// \brief Get the value of the statistic.
+      /// \param[in] _count Number of samples.
+      /// \return Maximum, 0 without samples.
+      public: double Value(std::size_t _count) const
+      {
+        return _count == 0 ? 0.0 : this->value;
+      }
+
+      /// \brief Maximum of the samples.
+      public: double value = -std::numeric_limits<double>::infinity();
+    };
+
+    /// \brief Maximum absolute value of a signal.
+    class MaxAbsoluteValue : public BlockStatistic
+    {
+      /// \brief Get the short name of the statistic.
+      /// \return "maxAbs"
+      public: static const char *ShortName()
+      {
+        return "maxAbs";
+      }
+
+      /// \brief Add a sample.
+      /// \param[in] _data New signal data point.
+      /// \param[in] _count Number of samples including this one.
+      public: void InsertData(double _data, std::size_t /*_count*/)
+      {
+        this->Accumulate(_data);
+      }
+
+      /// \brief Add a sample of the current block.
+      /// \param[in] _data New signal data point.
+      public: void Accumulate(double _data)
+      {
+        this->value = std::max(this->value, std::abs(_data));
+      }
+
+      /// \brief Get the value of the statistic.
+      /// \param[in] _count Number of samples.
+      /// \return Maximum absolute value, 0 without samples.
+      public: double Value(std::size_t /*_count*/) const
+      {
+        return this->value;
+      }
+
+      /// \brief Maximum absolute value of the samples.
+      public: double value = 0;
+    };
+  }  // namespace stats
+
+  /// \class SignalAccumulator SignalAccumulator.hh
+  /// gz/math/SignalAccumulator.hh
+  /// \brief Statistics of a scalar signal, selected at compile time.
+  ///
+  /// This is a lightweight alternative to SignalStats for many channels or
+  /// high sample rates: the statistics are stored by value, and inserting
+  /// a sample updates all of them inline, without virtual calls or
+  /// branches. Values match those of SignalStats up to round-off.
+  ///
+  /// ## Example usage
+  ///
+  /// \code{.cpp}
+  /// gz::math::SignalAccumulator<gz::math::stats::Mean,
+  ///   gz::math::stats::Variance> acc;
+  /// acc.InsertData(samples.data(), samples.size());
+  /// double mean = acc.Value<gz::math::stats::Mean>();
+  /// \endcode
+  ///
+  /// \tparam Stats Statistics from the gz::math::stats namespace, each at
+  /// most once.
+  template<typename... Stats>
+  class SignalAccumulator
+  {
+    static_assert(sizeof...(Stats) > 0,
+        "SignalAccumulator needs at least one statistic");
+
+    /// \brief Number of samples processed together by the batch
+    /// InsertData().
+    public: static constexpr std::size_t kBlockSize = 256;
+
+    /// \brief Get the number of samples.
+    /// \return Number of samples.
+    public: std::size_t Count() const
+    {
+      return this->count;
+    }
+
+    /// \brief Add a new sample to all statistics.
+    /// \param[in] _data New signal data point.
+    public: void InsertData(double _data)
+    {
+      ++this->count;
+      std::apply([&](auto &... _stats)
+        {
+          (_stats.InsertData(_data, this->count), ...);
+        }, this->stats);
+    }
+
+    /// \brief Add many samples to all statistics, in blocks that are
+    /// reduced in a single loop.
+    /// \param[in] _data Signal data points.
+    /// \param[in] _size Number of data points.
+    public: void InsertData(const double *_data, std::size_t _size)
+    {
+      for (std::size_t begin = 0; begin < _size; begin += kBlockSize)
+      {
+        const std::size_t blockCount = std::min(kBlockSize, _size - begin);
+        const double *block = _data + begin;
+        std::apply([&](auto &... _stats)
+          {
+            (_stats.BeginBlock(block[0]), ...);
+            for (std::size_t i = 0; i < blockCount; ++i)
+              (_stats.Accumulate(block[i]), ...);
+            (_stats.EndBlock(blockCount, this->count), ...);
+          }, this->stats);
+        this->count += blockCount;
+      }
+    }
+
+    /// \brief Add many samples to all statistics.
+    /// \param[in] _data Signal data points.
+    public: void InsertData(const std::vector<double> &_data)
+    {
+      this->InsertData(_data.data(), _data.size());
+    }
+
+    /// \brief Get the value of a statistic.
+    /// \tparam Stat Statistic, one of Stats.
+    /// \return Value of the statistic.
+    public: template<typename Stat>
+    double Value() const
+    {
+      static_assert((std::is_same_v<Stat, Stats> || ...),
+          "Statistic is not part of this SignalAccumulator");
+      return std::get<Stat>(this->stats).Value(this->count);
+    }
+
+    /// \brief Get the current values of each statistic, stored in a map
+    /// using the short name as the key, as SignalStats::Map().
+    /// \return Map with short name of each statistic as key
+    /// and value of statistic as the value.
+    public: std::map<std::string, double> Map() const
+    {
+      return {{Stats::ShortName(), this->Value<Stats>()}...};
+    }
+
+    /// \brief Forget all previous data.
+    public: void Reset()
+    {
+      *this = SignalAccumulator();
+    }
+
+    /// \brief Statistics.
+    private: std::tuple<Stats...> stats;
+
+    /// \brief Number of samples.
+    private: std::size_t count = 0;
+  };
+  }  // namespace GZ_MATH_VERSION_NAMESPACE
+}  // namespace gz::math
+#endif  // GZ_MATH_SIGNALACCUMULATOR_HH_
@@ -17,9 +17,12 @@
 #ifndef GZ_MATH_SIGNALSTATS_HH_
 #define GZ_MATH_SIGNALSTATS_HH_
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 #include <gz/math/Helpers.hh>
 #include <gz/math/config.hh>
 #include <gz/utils/ImplPtr.hh>
@@ -83,11 +86,41 @@ namespace gz::math
     /// \brief Forget all previous data.
     public: virtual void Reset();
 
+    /// \brief Combine with a statistic of the same type computed over
+    /// other data, as if that data had been inserted in this statistic.
+    /// This allows splitting a signal in chunks processed in parallel.
+    /// \param[in] _other Statistic to merge into this one.
+    /// \return False if _other is a different type of statistic, or if
+    /// this type of statistic cannot be merged.
+    public: bool Merge(const SignalStatistic &_other);
+
+    /// \brief Check whether Merge() accepts a statistic, without changing
+    /// this one.
+    /// \param[in] _other Statistic to check.
+    /// \return True if _other has the same ShortName(). Statistics with
+    /// parameters also require the same parameters.
+    public: virtual bool CanMerge(const SignalStatistic &_other) const;
+
     /// \brief Pointer to private data.
     public: class Implementation;
     GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
     protected: ::gz::utils::ImplPtr<Implementation> dataPtr;
     GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+    /// \brief Combine the data of a statistic of the same type. Counts are
+    /// updated by Merge() after this call.
+    /// \param[in] _other Private data of the other statistic.
+    /// \return False if this type of statistic cannot be merged, which is
+    /// the default.
+    protected: virtual bool MergeData(const Implementation &_other);
+
+    /// \brief Combine the data of a statistic of the same type, for
+    /// statistics that keep data outside of dataPtr. Counts are updated by
+    /// Merge() after this call.
+    /// \param[in] _other Other statistic, with the same ShortName().
+    /// \return False if this type of statistic cannot be merged. The
+    /// default calls MergeData() with the private data of _other.
+    protected: virtual bool MergeStatistic(const SignalStatistic &_other);
   };
 
   /// \class SignalMaximum SignalStats.hh gz/math/SignalStats.hh
@@ -103,6 +136,9 @@ namespace gz::math
 
     // Documentation inherited.
     public: virtual void InsertData(const double _data) override;
+
+    // Documentation inherited.
+    protected: virtual bool MergeData(const Implementation &_other) override;
   };
 
   /// \class SignalMean SignalStats.hh gz/math/SignalStats.hh
@@ -118,6 +154,9 @@ namespace gz::math
 
     // Documentation inherited.
     public: virtual void InsertData(const double _data) override;
+
+    // Documentation inherited.
+    protected: virtual bool MergeData(const Implementation &_other) override;
   };
 
   /// \class SignalMinimum SignalStats.hh gz/math/SignalStats.hh
@@ -133,6 +172,9 @@ namespace gz::math
 
     // Documentation inherited.
     public: virtual void InsertData(const double _data) override;
+
+    // Documentation inherited.
+    protected: virtual bool MergeData(const Implementation &_other) override;
   };
 
   /// \class SignalRootMeanSquare SignalStats.hh gz/math/SignalStats.hh
@@ -149,6 +191,9 @@ namespace gz::math
 
     // Documentation inherited.
     public: virtual void InsertData(const double _data) override;
+
+    // Documentation inherited.
+    protected: virtual bool MergeData(const Implementation &_other) override;
   };
 
   /// \class SignalMaxAbsoluteValue SignalStats.hh
@@ -167,6 +212,9 @@ namespace gz::math
 
     // Documentation inherited.
     public: virtual void InsertData(const double _data) override;
+
+    // Documentation inherited.
+    protected: virtual bool MergeData(const Implementation &_other) override;
   };
 
   /// \class SignalVariance SignalStats.hh gz/math/SignalStats.hh
@@ -183,6 +231,138 @@ namespace gz::math
 
     // Documentation inherited.
     public: virtual void InsertData(const double _data) override;
+
+    // Documentation inherited.
+    protected: virtual bool MergeData(const Implementation &_other) override;
+  };
+
+  /// \class SignalQuantile SignalStats.hh gz/math/SignalStats.hh
+  /// \brief Estimating a quantile of a discretely sampled signal, such as
+  /// its median or 99th percentile, in bounded memory.
+  ///
+  /// Samples are counted in logarithmically spaced buckets (DDSketch, see
+  /// C. Masson et al., "DDSketch: A fast and fully-mergeable quantile
+  /// sketch with relative-error guarantees", VLDB 2019), so insertion
+  /// takes constant amortized time and the estimate is within the relative
+  /// accuracy of the true quantile.
+  ///
+  /// At most 2048 buckets are kept for each sign, which covers magnitudes
+  /// within a ratio of about 6e17 at the default 1% accuracy. Beyond that,
+  /// the buckets closest to zero are collapsed into the lowest bucket kept.
+  /// The quantiles that fall in it are then overestimated, possibly by many
+  /// orders of magnitude: a single sample of 1e300 among samples close to
+  /// 1 moves the estimated median to about 1e282.
+  ///
+  /// NaN and infinite samples are ignored by the estimate, although Count()
+  /// includes them like for the other statistics.
+  class GZ_MATH_VISIBLE SignalQuantile : public SignalStatistic
+  {
+    /// \brief Constructor
+    /// \param[in] _quantile Quantile to estimate, in [0, 1].
+    /// \param[in] _relativeAccuracy Relative accuracy of the estimate,
+    /// in (0, 1).
+    public: explicit SignalQuantile(double _quantile = 0.5,
+                                    double _relativeAccuracy = 0.01);
+
+    /// \brief Get the estimated quantile.
+    /// \return Estimated quantile, 0 if there is no data.
+    public: virtual double Value() const override;
+
+    /// \brief Get a short version of the name of this statistical measure.
+    /// \return "p" followed by the quantile in percent, e.g. "p99".
+    public: virtual std::string ShortName() const override;
+
+    // Documentation inherited.
+    public: virtual void InsertData(const double _data) override;
+
+    /// \brief Get the quantile to estimate.
+    /// \return Quantile, in [0, 1].
+    public: double Quantile() const;
+
+    // Documentation inherited.
+    public: virtual void Reset() override;
+
+    /// \brief Check whether Merge() accepts a statistic.
+    /// \param[in] _other Statistic to check.
+    /// \return True if _other is a statistic of the same type with the
+    /// same ShortName() and relative accuracy.
+    public: virtual bool CanMerge(
+                const SignalStatistic &_other) const override;
+
+    // Documentation inherited.
+    protected: virtual bool MergeStatistic(
+                   const SignalStatistic &_other) override;
+
+    /// \brief Private data with the histogram of the signal.
+    private: class HistogramData;
+    GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+    private: ::gz::utils::ImplPtr<HistogramData> histogramPtr;
+    GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+  };
+
+  /// \class SignalHistogram SignalStats.hh gz/math/SignalStats.hh
+  /// \brief Histogram of a discretely sampled signal with logarithmically
+  /// spaced buckets, in bounded memory. The buckets are the same as those
+  /// of SignalQuantile, and so are the collapsing of the lowest buckets and
+  /// the handling of NaN and infinite samples.
+  class GZ_MATH_VISIBLE SignalHistogram : public SignalStatistic
+  {
+    /// \brief A bucket of the histogram.
+    public: struct Bucket
+    {
+      /// \brief Lower bound of the bucket.
+      double min;
+
+      /// \brief Upper bound of the bucket.
+      double max;
+
+      /// \brief Number of samples in [min, max]. The exact bounds of a
+      /// bucket may overlap with its neighbors by round-off.
+      uint64_t count;
+    };
+
+    /// \brief Constructor
+    /// \param[in] _relativeAccuracy Half the relative width of the
+    /// buckets, in (0, 1). Consecutive bucket bounds have a ratio of
+    /// (1 + _relativeAccuracy) / (1 - _relativeAccuracy).
+    public: explicit SignalHistogram(double _relativeAccuracy = 0.1);
+
+    /// \brief Get the center of the bucket with the most samples, which
+    /// is an estimate of the mode of the signal.
+    /// \return Center of the most populated bucket, 0 if there is no data.
+    public: virtual double Value() const override;
+
+    /// \brief Get a short version of the name of this statistical measure.
+    /// \return "hist"
+    public: virtual std::string ShortName() const override;
+
+    // Documentation inherited.
+    public: virtual void InsertData(const double _data) override;
+
+    /// \brief Get the non-empty buckets of the histogram. Samples equal to
+    /// zero are counted in a bucket with null bounds.
+    /// \return Buckets in increasing order of value.
+    public: std::vector<Bucket> Buckets() const;
+
+    // Documentation inherited.
+    public: virtual void Reset() override;
+
+    /// \brief Check whether Merge() accepts a statistic.
+    /// \param[in] _other Statistic to check.
+    /// \return True if _other is a statistic of the same type with the
+    /// same ShortName() and relative accuracy.
+    public: virtual bool CanMerge(
+                const SignalStatistic &_other) const override;
+
+    // Documentation inherited.
+    protected: virtual bool MergeStatistic(
+                   const SignalStatistic &_other) override;
+
+    /// \brief Private data with the histogram of the signal.
+    private: class HistogramData;
+    GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+    private: ::gz::utils::ImplPtr<HistogramData> histogramPtr;
+    GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
   };
 
   /// \class SignalStats SignalStats.hh gz/math/SignalStats.hh
@@ -209,12 +389,35 @@ namespace gz::math
     /// \param[in] _data New signal data point.
     public: void InsertData(const double _data);
 
+    /// \brief Add many samples to the statistical measures. With several
+    /// threads, the samples are split in contiguous chunks whose
+    /// statistics are merged in order, so results only differ from
+    /// sequential insertion by round-off.
+    /// \param[in] _data Signal data points.
+    /// \param[in] _count Number of data points.
+    /// \param[in] _threads Number of threads to use, 0 for one per core.
+    public: void InsertData(const double *_data, std::size_t _count,
+                            unsigned int _threads = 1);
+
+    /// \brief Combine with statistics computed over other data, as if
+    /// that data had been inserted here. See SignalStatistic::Merge.
+    /// \param[in] _other Statistics to merge into these ones. They must
+    /// have the same set of statistics.
+    /// \return False, without changing these statistics, if the sets of
+    /// statistics differ or cannot be merged.
+    public: bool Merge(const SignalStats &_other);
+
     /// \brief Add a new type of statistic.
     /// \param[in] _name Short name of new statistic.
     /// Valid values include:
+    ///  "max"
     ///  "maxAbs"
     ///  "mean"
+    ///  "min"
     ///  "rms"
+    ///  "var"
+    ///  "hist"
+    ///  "p" followed by a percentile, such as "p50", "p99" or "p99.9"
     /// \return True if statistic was successfully added,
     /// false if name was not recognized or had already
     /// been inserted.
@@ -223,12 +426,19 @@ namespace gz::math
     /// \brief Add multiple statistics.
     /// \param[in] _names Comma-separated list of new statistics.
     /// For example, all statistics could be added with:
-    ///  "maxAbs,mean,rms"
+    ///  "max,maxAbs,mean,min,rms,var,hist,p50,p99"
     /// \return True if all statistics were successfully added,
     /// false if any names were not recognized or had already
     /// been inserted.
     public: bool InsertStatistics(const std::string &_names);
 
+    /// \brief Get a statistic, for example to access the buckets of the
+    /// "hist" SignalHistogram.
+    /// \param[in] _name Short name of the statistic.
+    /// \return The statistic, or nullptr if it has not been inserted. It
+    /// remains valid as long as this object.
+    public: const SignalStatistic *Statistic(const std::string &_name) const;
+
     /// \brief Forget all previous data.
     public: void Reset();
 
@@ -18,10 +18,19 @@
 #ifndef GZ_MATH_TIME_VARYING_VOLUMETRIC_GRID_HH_
 #define GZ_MATH_TIME_VARYING_VOLUMETRIC_GRID_HH_
 
+#include <gz/math/MappedFile.hh>
 #include <gz/math/TimeVaryingVolumetricGridLookupField.hh>
 #include <gz/math/Vector3.hh>
+#include <gz/math/VolumetricGridFile.hh>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <map>
+#include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -114,6 +123,40 @@ class TimeVaryingVolumetricGrid<T, V, InMemorySession<T, P>, P>
     return result;
   }
 
+  /// \brief Looks up a given point like LookUp() with the default
+  /// tolerance, but the search starts from the grid cells of the previous
+  /// lookup made with the same hints. Consecutive lookups at nearby
+  /// positions are faster and do not allocate memory.
+  /// \param[in] _session - The session with the time stamp to be looked up.
+  /// \param[in,out] _hints - Cells of the previous lookup, owned by the
+  /// caller and updated with the cells of this one. Use one per vehicle or
+  /// thread.
+  /// \param[in] _pos - The position to look up.
+  /// \return nullopt if the data is out of range.
+  public: std::optional<V>
+    LookUp(const InMemorySession<T, P> &_session,
+      InMemoryLookupHints &_hints,
+      const Vector3<P> &_pos) const
+  {
+    return indices.EstimateQuadrilinear(_session, _hints, values, _pos);
+  }
+
+  /// \brief Looks up many points at the time of a session, like calling
+  /// LookUp() on each of them in order.
+  /// \param[in] _session - The session with the time stamp to be looked up.
+  /// \param[in] _positions - The positions to look up.
+  /// \param[out] _values - The value of each position, nullopt if it is
+  /// out of range.
+  /// \param[in] _threads - Number of threads to use, 0 for one per core.
+  public: void LookUp(const InMemorySession<T, P> &_session,
+      const std::vector<Vector3<P>> &_positions,
+      std::vector<std::optional<V>> &_values,
+      unsigned int _threads = 1) const
+  {
+    indices.EstimateQuadrilinear(
+      _session, values, _positions, _values, V(0), _threads);
+  }
+
   /// \brief Get the bounds of this grid field at given time.
   /// \return A pair of vectors. All zeros if session is invalid.
   public: std::pair<Vector3<V>, Vector3<V>> Bounds(
@@ -173,6 +216,150 @@ class InMemoryTimeVaryingVolumetricGridFactory
     return grid;
   }
 
+  /// \brief Writes the points added so far to a volumetric grid file,
+  /// which Load() reads much faster than the points can be added. The
+  /// axes of the file are the distinct coordinates of all the points, and
+  /// grid points without a value are stored as missing.
+  /// \param[in] _path Path of the file.
+  /// \param[in] _encoding Encoding of the values in the file.
+  /// \param[in] _tileSize Number of points along each axis of a tile.
+  /// \return True on success. Otherwise an error is logged.
+  /// \sa WriteVolumetricGridFile
+  public: bool WriteFile(
+    const std::string &_path,
+    VolumetricGridEncoding _encoding = VolumetricGridEncoding::FLOAT32,
+    const std::array<uint32_t, 3> &_tileSize = {{16, 16, 16}}) const
+  {
+    std::array<std::vector<double>, 3> axes;
+    std::vector<double> times;
+    for (auto &[time, pts] : _points)
+    {
+      times.push_back(static_cast<double>(time));
+      for (auto &[pt, val] : pts)
+      {
+        for (int i = 0; i < 3; ++i)
+          axes[i].push_back(pt[i]);
+      }
+    }
+    for (auto &axis : axes)
+    {
+      std::sort(axis.begin(), axis.end());
+      axis.erase(std::unique(axis.begin(), axis.end()), axis.end());
+    }
+
+    const std::size_t nx = axes[0].size();
+    const std::size_t ny = axes[1].size();
+    const std::size_t frameSize = nx * ny * axes[2].size();
+    std::vector<V> values(
+      frameSize * times.size(), std::numeric_limits<V>::quiet_NaN());
+    std::size_t frame = 0;
+    for (auto &[time, pts] : _points)
+    {
+      V *frameValues = values.data() + frame++ * frameSize;
+      for (auto &[pt, val] : pts)
+      {
+        std::array<std::size_t, 3> index;
+        for (int i = 0; i < 3; ++i)
+        {
+          index[i] = static_cast<std::size_t>(
+            std::lower_bound(axes[i].begin(), axes[i].end(), pt[i]) -
+            axes[i].begin());
+        }
+        frameValues[(index[2] * ny + index[1]) * nx + index[0]] = val;
+      }
+    }
+    return WriteVolumetricGridFile(_path, axes[0], axes[1], axes[2], times,
+      values, _encoding, _tileSize);
+  }
+
+  /// \brief Builds an `InMemoryTimeVaryingVolumetricGrid<T, V, P>` from a
+  /// volumetric grid file. The file is memory mapped and its values are
+  /// copied once, with no per point work, so this is much faster than
+  /// adding the points one at a time. Missing values are replaced by zero,
+  /// which is what lookups use for missing points.
+  /// \param[in] _path Path of the file.
+  /// \return The grid, nullopt if the file could not be read. In that case
+  /// an error is logged.
+  /// \sa WriteFile
+  public: static std::optional<InMemoryTimeVaryingVolumetricGrid<T, V, P>>
+    Load(const std::string &_path)
+  {
+    MappedFile file;
+    VolumetricGridFileHeader header;
+    if (!file.Open(_path) ||
+        !detail::ReadVolumetricGridHeader(file.Data(), file.Size(), header))
+    {
+      return std::nullopt;
+    }
+
+    std::array<std::vector<V>, 3> axes;
+    std::vector<double> times(header.frames);
+    const uint8_t *data = file.Data() + header.axesOffset;
+    for (int i = 0; i < 3; ++i)
+    {
+      std::vector<double> axis(header.size[i]);
+      std::memcpy(axis.data(), data, axis.size() * sizeof(double));
+      data += axis.size() * sizeof(double);
+      axes[i].assign(axis.begin(), axis.end());
+    }
+    std::memcpy(times.data(), data, times.size() * sizeof(double));
+
+    const std::size_t nx = header.size[0];
+    const std::size_t ny = header.size[1];
+    const std::size_t nz = header.size[2];
+    const std::size_t frameSize = nx * ny * nz;
+    const auto &tileSize = header.tileSize;
+    const auto counts = detail::VolumetricGridTileCounts(header);
+
+    InMemoryTimeVaryingVolumetricGrid<T, V, P> grid;
+    grid.values.resize(frameSize * times.size());
+    std::vector<V> tile(
+      std::size_t{tileSize[0]} * tileSize[1] * tileSize[2]);
+    for (std::size_t f = 0; f < times.size(); ++f)
+    {
+      V *frameValues = grid.values.data() + f * frameSize;
+      const uint8_t *frameData =
+        file.Data() + header.valuesOffset + f * header.frameStride;
+      std::size_t tileId = 0;
+      for (std::size_t tz = 0; tz < counts[2]; ++tz)
+      {
+        for (std::size_t ty = 0; ty < counts[1]; ++ty)
+        {
+          for (std::size_t tx = 0; tx < counts[0]; ++tx, ++tileId)
+          {
+            detail::DecodeVolumetricGridValues(
+              frameData + tileId * header.tileStride, header, tile.size(),
+              tile.data());
+            // Copy the part of the tile inside of the grid, row by row.
+            const std::size_t x0 = tx * tileSize[0];
+            const std::size_t y0 = ty * tileSize[1];
+            const std::size_t z0 = tz * tileSize[2];
+            const std::size_t width = std::min<std::size_t>(
+              tileSize[0], nx - x0);
+            for (std::size_t z = z0; z < std::min(z0 + tileSize[2], nz); ++z)
+            {
+              for (std::size_t y = y0; y < std::min(y0 + tileSize[1], ny);
+                   ++y)
+              {
+                const V *row = tile.data() +
+                  ((z - z0) * tileSize[1] + (y - y0)) * tileSize[0];
+                V *out = frameValues + (z * ny + y) * nx + x0;
+                for (std::size_t x = 0; x < width; ++x)
+                  out[x] = std::isnan(row[x]) ? V(0) : row[x];
+              }
+            }
+          }
+        }
+      }
+
+      // Every frame shares the axes, and only the first index differs.
+      VolumetricGridLookupField<V> field(axes[0], axes[1], axes[2],
+        f * frameSize);
+      grid.indices.AddVolumetricGridField(static_cast<T>(times[f]), field);
+    }
+    return grid;
+  }
+
   /// Temporary datastore
   private: std::map<T, std::vector<std::pair<Vector3d, V>>> _points;
 };
@@ -20,6 +20,7 @@
 #include <gz/math/VolumetricGridLookupField.hh>
 #include <gz/math/detail/InterpolationPoint.hh>
 
+#include <array>
 #include <map>
 #include <optional>
 #include <utility>
@@ -91,6 +92,13 @@ namespace gz::math
     public: std::pair<Vector3<V>, Vector3<V>> Bounds(const S &_session);
   };
 
+  /// \brief Grid cells of the last lookup in the current and the next time
+  /// frames of an InMemorySession. A caller that follows one vehicle keeps
+  /// one of these next to its session so that consecutive lookups at nearby
+  /// positions start from the previous cells instead of searching the axes.
+  /// It is only a starting point: any value gives the same results.
+  using InMemoryLookupHints = std::array<VolumetricGridLookupHint, 2>;
+
   /// \brief An in-memory session. Loads the whole dataset in memory and
   /// performs queries.
   template<typename T, typename V>
@@ -293,6 +301,38 @@ namespace gz::math
       return std::nullopt;
     }
 
+    /// \brief Estimates the values of many points for one session, like
+    /// calling EstimateQuadrilinear() on each of them in order.
+    /// \param[in] _session - The session
+    /// \param[in] _values - Value array of all time frames.
+    /// \param[in] _positions - The positions to be queried.
+    /// \param[out] _results - The estimated value of each position.
+    /// \param[in] _default - Value used if there is a hole in the data.
+    /// \param[in] _threads - Number of threads to use, 0 for one per core.
+    public: template<typename X>
+    void EstimateQuadrilinear(
+      const InMemorySession<T, V> &_session,
+      const std::vector<X> &_values,
+      const std::vector<Vector3<V>> &_positions,
+      std::vector<std::optional<X>> &_results,
+      const X _default = X(0),
+      unsigned int _threads = 1) const
+    {
+      _results.resize(_positions.size());
+      const unsigned int threads = detail::ThreadCount(
+        _threads, _positions.size());
+      detail::ParallelFor(_positions.size(), threads,
+        [&](std::size_t _begin, std::size_t _end, unsigned int)
+        {
+          InMemoryLookupHints hints;
+          for (std::size_t i = _begin; i < _end; ++i)
+          {
+            _results[i] = this->EstimateQuadrilinear(
+              _session, hints, _values, _positions[i], _default);
+          }
+        });
+    }
+
     /// \brief Get the bounds of this grid field.
     /// \return A pair of vectors. All zeros if session is invalid.
     public: std::pair<Vector3<V>, Vector3<V>> Bounds(
@@ -308,6 +348,73 @@ namespace gz::math
       return _session.iter->second.Bounds();
     }
 
+    /// \brief Estimates the value of a point like LookUp() with the default
+    /// tolerance followed by EstimateQuadrilinear() with the same value
+    /// array for both time frames, but without allocating memory. The
+    /// session is not modified, so it may be shared between threads as long
+    /// as each thread has its own hints.
+    /// \param[in] _session - The session
+    /// \param[in,out] _hints - Cells of the previous lookup in the current
+    /// and next time frames, updated with the cells of this one.
+    /// \param[in] _values - Value array of all time frames.
+    /// \param[in] _position - The position to be queried.
+    /// \param[in] _default - Value used if there is a hole in the data.
+    /// \returns The estimated value for the point. Nullopt if we are
+    /// outside the field.
+    public: template<typename X>
+    std::optional<X> EstimateQuadrilinear(
+      const InMemorySession<T, V> &_session,
+      InMemoryLookupHints &_hints,
+      const std::vector<X> &_values,
+      const Vector3<V> &_position,
+      const X &_default = X(0)) const
+    {
+      if (_session.iter == this->gridFields.end())
+      {
+        // Out of bounds
+        return std::nullopt;
+      }
+
+      const auto &field1 = _session.iter->second;
+      InterpolationCell3D<V> cell1;
+      field1.GetInterpolators(_position, cell1, _hints[0]);
+
+      auto next = std::next(_session.iter);
+      if (next == this->gridFields.end())
+      {
+        // This happens we reach the end of time
+        return field1.EstimateValueUsingTrilinear(
+          cell1, _position, _values, _default);
+      }
+
+      const auto &field2 = next->second;
+      InterpolationCell3D<V> cell2;
+      field2.GetInterpolators(_position, cell2, _hints[1]);
+
+      /// Got nothing to interpolate. Out of bounds.
+      if (cell1.count == 0 && cell2.count == 0)
+        return std::nullopt;
+
+      /// Only one of the two time-slices has data. Use that slice to guess.
+      if (cell2.count == 0)
+      {
+        return field1.EstimateValueUsingTrilinear(
+          cell1, _position, _values, _default);
+      }
+      if (cell1.count == 0)
+      {
+        return field2.EstimateValueUsingTrilinear(
+          cell2, _position, _values, _default);
+      }
+
+      const X res1 = field1.EstimateValueUsingTrilinear(
+        cell1, _position, _values, _default).value();
+      const X res2 = field2.EstimateValueUsingTrilinear(
+        cell2, _position, _values, _default).value();
+      return detail::LinearInterpolateTime(
+        _session.iter->first, res1, next->first, res2, _session.time);
+    }
+
     private: std::map<T, VolumetricGridLookupField<V>> gridFields;
   };
 }  // namespace gz::math
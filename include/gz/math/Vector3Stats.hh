@@ -17,6 +17,7 @@
 #ifndef GZ_MATH_VECTOR3STATS_HH_
 #define GZ_MATH_VECTOR3STATS_HH_
 
+#include <cstddef>
 #include <string>
 #include <gz/math/Helpers.hh>
 #include <gz/math/SignalStats.hh>
@@ -39,6 +40,23 @@ namespace gz::math
     /// \param[in] _data New signal data point.
     public: void InsertData(const Vector3d &_data);
 
+    /// \brief Add many samples to the statistical measures. With several
+    /// threads, the samples are split in contiguous chunks whose
+    /// statistics are merged in order, see SignalStats::InsertData.
+    /// \param[in] _data Signal data points.
+    /// \param[in] _count Number of data points.
+    /// \param[in] _threads Number of threads to use, 0 for one per core.
+    public: void InsertData(const Vector3d *_data, std::size_t _count,
+                            unsigned int _threads = 1);
+
+    /// \brief Combine with statistics computed over other data, as if
+    /// that data had been inserted here. See SignalStats::Merge.
+    /// \param[in] _other Statistics to merge into these ones. Each
+    /// component must have the same set of statistics.
+    /// \return False, without changing these statistics, if the sets of
+    /// statistics differ.
+    public: bool Merge(const Vector3Stats &_other);
+
     /// \brief Add a new type of statistic.
     /// \param[in] _name Short name of new statistic.
     /// Valid values include:
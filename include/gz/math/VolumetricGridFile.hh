@@ -0,0 +1,687 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_VOLUMETRIC_GRID_FILE_HH_
+#define GZ_MATH_VOLUMETRIC_GRID_FILE_HH_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <gz/math/config.hh>
+#include <gz/math/detail/Error.hh>
+
+namespace gz::math
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace GZ_MATH_VERSION_NAMESPACE {
+  /// \enum VolumetricGridEncoding
+  /// \brief Encoding of the values stored in a volumetric grid file.
+  enum class VolumetricGridEncoding : uint32_t
+  {
+    /// \brief 32 bit IEEE 754 floating point values.
+    FLOAT32 = 1,
+
+    /// \brief 64 bit IEEE 754 floating point values.
+    FLOAT64 = 2,
+
+    /// \brief 16 bit IEEE 754 floating point values, with 11 significant
+    /// bits and a range of +/-65504.
+    FLOAT16 = 3,
+
+    /// \brief 16 bit signed integers q, mapped linearly to the range of the
+    /// values as scale * q + offset. The error is at most scale / 2.
+    QUANTIZED16 = 4
+  };
+
+  /// \brief Header at the start of a volumetric grid file.
+  ///
+  /// A volumetric grid file stores a time varying field sampled on a dense
+  /// grid whose axes are shared by every time frame. The header is followed
+  /// by the axes, as arrays of doubles: the x positions, the y positions,
+  /// the z positions and the times of the frames. The values start at
+  /// valuesOffset, which is aligned to 4096 bytes so that they can be
+  /// memory mapped efficiently.
+  ///
+  /// The values of a frame are split into tiles of tileSize points, so that
+  /// a query reads a few contiguous blocks instead of points scattered
+  /// across the whole frame. Tiles are stored with x varying fastest, then
+  /// y, then z, and so are the points inside of each tile. Tiles at the
+  /// upper edges of the grid are padded to the full tile size. Missing
+  /// points, as well as padding, are stored as NaN, or as -32768 with the
+  /// QUANTIZED16 encoding.
+  ///
+  /// All the fields are stored in the byte order of the machine that wrote
+  /// the file. Readers reject files with a different byte order.
+  struct VolumetricGridFileHeader
+  {
+    /// \brief File signature, "GZMGRID" followed by a null character.
+    char magic[8];
+
+    /// \brief Version of the format.
+    uint32_t version;
+
+    /// \brief The value 0x01020304, to detect the byte order.
+    uint32_t byteOrder;
+
+    /// \brief Encoding of the values, see VolumetricGridEncoding.
+    uint32_t encoding;
+
+    /// \brief Reserved, zero.
+    uint32_t reserved;
+
+    /// \brief Number of points along the x, y and z axes.
+    uint64_t size[3];
+
+    /// \brief Number of time frames.
+    uint64_t frames;
+
+    /// \brief Number of points along the x, y and z axes of a tile.
+    uint32_t tileSize[3];
+
+    /// \brief Reserved, zero.
+    uint32_t reserved2;
+
+    /// \brief Offset of the axes from the start of the file, in bytes.
+    uint64_t axesOffset;
+
+    /// \brief Offset of the values of the first frame from the start of the
+    /// file, in bytes.
+    uint64_t valuesOffset;
+
+    /// \brief Distance between consecutive tiles of a frame, in bytes.
+    uint64_t tileStride;
+
+    /// \brief Distance between consecutive frames, in bytes.
+    uint64_t frameStride;
+
+    /// \brief Scale of QUANTIZED16 values, 1 for other encodings.
+    double scale;
+
+    /// \brief Offset of QUANTIZED16 values, 0 for other encodings.
+    double offset;
+
+    /// \brief Reserved, zero.
+    uint64_t reserved3;
+  };
+
+  static_assert(sizeof(VolumetricGridFileHeader) == 128,
+                "VolumetricGridFileHeader must be 128 bytes");
+
+  namespace detail {
+    /// \brief Current version of the volumetric grid file format.
+    constexpr uint32_t kVolumetricGridFileVersion = 1;
+
+    /// \brief Value of VolumetricGridFileHeader::byteOrder.
+    constexpr uint32_t kVolumetricGridByteOrder = 0x01020304;
+
+    /// \brief Alignment of the values in a volumetric grid file.
+    constexpr uint64_t kVolumetricGridValuesAlignment = 4096;
+
+    /// \brief Get the size of an encoded value.
+    /// \param[in] _encoding The encoding.
+    /// \return The size of a value in bytes, 0 if the encoding is unknown.
+    inline std::size_t VolumetricGridValueSize(uint32_t _encoding)
+    {
+      switch (static_cast<VolumetricGridEncoding>(_encoding))
+      {
+        case VolumetricGridEncoding::FLOAT32:
+          return sizeof(float);
+        case VolumetricGridEncoding::FLOAT64:
+          return sizeof(double);
+        case VolumetricGridEncoding::FLOAT16:
+        case VolumetricGridEncoding::QUANTIZED16:
+          return sizeof(uint16_t);
+        default:
+          return 0;
+      }
+    }
+
+    /// \brief Value of a missing QUANTIZED16 value.
+    constexpr int16_t kVolumetricGridMissingQuantized = -32768;
+
+    /// \brief Convert a float to a 16 bit IEEE 754 float, rounding to the
+    /// nearest value.
+    /// \param[in] _value The value.
+    /// \return The bits of the 16 bit float.
+    inline uint16_t FloatToHalf(float _value)
+    {
+      uint32_t bits;
+      std::memcpy(&bits, &_value, sizeof(bits));
+      const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+      const uint32_t magnitude = bits & 0x7fffffffu;
+
+      // Infinity and NaN
+      if (magnitude >= 0x7f800000u)
+      {
+        return static_cast<uint16_t>(
+          sign | 0x7c00u | (magnitude > 0x7f800000u ? 0x200u : 0u));
+      }
+      // Too large, rounds to infinity
+      if (magnitude >= 0x477ff000u)
+        return static_cast<uint16_t>(sign | 0x7c00u);
+
+      uint32_t half;
+      uint32_t remainder;
+      uint32_t halfway;
+      if (magnitude < 0x38800000u)
+      {
+        // Subnormal, or zero once rounded
+        if (magnitude < 0x33000000u)
+          return sign;
+        const uint32_t exponent = magnitude >> 23;
+        const uint32_t mantissa = (magnitude & 0x7fffffu) | 0x800000u;
+        const uint32_t shift = 126u - exponent;
+        half = mantissa >> shift;
+        remainder = mantissa & ((1u << shift) - 1u);
+        halfway = 1u << (shift - 1u);
+      }
+      else
+      {
+        half = (magnitude >> 13) - (112u << 10);
+        remainder = magnitude & 0x1fffu;
+        halfway = 0x1000u;
+      }
+      // Round half to even. A carry out of the mantissa correctly
+      // increments the exponent.
+      if (remainder > halfway || (remainder == halfway && (half & 1u)))
+        ++half;
+      return static_cast<uint16_t>(sign | half);
+    }
+
+    /// \brief Convert a 16 bit IEEE 754 float to a float. The conversion
+    /// is exact.
+    /// \param[in] _half The bits of the 16 bit float.
+    /// \return The value.
+    inline float HalfToFloat(uint16_t _half)
+    {
+      const uint32_t sign = static_cast<uint32_t>(_half & 0x8000u) << 16;
+      uint32_t exponent = (_half >> 10) & 0x1fu;
+      uint32_t mantissa = _half & 0x3ffu;
+      uint32_t bits;
+      if (exponent == 0x1fu)
+      {
+        bits = sign | 0x7f800000u | (mantissa << 13);
+      }
+      else if (exponent != 0)
+      {
+        bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+      }
+      else if (mantissa == 0)
+      {
+        bits = sign;
+      }
+      else
+      {
+        // Subnormal, normalize it.
+        exponent = 113;
+        while ((mantissa & 0x400u) == 0)
+        {
+          mantissa <<= 1;
+          --exponent;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3ffu) << 13);
+      }
+      float value;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
+
+    /// \brief Multiply two sizes read from a file, detecting overflow.
+    /// \param[in] _a First factor.
+    /// \param[in] _b Second factor.
+    /// \param[out] _result The product, if it does not overflow.
+    /// \return False if the product overflows.
+    inline bool CheckedMultiply(uint64_t _a, uint64_t _b, uint64_t &_result)
+    {
+      if (_a != 0 && _b > std::numeric_limits<uint64_t>::max() / _a)
+        return false;
+      _result = _a * _b;
+      return true;
+    }
+
+    /// \brief Add two sizes read from a file, detecting overflow.
+    /// \param[in] _a First term.
+    /// \param[in] _b Second term.
+    /// \param[out] _result The sum, if it does not overflow.
+    /// \return False if the sum overflows.
+    inline bool CheckedAdd(uint64_t _a, uint64_t _b, uint64_t &_result)
+    {
+      if (_b > std::numeric_limits<uint64_t>::max() - _a)
+        return false;
+      _result = _a + _b;
+      return true;
+    }
+
+    /// \brief Check that an axis of a volumetric grid is strictly
+    /// increasing. NaN values are rejected.
+    /// \param[in] _data The positions or times, possibly unaligned.
+    /// \param[in] _count Number of values.
+    /// \return True if every value is greater than the previous one.
+    inline bool VolumetricGridAxisIncreasing(const uint8_t *_data,
+                                             uint64_t _count)
+    {
+      double previous = -std::numeric_limits<double>::infinity();
+      for (uint64_t i = 0; i < _count; ++i)
+      {
+        double value;
+        std::memcpy(&value, _data + i * sizeof(value), sizeof(value));
+        if (!(value > previous))
+          return false;
+        previous = value;
+      }
+      return true;
+    }
+
+    /// \brief Get the number of tiles along each axis of a grid.
+    /// \param[in] _header The header of the file.
+    /// \return The number of tiles along the x, y and z axes.
+    inline std::array<uint64_t, 3> VolumetricGridTileCounts(
+      const VolumetricGridFileHeader &_header)
+    {
+      std::array<uint64_t, 3> counts;
+      for (int i = 0; i < 3; ++i)
+      {
+        counts[i] =
+          (_header.size[i] + _header.tileSize[i] - 1) / _header.tileSize[i];
+      }
+      return counts;
+    }
+
+    /// \brief Check the header of a volumetric grid file, and that the
+    /// file is large enough for the data it describes.
+    /// \param[in] _data Contents of the file.
+    /// \param[in] _size Size of the file in bytes.
+    /// \param[out] _header The header of the file.
+    /// \return True if the file is valid. Otherwise an error is logged.
+    inline bool ReadVolumetricGridHeader(
+      const uint8_t *_data, std::size_t _size,
+      VolumetricGridFileHeader &_header)
+    {
+      if (_data == nullptr || _size < sizeof(VolumetricGridFileHeader))
+      {
+        LogErrorMessage("Volumetric grid file is too small.");
+        return false;
+      }
+      std::memcpy(&_header, _data, sizeof(_header));
+      if (std::memcmp(_header.magic, "GZMGRID", 8) != 0)
+      {
+        LogErrorMessage("Not a volumetric grid file.");
+        return false;
+      }
+      if (_header.byteOrder != kVolumetricGridByteOrder)
+      {
+        LogErrorMessage("Volumetric grid file has a different byte order.");
+        return false;
+      }
+      if (_header.version != kVolumetricGridFileVersion)
+      {
+        LogErrorMessage("Unsupported volumetric grid file version [" +
+            std::to_string(_header.version) + "].");
+        return false;
+      }
+      const std::size_t valueSize = VolumetricGridValueSize(_header.encoding);
+      if (valueSize == 0)
+      {
+        LogErrorMessage("Unsupported volumetric grid encoding [" +
+            std::to_string(_header.encoding) + "].");
+        return false;
+      }
+      if (!std::isfinite(_header.scale) || !std::isfinite(_header.offset))
+      {
+        LogErrorMessage("Volumetric grid file has an invalid scale.");
+        return false;
+      }
+      for (int i = 0; i < 3; ++i)
+      {
+        if (_header.size[i] == 0 || _header.tileSize[i] == 0)
+        {
+          LogErrorMessage("Volumetric grid file has an empty axis.");
+          return false;
+        }
+      }
+      if (_header.frames == 0)
+      {
+        LogErrorMessage("Volumetric grid file has no frames.");
+        return false;
+      }
+
+      // The sizes come from the file, so every product and sum is checked
+      // for overflow before comparing it with the size of the file.
+      const auto counts = VolumetricGridTileCounts(_header);
+      uint64_t tileVolume, tileBytes, tilesPerFrame, frameBytes;
+      uint64_t axes, axesBytes, axesEnd, valuesBytes, valuesEnd;
+      if (!CheckedMultiply(uint64_t{_header.tileSize[0]} *
+            _header.tileSize[1], _header.tileSize[2], tileVolume) ||
+          !CheckedMultiply(tileVolume, valueSize, tileBytes) ||
+          !CheckedMultiply(counts[0], counts[1], tilesPerFrame) ||
+          !CheckedMultiply(tilesPerFrame, counts[2], tilesPerFrame) ||
+          !CheckedMultiply(tilesPerFrame, _header.tileStride, frameBytes) ||
+          !CheckedAdd(_header.size[0], _header.size[1], axes) ||
+          !CheckedAdd(axes, _header.size[2], axes) ||
+          !CheckedAdd(axes, _header.frames, axes) ||
+          !CheckedMultiply(axes, sizeof(double), axesBytes) ||
+          !CheckedAdd(_header.axesOffset, axesBytes, axesEnd) ||
+          !CheckedMultiply(_header.frames, _header.frameStride, valuesBytes) ||
+          !CheckedAdd(_header.valuesOffset, valuesBytes, valuesEnd) ||
+          _header.tileStride < tileBytes ||
+          _header.frameStride < frameBytes ||
+          axesEnd > _size || valuesEnd > _size)
+      {
+        LogErrorMessage("Volumetric grid file is truncated or corrupt.");
+        return false;
+      }
+
+      // Tiles may be used in place in a memory mapping, which is page
+      // aligned, so every value must be aligned to its own size.
+      if (_header.valuesOffset % valueSize != 0 ||
+          _header.tileStride % valueSize != 0 ||
+          _header.frameStride % valueSize != 0)
+      {
+        LogErrorMessage("Volumetric grid file has misaligned values.");
+        return false;
+      }
+
+      const uint8_t *axis = _data + _header.axesOffset;
+      for (uint64_t count : {_header.size[0], _header.size[1],
+                             _header.size[2], _header.frames})
+      {
+        if (!VolumetricGridAxisIncreasing(axis, count))
+        {
+          LogErrorMessage("Volumetric grid file has an axis that is not "
+              "strictly increasing.");
+          return false;
+        }
+        axis += count * sizeof(double);
+      }
+      return true;
+    }
+
+    /// \brief Decode values of a volumetric grid file.
+    /// \param[in] _data The encoded values.
+    /// \param[in] _header Header of the file, which holds the encoding.
+    /// \param[in] _count Number of values.
+    /// \param[out] _values The decoded values.
+    template<typename V>
+    void DecodeVolumetricGridValues(
+      const uint8_t *_data, const VolumetricGridFileHeader &_header,
+      std::size_t _count, V *_values)
+    {
+      switch (static_cast<VolumetricGridEncoding>(_header.encoding))
+      {
+        case VolumetricGridEncoding::FLOAT16:
+          for (std::size_t i = 0; i < _count; ++i)
+          {
+            uint16_t value;
+            std::memcpy(&value, _data + i * sizeof(value), sizeof(value));
+            _values[i] = static_cast<V>(HalfToFloat(value));
+          }
+          break;
+        case VolumetricGridEncoding::QUANTIZED16:
+          for (std::size_t i = 0; i < _count; ++i)
+          {
+            int16_t value;
+            std::memcpy(&value, _data + i * sizeof(value), sizeof(value));
+            _values[i] = value == kVolumetricGridMissingQuantized ?
+              std::numeric_limits<V>::quiet_NaN() :
+              static_cast<V>(_header.scale * value + _header.offset);
+          }
+          break;
+        case VolumetricGridEncoding::FLOAT32:
+          for (std::size_t i = 0; i < _count; ++i)
+          {
+            float value;
+            std::memcpy(&value, _data + i * sizeof(value), sizeof(value));
+            _values[i] = static_cast<V>(value);
+          }
+          break;
+        case VolumetricGridEncoding::FLOAT64:
+          for (std::size_t i = 0; i < _count; ++i)
+          {
+            double value;
+            std::memcpy(&value, _data + i * sizeof(value), sizeof(value));
+            _values[i] = static_cast<V>(value);
+          }
+          break;
+        default:
+          break;
+      }
+    }
+
+    /// \brief Encode values for a volumetric grid file.
+    /// \param[in] _values The values.
+    /// \param[in] _header Header of the file, which holds the encoding.
+    /// \param[in] _count Number of values.
+    /// \param[out] _data The encoded values.
+    template<typename V>
+    void EncodeVolumetricGridValues(
+      const V *_values, const VolumetricGridFileHeader &_header,
+      std::size_t _count, uint8_t *_data)
+    {
+      switch (static_cast<VolumetricGridEncoding>(_header.encoding))
+      {
+        case VolumetricGridEncoding::FLOAT16:
+          for (std::size_t i = 0; i < _count; ++i)
+          {
+            const uint16_t value =
+              FloatToHalf(static_cast<float>(_values[i]));
+            std::memcpy(_data + i * sizeof(value), &value, sizeof(value));
+          }
+          break;
+        case VolumetricGridEncoding::QUANTIZED16:
+          for (std::size_t i = 0; i < _count; ++i)
+          {
+            int16_t value = kVolumetricGridMissingQuantized;
+            if (!std::isnan(_values[i]))
+            {
+              const double q = std::round(
+                (static_cast<double>(_values[i]) - _header.offset) /
+                _header.scale);
+              value = static_cast<int16_t>(std::clamp(q, -32767.0, 32767.0));
+            }
+            std::memcpy(_data + i * sizeof(value), &value, sizeof(value));
+          }
+          break;
+        case VolumetricGridEncoding::FLOAT32:
+          for (std::size_t i = 0; i < _count; ++i)
+          {
+            const float value = static_cast<float>(_values[i]);
+            std::memcpy(_data + i * sizeof(value), &value, sizeof(value));
+          }
+          break;
+        case VolumetricGridEncoding::FLOAT64:
+          for (std::size_t i = 0; i < _count; ++i)
+          {
+            const double value = static_cast<double>(_values[i]);
+            std::memcpy(_data + i * sizeof(value), &value, sizeof(value));
+          }
+          break;
+        default:
+          break;
+      }
+    }
+  }  // namespace detail
+
+  /// \brief Write a time varying field sampled on a dense grid to a
+  /// volumetric grid file, see VolumetricGridFileHeader.
+  /// \param[in] _path Path of the file to write.
+  /// \param[in] _x The distinct positions along the x axis.
+  /// \param[in] _y The distinct positions along the y axis.
+  /// \param[in] _z The distinct positions along the z axis.
+  /// \param[in] _times The times of the frames, in increasing order.
+  /// \param[in] _values The values of every frame, one after the other.
+  /// The values of a frame have x varying fastest, then y, then z, following
+  /// the order of the axis arrays. Use NaN for missing values.
+  /// \param[in] _encoding Encoding of the values in the file. The 16 bit
+  /// encodings halve the size of the file at the cost of precision.
+  /// \param[in] _tileSize Number of points along the x, y and z axes of a
+  /// tile. Queries load whole tiles, so smaller tiles load less unused data
+  /// while larger ones need fewer reads along a path.
+  /// \return True on success. Otherwise an error is logged.
+  template<typename V>
+  bool WriteVolumetricGridFile(
+    const std::string &_path,
+    const std::vector<double> &_x,
+    const std::vector<double> &_y,
+    const std::vector<double> &_z,
+    const std::vector<double> &_times,
+    const std::vector<V> &_values,
+    VolumetricGridEncoding _encoding = VolumetricGridEncoding::FLOAT32,
+    const std::array<uint32_t, 3> &_tileSize = {{16, 16, 16}})
+  {
+    const std::size_t frameSize = _x.size() * _y.size() * _z.size();
+    if (frameSize == 0 || _times.empty() ||
+        _values.size() != frameSize * _times.size())
+    {
+      detail::LogErrorMessage("WriteVolumetricGridFile() error: the number "
+          "of values does not match the axes.");
+      return false;
+    }
+    for (const auto *axis : {&_x, &_y, &_z, &_times})
+    {
+      if (!detail::VolumetricGridAxisIncreasing(
+            reinterpret_cast<const uint8_t *>(axis->data()), axis->size()))
+      {
+        detail::LogErrorMessage("WriteVolumetricGridFile() error: the axes "
+            "and the times must be strictly increasing.");
+        return false;
+      }
+    }
+    const auto encoding = static_cast<uint32_t>(_encoding);
+    const std::size_t valueSize = detail::VolumetricGridValueSize(encoding);
+    if (valueSize == 0 ||
+        _tileSize[0] == 0 || _tileSize[1] == 0 || _tileSize[2] == 0)
+    {
+      detail::LogErrorMessage("WriteVolumetricGridFile() error: invalid "
+          "encoding or tile size.");
+      return false;
+    }
+
+    VolumetricGridFileHeader header{};
+    std::memcpy(header.magic, "GZMGRID", 8);
+    header.version = detail::kVolumetricGridFileVersion;
+    header.byteOrder = detail::kVolumetricGridByteOrder;
+    header.encoding = encoding;
+    header.size[0] = _x.size();
+    header.size[1] = _y.size();
+    header.size[2] = _z.size();
+    header.frames = _times.size();
+    for (int i = 0; i < 3; ++i)
+      header.tileSize[i] = _tileSize[i];
+    header.scale = 1.0;
+    header.offset = 0.0;
+    if (_encoding == VolumetricGridEncoding::QUANTIZED16)
+    {
+      // Map the range of the values to [-32767, 32767].
+      double minValue = std::numeric_limits<double>::infinity();
+      double maxValue = -minValue;
+      for (const auto &value : _values)
+      {
+        if (std::isfinite(value))
+        {
+          minValue = std::min(minValue, static_cast<double>(value));
+          maxValue = std::max(maxValue, static_cast<double>(value));
+        }
+      }
+      if (minValue <= maxValue)
+      {
+        header.offset = 0.5 * (minValue + maxValue);
+        if (maxValue > minValue)
+          header.scale = (maxValue - minValue) / (2 * 32767.0);
+      }
+    }
+    header.axesOffset = sizeof(header);
+    const uint64_t axesEnd = header.axesOffset + sizeof(double) *
+      (_x.size() + _y.size() + _z.size() + _times.size());
+    const uint64_t align = detail::kVolumetricGridValuesAlignment;
+    header.valuesOffset = (axesEnd + align - 1) / align * align;
+    const std::size_t tileVolume =
+      std::size_t{_tileSize[0]} * _tileSize[1] * _tileSize[2];
+    // Keep every tile aligned to a cache line.
+    header.tileStride = (tileVolume * valueSize + 63) / 64 * 64;
+    const auto counts = detail::VolumetricGridTileCounts(header);
+    header.frameStride =
+      counts[0] * counts[1] * counts[2] * header.tileStride;
+
+    std::ofstream out(_path, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+      detail::LogErrorMessage("WriteVolumetricGridFile() error: cannot open "
+          "[" + _path + "].");
+      return false;
+    }
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (const auto *axis : {&_x, &_y, &_z, &_times})
+    {
+      out.write(reinterpret_cast<const char *>(axis->data()),
+        static_cast<std::streamsize>(axis->size() * sizeof(double)));
+    }
+    const std::vector<char> padding(header.valuesOffset - axesEnd, 0);
+    out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+
+    std::vector<V> tile(tileVolume);
+    std::vector<uint8_t> encoded(header.tileStride, 0);
+    for (std::size_t f = 0; f < _times.size(); ++f)
+    {
+      const V *frame = _values.data() + f * frameSize;
+      for (uint64_t tz = 0; tz < counts[2]; ++tz)
+      {
+        for (uint64_t ty = 0; ty < counts[1]; ++ty)
+        {
+          for (uint64_t tx = 0; tx < counts[0]; ++tx)
+          {
+            std::size_t i = 0;
+            for (uint64_t lz = 0; lz < _tileSize[2]; ++lz)
+            {
+              const uint64_t z = tz * _tileSize[2] + lz;
+              for (uint64_t ly = 0; ly < _tileSize[1]; ++ly)
+              {
+                const uint64_t y = ty * _tileSize[1] + ly;
+                for (uint64_t lx = 0; lx < _tileSize[0]; ++lx, ++i)
+                {
+                  const uint64_t x = tx * _tileSize[0] + lx;
+                  tile[i] = (x < _x.size() && y < _y.size() && z < _z.size()) ?
+                    frame[(z * _y.size() + y) * _x.size() + x] :
+                    std::numeric_limits<V>::quiet_NaN();
+                }
+              }
+            }
+            detail::EncodeVolumetricGridValues(
+              tile.data(), header, tileVolume, encoded.data());
+            out.write(reinterpret_cast<const char *>(encoded.data()),
+              static_cast<std::streamsize>(encoded.size()));
+          }
+        }
+      }
+    }
+
+    if (!out)
+    {
+      detail::LogErrorMessage("WriteVolumetricGridFile() error: cannot write "
+          "[" + _path + "].");
+      return false;
+    }
+    return true;
+  }
+  }  // namespace GZ_MATH_VERSION_NAMESPACE
+}  // namespace gz::math
+#endif  // GZ_MATH_VOLUMETRIC_GRID_FILE_HH_
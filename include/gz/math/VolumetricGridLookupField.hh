@@ -18,6 +18,7 @@
 #ifndef GZ_MATH_VOLUMETRIC_GRID_LOOKUP_FIELD_HH_
 #define GZ_MATH_VOLUMETRIC_GRID_LOOKUP_FIELD_HH_
 
+#include <array>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -26,11 +27,23 @@
 #include <gz/math/detail/InterpolationPoint.hh>
 
 #include <gz/math/detail/AxisIndex.hh>
+#include <gz/math/detail/ParallelFor.hh>
 
 namespace gz::math
 {
   // Inline bracket to help doxygen filtering.
   inline namespace GZ_MATH_VERSION_NAMESPACE {
+    /// \brief Remembers the grid cell found by the last query of a
+    /// VolumetricGridLookupField, so that the next query can skip the axis
+    /// searches if it falls in the same cell. Keep one per sequence of
+    /// nearby queries, e.g., one per vehicle. Any state is valid, a stale
+    /// hint only costs a regular search.
+    struct VolumetricGridLookupHint
+    {
+      /// \brief Position found along each axis by the last query.
+      std::array<std::size_t, 3> positions{{0, 0, 0}};
+    };
+
     template<typename T, typename I = std::size_t>
     /// \brief Lookup table for a volumetric dataset. This class is used to
     /// lookup indices for a large dataset that's organized in a grid. This
@@ -45,8 +58,23 @@ namespace gz::math
 
       private: AxisIndex<T> y_indices_by_lon;
 
-      private: std::vector<
-        std::vector<std::vector<std::optional<I>>>> index_table;
+      /// \brief Index of each grid point, stored contiguously with x
+      /// varying fastest, then y, then z. Points missing from a sparse grid
+      /// are nullopt.
+      private: std::vector<std::optional<I>> index_table;
+
+      /// \brief Number of points along the x axis of index_table.
+      private: std::size_t x_stride{0};
+
+      /// \brief Number of points in one z layer of index_table.
+      private: std::size_t z_stride{0};
+
+      /// \brief True if the grid has every point and indexes them in
+      /// table order, in which case index_table is left empty.
+      private: bool dense{false};
+
+      /// \brief Index of the first point of a dense grid.
+      private: I first_index{0};
 
       /// \brief Constructor
       /// \param[in] _cloud The cloud of points to use to construct the grid.
@@ -65,19 +93,7 @@ namespace gz::math
           z_indices_by_depth.AddIndexIfNotFound(pt.Z());
         }
 
-        int num_x = x_indices_by_lat.GetNumUniqueIndices();
-        int num_y = y_indices_by_lon.GetNumUniqueIndices();
-        int num_z = z_indices_by_depth.GetNumUniqueIndices();
-
-        index_table.resize(num_z);
-        for(int i = 0; i < num_z; ++i)
-        {
-          index_table[i].resize(num_y);
-          for(int j = 0; j < num_y; ++j)
-          {
-            index_table[i][j].resize(num_x);
-          }
-        }
+        ResizeTable();
 
         for(std::size_t i = 0; i < _cloud.size(); ++i)
         {
@@ -88,7 +104,7 @@ namespace gz::math
             y_indices_by_lon.GetIndex(pt.Y()).value();
           const std::size_t z_index =
             z_indices_by_depth.GetIndex(pt.Z()).value();
-          index_table[z_index][y_index][x_index] = i;
+          index_table[TableIndex(x_index, y_index, z_index)] = i;
         }
       }
 
@@ -125,7 +141,7 @@ namespace gz::math
             for(const auto &z_index : z_indices)
             {
               auto index =
-                index_table[z_index.index][y_index.index][x_index.index];
+                PointIndex(x_index.index, y_index.index, z_index.index);
               interpolators.push_back(
                 InterpolationPoint3D<T>{
                   Vector3<T>(
@@ -142,6 +158,54 @@ namespace gz::math
         return interpolators;
       }
 
+      /// \brief Retrieves the points to be used for interpolation, like the
+      /// other overload, but without allocating memory and starting from
+      /// the cell found by the previous query.
+      /// \param[in] _pt The point to get the interpolators for.
+      /// \param[out] _cell The interpolation points, in the same order as
+      /// the other overload.
+      /// \param[in,out] _hint The cell of the previous query, updated with
+      /// the cell of this one.
+      /// \param[in] _xTol The tolerance for the x axis.
+      /// \param[in] _yTol The tolerance for the y axis.
+      /// \param[in] _zTol The tolerance for the z axis.
+      public: void GetInterpolators(
+          const Vector3<T> &_pt,
+          InterpolationCell3D<T> &_cell,
+          VolumetricGridLookupHint &_hint,
+          const double _xTol = 1e-6,
+          const double _yTol = 1e-6,
+          const double _zTol = 1e-6) const
+      {
+        std::array<InterpolationPoint1D<T>, 2> x_indices;
+        std::array<InterpolationPoint1D<T>, 2> y_indices;
+        std::array<InterpolationPoint1D<T>, 2> z_indices;
+        const std::size_t num_x = x_indices_by_lat.GetInterpolators(
+          _pt.X(), x_indices, _hint.positions[0], _xTol);
+        const std::size_t num_y = y_indices_by_lon.GetInterpolators(
+          _pt.Y(), y_indices, _hint.positions[1], _yTol);
+        const std::size_t num_z = z_indices_by_depth.GetInterpolators(
+          _pt.Z(), z_indices, _hint.positions[2], _zTol);
+
+        _cell.count = 0;
+        for (std::size_t i = 0; i < num_x; ++i)
+        {
+          for (std::size_t j = 0; j < num_y; ++j)
+          {
+            for (std::size_t k = 0; k < num_z; ++k)
+            {
+              auto &point = _cell.points[_cell.count++];
+              point.position.Set(
+                x_indices[i].position,
+                y_indices[j].position,
+                z_indices[k].position);
+              point.index = PointIndex(
+                x_indices[i].index, y_indices[j].index, z_indices[k].index);
+            }
+          }
+        }
+      }
+
       /// \brief Constructor
       /// \param[in] _cloud The cloud of points to use to construct the grid.
       /// \param[in] _indices A series of indices these points correspond to.
@@ -162,19 +226,7 @@ namespace gz::math
           z_indices_by_depth.AddIndexIfNotFound(pt.Z());
         }
 
-        int num_x = x_indices_by_lat.GetNumUniqueIndices();
-        int num_y = y_indices_by_lon.GetNumUniqueIndices();
-        int num_z = z_indices_by_depth.GetNumUniqueIndices();
-
-        index_table.resize(num_z);
-        for(int i = 0; i < num_z; ++i)
-        {
-          index_table[i].resize(num_y);
-          for(int j = 0; j < num_y; ++j)
-          {
-            index_table[i][j].resize(num_x);
-          }
-        }
+        ResizeTable();
 
         for(std::size_t i = 0; i < _cloud.size(); ++i)
         {
@@ -185,10 +237,42 @@ namespace gz::math
             y_indices_by_lon.GetIndex(pt.Y()).value();
           const std::size_t z_index =
             z_indices_by_depth.GetIndex(pt.Z()).value();
-          index_table[z_index][y_index][x_index] = _indices[i];
+          index_table[TableIndex(x_index, y_index, z_index)] =
+            _indices[i];
         }
       }
 
+      /// \brief Constructor for a dense grid, which has a point at every
+      /// combination of the axis positions. The index of a point is its
+      /// position in a table of values with x varying fastest, then y, then
+      /// z, following the order of the axis arrays. No index table is
+      /// stored, which suits grids too large to keep in memory.
+      /// \param[in] _x The distinct positions along the x axis.
+      /// \param[in] _y The distinct positions along the y axis.
+      /// \param[in] _z The distinct positions along the z axis.
+      /// \param[in] _firstIndex Index of the first point, for grids whose
+      /// values are stored after others.
+      public: VolumetricGridLookupField(
+        const std::vector<T> &_x,
+        const std::vector<T> &_y,
+        const std::vector<T> &_z,
+        const I _firstIndex = I(0))
+        : dense(true), first_index(_firstIndex)
+      {
+        for (const auto &x : _x)
+          x_indices_by_lat.AddIndexIfNotFound(x);
+        for (const auto &y : _y)
+          y_indices_by_lon.AddIndexIfNotFound(y);
+        for (const auto &z : _z)
+          z_indices_by_depth.AddIndexIfNotFound(z);
+        assert(x_indices_by_lat.GetNumUniqueIndices() == _x.size());
+        assert(y_indices_by_lon.GetNumUniqueIndices() == _y.size());
+        assert(z_indices_by_depth.GetNumUniqueIndices() == _z.size());
+
+        x_stride = _x.size();
+        z_stride = x_stride * _y.size();
+      }
+
       /// \brief Estimates the values for a grid given a list of values to
       /// interpolate. This method uses Trilinear interpolation.
       /// \param[in] _pt The point to estimate for.
@@ -202,12 +286,8 @@ namespace gz::math
         const std::vector<V> &_values,
         const V &_default = V(0)) const
       {
-        auto interpolators = GetInterpolators(_pt);
-        return EstimateValueUsingTrilinear(
-          interpolators,
-          _pt,
-          _values,
-          _default);
+        VolumetricGridLookupHint hint;
+        return EstimateValueUsingTrilinear(_pt, _values, hint, _default);
       }
 
       /// \brief Estimates the values for a grid given a list of values to
@@ -261,6 +341,122 @@ namespace gz::math
         }
       }
 
+      /// \brief Allocate index_table for the points registered in the axes.
+      private: void ResizeTable()
+      {
+        x_stride = x_indices_by_lat.GetNumUniqueIndices();
+        z_stride = x_stride * y_indices_by_lon.GetNumUniqueIndices();
+        index_table.assign(
+          z_stride * z_indices_by_depth.GetNumUniqueIndices(), std::nullopt);
+      }
+
+      /// \brief Get the position of a grid point in index_table.
+      /// \param[in] _x Index of the point along the x axis.
+      /// \param[in] _y Index of the point along the y axis.
+      /// \param[in] _z Index of the point along the z axis.
+      /// \return The position in index_table.
+      private: std::size_t TableIndex(
+        std::size_t _x, std::size_t _y, std::size_t _z) const
+      {
+        return _z * z_stride + _y * x_stride + _x;
+      }
+
+      /// \brief Get the index of a grid point.
+      /// \param[in] _x Index of the point along the x axis.
+      /// \param[in] _y Index of the point along the y axis.
+      /// \param[in] _z Index of the point along the z axis.
+      /// \return The index of the point, nullopt if it is missing.
+      private: std::optional<I> PointIndex(
+        std::size_t _x, std::size_t _y, std::size_t _z) const
+      {
+        if (dense)
+          return static_cast<I>(first_index + TableIndex(_x, _y, _z));
+        return index_table[TableIndex(_x, _y, _z)];
+      }
+
+      /// \brief Estimates the value at a point like the other overloads,
+      /// without allocating memory and starting from the cell found by the
+      /// previous query.
+      /// \param[in] _pt The point to estimate for.
+      /// \param[in] _values The values to interpolate.
+      /// \param[in,out] _hint The cell of the previous query, updated with
+      /// the cell of this one.
+      /// \param[in] _default If a value is not found at a specific point then
+      /// this value will be used.
+      /// \returns The estimated value for the point. Nullopt if we are
+      /// outside the field.
+      public: template<typename V>
+      std::optional<V> EstimateValueUsingTrilinear(
+        const Vector3<T> &_pt,
+        const std::vector<V> &_values,
+        VolumetricGridLookupHint &_hint,
+        const V &_default = V(0)) const
+      {
+        InterpolationCell3D<T> cell;
+        GetInterpolators(_pt, cell, _hint);
+        return EstimateValueUsingTrilinear(cell, _pt, _values, _default);
+      }
+
+      /// \brief Estimates the value at a point from interpolators retrieved
+      /// with the allocation free GetInterpolators().
+      /// \param[in] _cell The interpolation points.
+      /// \param[in] _pt The point to estimate for.
+      /// \param[in] _values The values to interpolate.
+      /// \param[in] _default If a value is not found at a specific point then
+      /// this value will be used.
+      /// \returns The estimated value for the point. Nullopt if we are
+      /// outside the field.
+      public: template<typename V>
+      std::optional<V> EstimateValueUsingTrilinear(
+        const InterpolationCell3D<T> &_cell,
+        const Vector3<T> &_pt,
+        const std::vector<V> &_values,
+        const V &_default = V(0)) const
+      {
+        std::array<V, 8> values;
+        for (std::size_t i = 0; i < _cell.count; ++i)
+        {
+          const auto &point = _cell.points[i];
+          values[i] = point.index.has_value() ?
+            _values[point.index.value()] : _default;
+        }
+        return detail::InterpolateCell(_cell, values.data(), _pt);
+      }
+
+      /// \brief Estimates the values at many points. Consecutive points
+      /// that fall in the same cell, e.g., samples along a trajectory, reuse
+      /// the cell of the previous one.
+      /// \param[in] _points The points to estimate for.
+      /// \param[in] _values The values to interpolate.
+      /// \param[out] _results The estimated value of each point, nullopt
+      /// for the points outside of the field.
+      /// \param[in] _default If a value is not found at a specific point then
+      /// this value will be used.
+      /// \param[in] _threads Number of threads. 0 uses the number of
+      /// hardware threads.
+      public: template<typename V>
+      void EstimateValuesUsingTrilinear(
+        const std::vector<Vector3<T>> &_points,
+        const std::vector<V> &_values,
+        std::vector<std::optional<V>> &_results,
+        const V &_default = V(0),
+        unsigned int _threads = 1) const
+      {
+        _results.resize(_points.size());
+        const unsigned int threads = detail::ThreadCount(
+          _threads, _points.size());
+        detail::ParallelFor(_points.size(), threads,
+          [&](std::size_t _begin, std::size_t _end, unsigned int)
+          {
+            VolumetricGridLookupHint hint;
+            for (std::size_t i = _begin; i < _end; ++i)
+            {
+              _results[i] = EstimateValueUsingTrilinear(
+                _points[i], _values, hint, _default);
+            }
+          });
+      }
+
       /// \brief Get the bounds of this grid field.
       /// \return A pair of vectors.
       public: std::pair<Vector3<T>, Vector3<T>> Bounds() const
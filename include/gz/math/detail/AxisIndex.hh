@@ -19,7 +19,8 @@
 #define GZ_MATH_DETAIL_AXIS_INDEX_LOOKUP_FIELD_HH_
 
 #include <algorithm>
-#include <map>
+#include <array>
+#include <cmath>
 #include <optional>
 #include <vector>
 
@@ -34,47 +35,87 @@ namespace gz::math
 
     /// \brief Represents a sparse number line which can be searched via
     /// search for indices.
+    ///
+    /// The keys are kept in a sorted vector, next to the index each one was
+    /// registered with. When the keys are evenly spaced, which is the case
+    /// for most gridded datasets, lookups start from an arithmetic guess of
+    /// the position instead of a binary search.
     template <typename T>
     class AxisIndex
     {
-      /// \brief Binary tree with indices
-      private: std::map<T, std::size_t> axisIndex;
+      /// \brief Sorted keys
+      private: std::vector<T> keys;
 
-      /// \brief Number of indices
-      private: int numIndices{0};
+      /// \brief Index registered for each key of keys
+      private: std::vector<std::size_t> indices;
+
+      /// \brief True if the keys are evenly spaced
+      private: bool uniform{true};
+
+      /// \brief Distance between consecutive keys when uniform is true
+      private: double spacing{0.0};
 
       /// \brief Minimum key
       /// \return the minimum key or zero if the axis is empty.
       public: T MinKey() const
       {
-        auto key = axisIndex.begin();
-        if (key == axisIndex.end())
+        if (keys.empty())
         {
           return T(0);
         }
-        return key->first;
+        return keys.front();
       }
 
       /// \brief Maximum key
       /// \return the maximum key or zero if the axis is empty.
       public: T MaxKey() const
       {
-        auto key = axisIndex.rbegin();
-        if (key == axisIndex.rend())
+        if (keys.empty())
         {
           return T(0);
         }
-        return key->first;
+        return keys.back();
       }
 
       /// \brief Register the existence of a measurement at _value.
       /// \param[in] _value The position of the measurement.
       public: void AddIndexIfNotFound(T _value)
       {
-        if (axisIndex.find(_value) == axisIndex.end())
+        const std::size_t pos = LowerBound(_value);
+        if (pos < keys.size() && !(_value < keys[pos]))
+        {
+          return;
+        }
+
+        const std::size_t index = keys.size();
+        keys.insert(keys.begin() + pos, _value);
+        indices.insert(indices.begin() + pos, index);
+
+        // Appending to an uneven axis cannot make it even, and appending to
+        // an even one only needs the new gap to be checked. Any other
+        // insertion needs a full check.
+        if (keys.size() == 2)
         {
-          axisIndex[_value] = numIndices;
-          numIndices++;
+          spacing = static_cast<double>(keys[1]) - keys[0];
+        }
+        else if (keys.size() > 2)
+        {
+          if (pos == 0 || pos + 1 == keys.size())
+          {
+            const double gap = (pos == 0) ?
+              static_cast<double>(keys[1]) - keys[0] :
+              static_cast<double>(keys[pos]) - keys[pos - 1];
+            uniform = uniform && IsSpacing(gap);
+          }
+          else
+          {
+            spacing = static_cast<double>(keys[1]) - keys[0];
+            uniform = true;
+            for (std::size_t i = 2; i < keys.size() && uniform; ++i)
+            {
+              uniform = IsSpacing(static_cast<double>(keys[i]) - keys[i - 1]);
+            }
+          }
         }
       }
 
@@ -82,7 +123,15 @@ namespace gz::math
       /// \return The number of unique indices.
       public: std::size_t GetNumUniqueIndices() const
       {
-        return axisIndex.size();
+        return keys.size();
+      }
+
+      /// \brief Check whether the keys are evenly spaced, in which case
+      /// lookups take constant time.
+      /// \return True if the keys are evenly spaced.
+      public: bool IsUniform() const
+      {
+        return uniform;
       }
 
       /// \brief Get the index of a measurement
@@ -90,15 +139,12 @@ namespace gz::math
       /// \return The index of the measurement if found else return nullopt.
       public: std::optional<std::size_t> GetIndex(T _value) const
       {
-        auto res = axisIndex.find(_value);
-        if (res == axisIndex.end())
+        const std::size_t pos = LowerBound(_value);
+        if (pos == keys.size() || _value < keys[pos])
         {
           return std::nullopt;
         }
-        else
-        {
-          return res->second;
-        }
+        return indices[pos];
       }
 
       /// \brief Get interpolators for a measurement.
@@ -112,34 +158,117 @@ namespace gz::math
       public: std::vector<InterpolationPoint1D<T>> GetInterpolators(
         const T &_value,
         double _tol = 1e-6) const
+      {
+        std::array<InterpolationPoint1D<T>, 2> interpolators;
+        std::size_t hint = 0;
+        const std::size_t count =
+          GetInterpolators(_value, interpolators, hint, _tol);
+        return std::vector<InterpolationPoint1D<T>>(
+          interpolators.begin(), interpolators.begin() + count);
+      }
+
+      /// \brief Get interpolators for a measurement without allocating
+      /// memory.
+      /// \param[in] _value The position of the measurement.
+      /// \param[out] _interpolators The interpolators, as returned by the
+      /// other overload. Only the first ones, up to the returned count, are
+      /// set.
+      /// \param[in,out] _hint Position found by a previous lookup. It is
+      /// checked before searching, so queries that stay between the same
+      /// two keys skip the search. Any value is valid, and it is updated
+      /// with the new position.
+      /// \param[in] _tol The tolerance for the search. Cannot be zero.
+      /// \return The number of interpolators: 0 if the value is out of
+      /// range, 1 for an exact match, 2 otherwise.
+      public: std::size_t GetInterpolators(
+        const T &_value,
+        std::array<InterpolationPoint1D<T>, 2> &_interpolators,
+        std::size_t &_hint,
+        double _tol = 1e-6) const
       {
         assert(_tol > 0);
-        // Performs a BST to find the first element that is greater than or
-        // equal to the value.
-        auto it = axisIndex.lower_bound(_value);
-        if (it == axisIndex.end())
+        // Find the first element that is greater than or equal to the
+        // value.
+        std::size_t pos = _hint;
+        if (pos == 0 || pos >= keys.size() ||
+            !(keys[pos - 1] < _value) || keys[pos] < _value)
+        {
+          pos = LowerBound(_value);
+          _hint = pos;
+        }
+
+        if (pos == keys.size())
         {
           // Out of range
-          return {};
+          return 0;
         }
-        else if (fabs(it->first - _value) < _tol)
+        else if (fabs(keys[pos] - _value) < _tol)
         {
           // Exact match
-          return {InterpolationPoint1D<T>{it->first, it->second}};
+          _interpolators[0] = InterpolationPoint1D<T>{keys[pos], indices[pos]};
+          return 1;
         }
-        else if (it == axisIndex.begin())
+        else if (pos == 0)
         {
           // Below range
-          return {};
+          return 0;
         }
         else
         {
           // Interpolate
-          auto itPrev = it;
-          itPrev--;
-          return {InterpolationPoint1D<T>{itPrev->first, itPrev->second},
-            InterpolationPoint1D<T>{it->first, it->second}};
+          _interpolators[0] =
+            InterpolationPoint1D<T>{keys[pos - 1], indices[pos - 1]};
+          _interpolators[1] = InterpolationPoint1D<T>{keys[pos], indices[pos]};
+          return 2;
+        }
+      }
+
+      /// \brief Check whether a gap matches the spacing of an even axis.
+      /// The tolerance only affects the speed of the lookups, which are
+      /// exact either way.
+      /// \param[in] _gap Distance between two consecutive keys.
+      /// \return True if the gap matches the spacing.
+      private: bool IsSpacing(double _gap) const
+      {
+        return fabs(_gap - spacing) <= 1e-6 * fabs(spacing);
+      }
+
+      /// \brief Position of the first key that is not less than a value,
+      /// with the same result as std::lower_bound.
+      /// \param[in] _value The value to search for.
+      /// \return The position in keys, or keys.size() if all the keys are
+      /// less than the value.
+      private: std::size_t LowerBound(const T &_value) const
+      {
+        if (!uniform || keys.size() < 2)
+        {
+          return static_cast<std::size_t>(
+            std::lower_bound(keys.begin(), keys.end(), _value) -
+            keys.begin());
+        }
+
+        // Guess from the spacing, then step to the exact position, which
+        // is at most one key away unless the keys drift from the spacing.
+        const double guess =
+          (static_cast<double>(_value) - keys.front()) / spacing;
+        std::size_t pos = 0;
+        if (guess >= static_cast<double>(keys.size()))
+        {
+          pos = keys.size();
+        }
+        else if (guess > 0)
+        {
+          pos = static_cast<std::size_t>(std::ceil(guess));
+        }
+        while (pos > 0 && !(keys[pos - 1] < _value))
+        {
+          --pos;
+        }
+        while (pos < keys.size() && keys[pos] < _value)
+        {
+          ++pos;
         }
+        return pos;
       }
     };
   }  // namespace GZ_MATH_VERSION_NAMESPACE
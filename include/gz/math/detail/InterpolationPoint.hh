@@ -21,6 +21,7 @@
 #include <gz/math/Vector3.hh>
 #include <gz/math/Vector2.hh>
 
+#include <array>
 #include <optional>
 #include <vector>
 
@@ -41,6 +42,21 @@ namespace gz::math
     std::optional<std::size_t> index;
   };
 
+  /// \brief Fixed capacity list of the interpolation points of a grid
+  /// cell, filled without allocating memory. The points follow the same
+  /// order as the std::vector returned by
+  /// VolumetricGridLookupField::GetInterpolators().
+  template<typename T>
+  struct InterpolationCell3D
+  {
+    /// \brief The interpolation points. Only the first `count` are valid.
+    std::array<InterpolationPoint3D<T>, 8> points;
+
+    /// \brief Number of valid points: 0 if the query was outside of the
+    /// grid, otherwise 1, 2, 4 or 8.
+    std::size_t count{0};
+  };
+
   /// \brief Describes a 4D interpolation point.
   template<typename T, typename V>
   struct InterpolationPoint4D
@@ -91,6 +107,138 @@ namespace gz::math
     return (1 - t) * _lst[_b.index] + t * _lst[_a.index];
   }
 
+  // Inline bracket to help doxygen filtering.
+  inline namespace GZ_MATH_VERSION_NAMESPACE {
+  namespace detail {
+    /// \brief Linear interpolation between two positions. Shared by the
+    /// interpolators below and by the allocation free code paths, so that
+    /// both give bit-for-bit identical results.
+    /// \param[in] _aPos Position of the first value.
+    /// \param[in] _aVal The first value.
+    /// \param[in] _bPos Position of the second value.
+    /// \param[in] _bVal The second value.
+    /// \param[in] _pos The position to interpolate.
+    /// \return The interpolated value.
+    template<typename T, typename V>
+    V LinearInterpolate(
+      const Vector3<T> &_aPos, const V &_aVal,
+      const Vector3<T> &_bPos, const V &_bVal,
+      const Vector3<T> &_pos)
+    {
+      auto t = (_pos - _bPos).Length() / (_aPos - _bPos).Length();
+      return (1 - t) * _bVal + t * _aVal;
+    }
+
+    /// \brief Bilinear interpolation of the four corners of a rectangle,
+    /// ordered so that _pos[0], _pos[1] and _pos[2], _pos[3] are edges.
+    /// \param[in] _corners Positions of the corners.
+    /// \param[in] _values Values at the corners.
+    /// \param[in] _pos The position to interpolate.
+    /// \return The interpolated value.
+    template<typename T, typename V>
+    V BiLinearInterpolate(
+      const Vector3<T> *_corners, const V *_values, const Vector3<T> &_pos)
+    {
+      // Project point onto line
+      auto proj1 = _corners[1] - _corners[0];
+      auto unitProj1 = proj1.Normalized();
+      auto pos1 =
+        (_pos - _corners[0]).Dot(unitProj1) * unitProj1 + _corners[0];
+      const V res1 = LinearInterpolate(
+        _corners[0], _values[0], _corners[1], _values[1], pos1);
+
+      // Project point onto second line
+      auto pos2 =
+        (_pos - _corners[2]).Dot(unitProj1) * unitProj1 + _corners[2];
+      const V res2 = LinearInterpolate(
+        _corners[2], _values[2], _corners[3], _values[3], pos2);
+
+      // Perform final linear interpolation
+      return LinearInterpolate(pos1, res1, pos2, res2, _pos);
+    }
+
+    /// \brief Project a point onto the plane of three points.
+    /// \param[in] _points The three points defining the plane.
+    /// \param[in] _pos The position to project onto the plane.
+    /// \return The projected position.
+    template<typename T>
+    Vector3<T> ProjectPointToPlane(
+      const Vector3<T> *_points, const Vector3<T> &_pos)
+    {
+      auto n = (_points[1] - _points[0]).Cross(_points[2] - _points[0]);
+      auto n_unit = n.Normalized();
+      return _pos - n_unit.Dot(_pos - _points[0]) * n_unit;
+    }
+
+    /// \brief Trilinear interpolation of the eight corners of a
+    /// rectangular prism, as two faces of four corners.
+    /// \param[in] _corners Positions of the corners.
+    /// \param[in] _values Values at the corners.
+    /// \param[in] _pos The position to interpolate.
+    /// \return The interpolated value.
+    template<typename T, typename V>
+    V TrilinearInterpolate(
+      const Vector3<T> *_corners, const V *_values, const Vector3<T> &_pos)
+    {
+      auto pos1 = ProjectPointToPlane(_corners, _pos);
+      const V res1 = BiLinearInterpolate(_corners, _values, pos1);
+      auto pos2 = ProjectPointToPlane(_corners + 4, _pos);
+      const V res2 = BiLinearInterpolate(_corners + 4, _values + 4, pos2);
+      return LinearInterpolate(pos1, res1, pos2, res2, _pos);
+    }
+
+    /// \brief Interpolate the points of a grid cell.
+    /// \param[in] _cell The interpolation points.
+    /// \param[in] _values Value of each point of the cell, in the same
+    /// order.
+    /// \param[in] _pos The position to interpolate.
+    /// \return The interpolated value, nullopt if the cell is empty.
+    template<typename T, typename V>
+    std::optional<V> InterpolateCell(
+      const InterpolationCell3D<T> &_cell, const V *_values,
+      const Vector3<T> &_pos)
+    {
+      std::array<Vector3<T>, 8> corners;
+      for (std::size_t i = 0; i < _cell.count; ++i)
+        corners[i] = _cell.points[i].position;
+
+      switch (_cell.count)
+      {
+        case 1:
+          return _values[0];
+        case 2:
+          return LinearInterpolate(
+            corners[0], _values[0], corners[1], _values[1], _pos);
+        case 4:
+          return BiLinearInterpolate(corners.data(), _values, _pos);
+        case 8:
+          return TrilinearInterpolate(corners.data(), _values, _pos);
+        default:
+          return std::nullopt;
+      }
+    }
+
+    /// \brief Linear interpolation between two times, with the same
+    /// arithmetic as the InterpolationPoint1D overload of
+    /// LinearInterpolate().
+    /// \param[in] _aTime The first time.
+    /// \param[in] _aVal The value at the first time.
+    /// \param[in] _bTime The second time.
+    /// \param[in] _bVal The value at the second time.
+    /// \param[in] _time The time to interpolate.
+    /// \return The interpolated value.
+    template<typename T, typename V>
+    V LinearInterpolateTime(
+      const T &_aTime, const V &_aVal,
+      const T &_bTime, const V &_bVal,
+      const T &_time)
+    {
+      auto t = (_time - _bTime) / (_aTime - _bTime);
+      return (1 - t) * _bVal + t * _aVal;
+    }
+  }  // namespace detail
+  }  // namespace GZ_MATH_VERSION_NAMESPACE
+
   /// \brief Linear Interpolation of two points in 3D space
   /// \param[in] _a The first point.
   /// \param[in] _b The second point.
@@ -117,12 +265,10 @@ namespace gz::math
     assert((_a.index.has_value()) ? _a.index.value() < _lst.size(): true);
     assert((_b.index.has_value()) ? _b.index.value() < _lst.size(): true);
 
-    auto t =
-      (_pos - _b.position).Length() / (_a.position - _b.position).Length();
-
     auto b_val = (_b.index.has_value()) ? _lst[_b.index.value()]: _default;
     auto a_val = (_a.index.has_value()) ? _lst[_a.index.value()]: _default;
-    return (1 - t) * b_val + t * a_val;
+    return detail::LinearInterpolate(
+      _a.position, a_val, _b.position, b_val, _pos);
   }
 
   /// \brief Bilinear interpolation of four points in 3D space. It assumes
@@ -164,35 +310,16 @@ namespace gz::math
       );
     #endif
 
-    // Project point onto line
-    std::vector<V> linres;
-    auto n0 = _a[_start_index];
-    auto n1 = _a[_start_index + 1];
-    auto proj1 = n1.position-n0.position;
-    auto unitProj1 = proj1.Normalized();
-    auto pos1 =
-      (_pos - n0.position).Dot(unitProj1) * unitProj1 + n0.position;
-    // Apply normal linear interpolation
-    linres.push_back(LinearInterpolate(n0, n1, _lst, pos1, _default));
-
-    // Project point onto second line
-    auto n2 = _a[_start_index + 2];
-    auto n3 = _a[_start_index + 3];
-    auto pos2 =
-      (_pos - n2.position).Dot(unitProj1) * unitProj1 + n2.position;
-    linres.push_back(LinearInterpolate(n2, n3, _lst, pos2, _default));
-
-    // Perform final linear interpolation
-    InterpolationPoint3D<T> p1 {
-      pos1,
-      0
-    };
-
-    InterpolationPoint3D<T> p2 {
-      pos2,
-      1
-    };
-    return LinearInterpolate(p1, p2, linres, _pos, _default);
+    std::array<Vector3<T>, 4> corners;
+    std::array<V, 4> values;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+      const auto &point = _a[_start_index + i];
+      corners[i] = point.position;
+      values[i] = point.index.has_value() ?
+        _lst[point.index.value()] : _default;
+    }
+    return detail::BiLinearInterpolate(corners.data(), values.data(), _pos);
   }
 
   /// \brief Project Point onto a plane.
@@ -207,13 +334,12 @@ namespace gz::math
     const std::size_t &_start_index,
     const Vector3<T> &_pos)
   {
-    auto n =
-      (_points[_start_index + 1].position - _points[_start_index].position)
-      .Cross(
-      _points[_start_index + 2].position - _points[_start_index].position);
-    auto n_unit = n.Normalized();
-    return
-      _pos - n_unit.Dot(_pos - _points[_start_index].position) * n_unit;
+    const Vector3<T> points[3] = {
+      _points[_start_index].position,
+      _points[_start_index + 1].position,
+      _points[_start_index + 2].position
+    };
+    return detail::ProjectPointToPlane(points, _pos);
   }
 
   /// \brief Trilinear interpolation of eight points in 3D space. It assumes
@@ -235,26 +361,15 @@ namespace gz::math
   {
     assert(_a.size() == 8);
 
-    std::vector<V> linres;
-    // First plane
-    auto pos1 = ProjectPointToPlane<T>(_a, 0, _pos);
-    linres.push_back(BiLinearInterpolate(_a, 0, _lst, pos1, _default));
-
-    // Second plane
-    auto pos2 = ProjectPointToPlane<T>(_a, 4, _pos);
-    linres.push_back(BiLinearInterpolate(_a, 4, _lst, pos2, _default));
-
-    // Perform final linear interpolation
-    InterpolationPoint3D<T> p1 {
-      pos1,
-      0
-    };
-
-    InterpolationPoint3D<T> p2 {
-      pos2,
-      1
-    };
-    return LinearInterpolate(p1, p2, linres, _pos, _default);
+    std::array<Vector3<T>, 8> corners;
+    std::array<V, 8> values;
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+      corners[i] = _a[i].position;
+      values[i] = _a[i].index.has_value() ? _lst[_a[i].index.value()] :
+        _default;
+    }
+    return detail::TrilinearInterpolate(corners.data(), values.data(), _pos);
   }
 }  // namespace gz::math
 #endif  // GZ_MATH_INTERPOLATION_POINT_HH_
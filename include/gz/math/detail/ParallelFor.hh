@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_DETAIL_PARALLEL_FOR_HH_
+#define GZ_MATH_DETAIL_PARALLEL_FOR_HH_
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <gz/math/config.hh>
+
+namespace gz::math
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace GZ_MATH_VERSION_NAMESPACE {
+  namespace detail {
+
+    /// \brief Default grain size of ThreadCount(). It suits elements that
+    /// take in the order of a hundred nanoseconds each, such as a field
+    /// lookup or a coordinate transform.
+    constexpr std::size_t kDefaultMinPerThread = 1024;
+
+    /// \brief Number of threads worth using for a batch of work.
+    /// \param[in] _requested Requested number of threads. 0 uses the number
+    /// of concurrent threads supported by the hardware.
+    /// \param[in] _count Number of elements to process.
+    /// \param[in] _minPerThread Grain size: minimum number of elements that
+    /// justify spawning one more thread. Starting a thread costs in the order
+    /// of tens of microseconds, so each thread needs enough work to pay for
+    /// it. Use a larger value for cheaper elements and a smaller one for
+    /// more expensive ones.
+    /// \return Number of threads, always positive.
+    inline unsigned int ThreadCount(
+        unsigned int _requested, std::size_t _count,
+        std::size_t _minPerThread = kDefaultMinPerThread)
+    {
+      if (_requested == 0)
+        _requested = std::max(1u, std::thread::hardware_concurrency());
+      const std::size_t maxUseful =
+        std::max<std::size_t>(1u, _count / std::max<std::size_t>(
+              1u, _minPerThread));
+      return static_cast<unsigned int>(
+          std::min<std::size_t>(_requested, maxUseful));
+    }
+
+    /// \brief Split [0, _count) into _threads contiguous chunks and call
+    /// _func(begin, end, threadIndex) on each of them concurrently. The
+    /// calling thread processes the first chunk. The partition only depends
+    /// on _count and _threads, so per-thread partial results can be reduced
+    /// in a deterministic order.
+    /// \param[in] _count Number of elements.
+    /// \param[in] _threads Number of chunks.
+    /// \param[in] _func Function to execute on each chunk.
+    template<typename Func>
+    void ParallelFor(std::size_t _count, unsigned int _threads,
+                     const Func &_func)
+    {
+      if (_threads <= 1)
+      {
+        _func(std::size_t{0}, _count, 0u);
+        return;
+      }
+
+      std::vector<std::thread> workers;
+      workers.reserve(_threads - 1);
+      const std::size_t chunk = (_count + _threads - 1) / _threads;
+      for (unsigned int t = 1; t < _threads; ++t)
+      {
+        const std::size_t begin = std::min(_count, t * chunk);
+        const std::size_t end = std::min(_count, begin + chunk);
+        workers.emplace_back([&_func, begin, end, t]()
+        {
+          _func(begin, end, t);
+        });
+      }
+      _func(std::size_t{0}, std::min(_count, chunk), 0u);
+      for (auto &worker : workers)
+        worker.join();
+    }
+  }  // namespace detail
+  }  // namespace GZ_MATH_VERSION_NAMESPACE
+}  // namespace gz::math
+#endif  // GZ_MATH_DETAIL_PARALLEL_FOR_HH_
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_DETAIL_PHILOX_HH_
+#define GZ_MATH_DETAIL_PHILOX_HH_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <gz/math/config.hh>
+
+namespace gz::math
+{
+  // Inline bracket to help doxygen filtering.
+  inline namespace GZ_MATH_VERSION_NAMESPACE {
+  namespace detail {
+
+    /// \brief Counter of the Philox4x32 generator.
+    using PhiloxCounter = std::array<uint32_t, 4>;
+
+    /// \brief Key of the Philox4x32 generator.
+    using PhiloxKey = std::array<uint32_t, 2>;
+
+    /// \brief Apply the Philox4x32-10 bijection to a batch of counters
+    /// stored lane by lane, so that the compiler can vectorize the rounds.
+    /// See J. Salmon et al., "Parallel random numbers: as easy as 1, 2, 3",
+    /// SC11.
+    /// \param[in,out] _lanes Counters, _lanes[i][j] is word i of counter j.
+    /// They are replaced by the random words.
+    /// \param[in] _key Key of the generator.
+    template<std::size_t N>
+    constexpr void Philox4x32(uint32_t (&_lanes)[4][N], PhiloxKey _key)
+    {
+      constexpr uint64_t kMultiplier0 = 0xD2511F53u;
+      constexpr uint64_t kMultiplier1 = 0xCD9E8D57u;
+      constexpr uint32_t kWeyl0 = 0x9E3779B9u;
+      constexpr uint32_t kWeyl1 = 0xBB67AE85u;
+      for (int round = 0; round < 10; ++round)
+      {
+        for (std::size_t j = 0; j < N; ++j)
+        {
+          const uint64_t product0 = kMultiplier0 * _lanes[0][j];
+          const uint64_t product1 = kMultiplier1 * _lanes[2][j];
+          const uint32_t c1 = _lanes[1][j];
+          const uint32_t c3 = _lanes[3][j];
+          _lanes[0][j] = static_cast<uint32_t>(product1 >> 32) ^ c1 ^ _key[0];
+          _lanes[1][j] = static_cast<uint32_t>(product1);
+          _lanes[2][j] = static_cast<uint32_t>(product0 >> 32) ^ c3 ^ _key[1];
+          _lanes[3][j] = static_cast<uint32_t>(product0);
+        }
+        _key[0] += kWeyl0;
+        _key[1] += kWeyl1;
+      }
+    }
+
+    /// \brief Apply the Philox4x32-10 bijection to one counter.
+    /// \param[in] _counter Counter.
+    /// \param[in] _key Key of the generator.
+    /// \return Four random words.
+    constexpr PhiloxCounter Philox4x32(const PhiloxCounter &_counter,
+                                       const PhiloxKey &_key)
+    {
+      uint32_t lanes[4][1] = {
+        {_counter[0]}, {_counter[1]}, {_counter[2]}, {_counter[3]}};
+      Philox4x32(lanes, _key);
+      return {lanes[0][0], lanes[1][0], lanes[2][0], lanes[3][0]};
+    }
+  }  // namespace detail
+  }  // namespace GZ_MATH_VERSION_NAMESPACE
+}  // namespace gz::math
+#endif  // GZ_MATH_DETAIL_PHILOX_HH_
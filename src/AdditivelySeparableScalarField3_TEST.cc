@@ -15,8 +15,10 @@
  *
 */
 #include <gtest/gtest.h>
+#include <cmath>
 #include <functional>
 #include <ostream>
+#include <vector>
 
 #include "gz/math/AdditivelySeparableScalarField3.hh"
 #include "gz/math/Polynomial3.hh"
@@ -43,6 +45,75 @@ TEST(AdditivelySeparableScalarField3Test, Evaluate)
   EXPECT_DOUBLE_EQ(scalarField(INF_V), math::INF_D);
 }
 
+/////////////////////////////////////////////////
+TEST(AdditivelySeparableScalarField3Test, BatchEvaluate)
+{
+  const math::Polynomial3d p(math::Vector4d(1., -2., 0.5, 3.));
+  const math::Polynomial3d q(math::Vector4d(0., 1., 1., 1.));
+  const math::Polynomial3d r(math::Vector4d(-0.5, 0., 2., 0.));
+  const math::AdditivelySeparableScalarField3d<math::Polynomial3d>
+      polyField(0.7, p, q, r);
+
+  using ScalarFunctionT = std::function<double(double)>;
+  const math::AdditivelySeparableScalarField3d<ScalarFunctionT>
+      funcField(0.7, p, q, r);
+
+  // Enough points to span several blocks and threads
+  std::vector<math::Vector3d> points;
+  for (int i = 0; i < 3000; ++i)
+  {
+    points.emplace_back(
+        -2. + 0.0013 * i, 1.5 - 0.0007 * i, std::sin(0.01 * i));
+  }
+  points[10].X() = math::INF_D;
+
+  for (unsigned int threads : {1u, 3u})
+  {
+    std::vector<double> values;
+    polyField.Evaluate(points, values, threads);
+    ASSERT_EQ(points.size(), values.size());
+    std::vector<double> funcValues;
+    funcField.Evaluate(points, funcValues, threads);
+    ASSERT_EQ(points.size(), funcValues.size());
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+      EXPECT_EQ(polyField(points[i]), values[i]) << i;
+      EXPECT_EQ(funcField(points[i]), funcValues[i]) << i;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(AdditivelySeparableScalarField3Test, EvaluateLattice)
+{
+  const math::Polynomial3d p(math::Vector4d(1., -2., 0.5, 3.));
+  const math::Polynomial3d q(math::Vector4d(0., 1., 1., 1.));
+  const math::Polynomial3d r(math::Vector4d(-0.5, 0., 2., 0.));
+  const math::AdditivelySeparableScalarField3d<math::Polynomial3d>
+      field(-1.3, p, q, r);
+
+  const std::vector<double> xs{-1., -0.25, 0., 0.3, 1., 2., 7.5};
+  const std::vector<double> ys{-2., 0.1, 4.};
+  const std::vector<double> zs{0.5, -0.5, 3., 10., -7.};
+  std::vector<double> values;
+  field.EvaluateLattice(xs, ys, zs, values);
+  ASSERT_EQ(xs.size() * ys.size() * zs.size(), values.size());
+  for (std::size_t l = 0; l < zs.size(); ++l)
+  {
+    for (std::size_t j = 0; j < ys.size(); ++j)
+    {
+      for (std::size_t i = 0; i < xs.size(); ++i)
+      {
+        EXPECT_EQ(field(math::Vector3d(xs[i], ys[j], zs[l])),
+                  values[i + xs.size() * (j + ys.size() * l)]);
+      }
+    }
+  }
+
+  field.EvaluateLattice(xs, {}, zs, values);
+  EXPECT_TRUE(values.empty());
+}
+
 /////////////////////////////////////////////////
 TEST(AdditivelySeparableScalarField3Test, Minimum)
 {
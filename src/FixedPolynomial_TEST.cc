@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <array>
+#include <cmath>
+#include <sstream>
+
+#include "gz/math/AdditivelySeparableScalarField3.hh"
+#include "gz/math/FixedPolynomial.hh"
+#include "gz/math/Polynomial3.hh"
+
+using namespace gz;
+
+/////////////////////////////////////////////////
+/// \brief Compare two numbers at compile time, without -Wfloat-equal.
+constexpr bool Near(double _a, double _b)
+{
+  return (_a - _b) <= 1e-12 && (_b - _a) <= 1e-12;
+}
+
+/////////////////////////////////////////////////
+TEST(FixedPolynomialTest, Constexpr)
+{
+  // (x - 1) (x - 2) (x + 3)
+  constexpr math::FixedPolynomiald<3> poly(1., 0., -7., 6.);
+  static_assert(Near(poly(0.), 6.));
+  static_assert(Near(poly(1.), 0.));
+  static_assert(Near(poly(2.), 0.));
+  static_assert(Near(poly.Derivative()(0.), -7.));
+  static_assert(Near(poly.Derivative().Derivative().Coeffs()[0], 6.));
+  static_assert(
+    Near(math::FixedPolynomiald<0>::Constant(4.).Derivative()(1.), 0.));
+
+  constexpr auto roots = []()
+  {
+    std::array<double, 3> r{};
+    math::FixedPolynomiald<3>(1., 0., -7., 6.).Roots(r);
+    return r;
+  }();
+  static_assert(Near(roots[0], -3.));
+  static_assert(Near(roots[1], 1.));
+  static_assert(Near(roots[2], 2.));
+
+  constexpr double minimum =
+    poly.Minimum(math::Intervald::Closed(-1., 3.));
+  static_assert(minimum < poly(1.5) + 1e-12);
+  static_assert(minimum > poly(1.5) - 0.1);
+  EXPECT_NEAR(minimum, poly(1. + std::sqrt(7. / 3.) - 1.), 1e-12);
+}
+
+/////////////////////////////////////////////////
+TEST(FixedPolynomialTest, Evaluate)
+{
+  const double inputs[] = {
+    0., 1., -1., 0.3, -2.5, 1e3, -1e-3,
+    math::INF_D, -math::INF_D, math::NAN_D};
+  for (const math::Vector4d &coeffs : {
+         math::Vector4d(1., -2., 0.5, 3.),
+         math::Vector4d(-1., 0., 0., 0.),
+         math::Vector4d(0., 2., -1., 1.),
+         math::Vector4d(0., -2., -1., 1.),
+         math::Vector4d(0., 0., -1., 1.),
+         math::Vector4d(0., 0., 0., 2.)})
+  {
+    const math::Polynomial3d poly(coeffs);
+    const math::FixedPolynomiald<3> fixed(poly);
+    EXPECT_EQ(coeffs, fixed.ToPolynomial3().Coeffs());
+    for (double x : inputs)
+    {
+      if (std::isnan(x))
+      {
+        EXPECT_TRUE(std::isnan(fixed(x)));
+      }
+      else
+      {
+        EXPECT_EQ(poly(x), fixed(x)) << coeffs << " at " << x;
+      }
+    }
+  }
+
+  // Higher degree limits follow the parity of the leading term
+  const math::FixedPolynomiald<5> quintic(-2., 0., 0., 0., 0., 1.);
+  EXPECT_EQ(-math::INF_D, quintic(math::INF_D));
+  EXPECT_EQ(math::INF_D, quintic(-math::INF_D));
+  EXPECT_DOUBLE_EQ(-63., quintic(2.));
+  const math::FixedPolynomiald<4> quartic(-1., 0., 0., 0., 1.);
+  EXPECT_EQ(-math::INF_D, quartic(math::INF_D));
+  EXPECT_EQ(-math::INF_D, quartic(-math::INF_D));
+
+  // Lower degrees convert to cubics with leading zeros
+  const math::FixedPolynomiald<1> line(2., -1.);
+  EXPECT_EQ(math::Vector4d(0., 0., 2., -1.), line.ToPolynomial3().Coeffs());
+  const math::FixedPolynomiald<4> padded(math::Polynomial3d(
+    math::Vector4d(1., 2., 3., 4.)));
+  EXPECT_EQ(0., padded.Coeffs()[0]);
+  EXPECT_EQ(4., padded.Coeffs()[4]);
+}
+
+/////////////////////////////////////////////////
+TEST(FixedPolynomialTest, Roots)
+{
+  {
+    std::array<double, 3> roots{};
+    // x^3 + x + 1 has a single real root
+    EXPECT_EQ(1u, math::FixedPolynomiald<3>(1., 0., 1., 1.).Roots(roots));
+    EXPECT_NEAR(-0.6823278038280193, roots[0], 1e-15);
+  }
+  {
+    std::array<double, 3> roots{};
+    // (x - 1)^2 (x + 2), the double root is a critical point
+    EXPECT_EQ(2u, math::FixedPolynomiald<3>(1., 0., -3., 2.).Roots(roots));
+    EXPECT_DOUBLE_EQ(-2., roots[0]);
+    EXPECT_DOUBLE_EQ(1., roots[1]);
+  }
+  {
+    std::array<double, 3> roots{};
+    // 0.5 (x + 0.1) (x - 0.2) (x - 40)
+    const math::FixedPolynomiald<3> poly(0.5, -20.05, 1.99, 0.4);
+    EXPECT_EQ(3u, poly.Roots(roots));
+    EXPECT_NEAR(-0.1, roots[0], 1e-12);
+    EXPECT_NEAR(0.2, roots[1], 1e-12);
+    EXPECT_NEAR(40., roots[2], 1e-12);
+  }
+  {
+    // Degenerate cubics fall back to lower degrees
+    std::array<double, 3> roots{};
+    EXPECT_EQ(2u, math::FixedPolynomiald<3>(0., 1., 0., -4.).Roots(roots));
+    EXPECT_DOUBLE_EQ(-2., roots[0]);
+    EXPECT_DOUBLE_EQ(2., roots[1]);
+    EXPECT_EQ(0u, math::FixedPolynomiald<3>(0., 1., 0., 4.).Roots(roots));
+    EXPECT_EQ(1u, math::FixedPolynomiald<3>(0., 0., 2., 1.).Roots(roots));
+    EXPECT_DOUBLE_EQ(-0.5, roots[0]);
+    EXPECT_EQ(0u, math::FixedPolynomiald<3>(0., 0., 0., 1.).Roots(roots));
+  }
+  {
+    std::array<float, 2> roots{};
+    // Cancellation prone quadratic
+    EXPECT_EQ(2u, math::FixedPolynomialf<2>(1.f, 1e4f, 1.f).Roots(roots));
+    EXPECT_NEAR(-1e4f, roots[0], 1e-3f);
+    EXPECT_NEAR(-1e-4f, roots[1], 1e-10f);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(FixedPolynomialTest, Minimum)
+{
+  const math::Intervald intervals[] = {
+    math::Intervald::Unbounded,
+    math::Intervald::Open(0., 0.),
+    math::Intervald::Closed(0., 0.),
+    math::Intervald::Closed(-1., 1.),
+    math::Intervald::Open(-1., 1.),
+    math::Intervald::LeftClosed(-3., 0.5),
+    math::Intervald::RightClosed(0.5, 10.),
+    math::Intervald::Open(-math::INF_D, 0.),
+    math::Intervald::Open(0., math::INF_D)};
+  for (const math::Vector4d &coeffs : {
+         math::Vector4d(1., -2., 0.5, 3.),
+         math::Vector4d(-1., 1., 1., 0.),
+         math::Vector4d(1., 0., 1., 0.),
+         math::Vector4d(0., 2., -1., 1.),
+         math::Vector4d(0., -2., -1., 1.),
+         math::Vector4d(0., 0., -1., 1.),
+         math::Vector4d(0., 0., 0., 2.)})
+  {
+    const math::Polynomial3d poly(coeffs);
+    const math::FixedPolynomiald<3> fixed(poly);
+    for (const math::Intervald &interval : intervals)
+    {
+      double xMin = 0.;
+      double fixedXMin = 0.;
+      const double yMin = poly.Minimum(interval, xMin);
+      const double fixedYMin = fixed.Minimum(interval, fixedXMin);
+      if (std::isnan(yMin))
+      {
+        EXPECT_TRUE(std::isnan(fixedYMin));
+        EXPECT_TRUE(std::isnan(fixedXMin));
+      }
+      else if (std::isinf(yMin) || std::isinf(xMin))
+      {
+        EXPECT_DOUBLE_EQ(yMin, fixedYMin);
+        EXPECT_EQ(xMin, fixedXMin);
+      }
+      else
+      {
+        EXPECT_NEAR(yMin, fixedYMin, 1e-12) << poly << " in " << interval;
+        EXPECT_NEAR(xMin, fixedXMin, 1e-6) << poly << " in " << interval;
+      }
+    }
+  }
+
+  // (x^2 - 1)^2 has two global minima
+  const math::FixedPolynomiald<4> quartic(1., 0., -2., 0., 1.);
+  double xMin = 0.;
+  EXPECT_DOUBLE_EQ(0., quartic.Minimum(xMin));
+  EXPECT_DOUBLE_EQ(-1., xMin);
+  EXPECT_DOUBLE_EQ(0., quartic.Minimum(
+    math::Intervald::Closed(0., 2.), xMin));
+  EXPECT_DOUBLE_EQ(1., xMin);
+  EXPECT_DOUBLE_EQ(0.5625, quartic.Minimum(
+    math::Intervald::Closed(-0.5, 0.)));
+}
+
+/////////////////////////////////////////////////
+TEST(FixedPolynomialTest, AdditivelySeparableScalarField3)
+{
+  const math::Polynomial3d p(math::Vector4d(1., -2., 0.5, 3.));
+  const math::Polynomial3d q(math::Vector4d(0., 1., 1., 1.));
+  const math::Polynomial3d r(math::Vector4d(0., 0., 2., 0.));
+  const math::AdditivelySeparableScalarField3d<math::Polynomial3d>
+      field(0.5, p, q, r);
+  using FixedPolynomial = math::FixedPolynomiald<3>;
+  const math::AdditivelySeparableScalarField3d<FixedPolynomial>
+      fixedField(0.5, FixedPolynomial(p), FixedPolynomial(q),
+                 FixedPolynomial(r));
+
+  for (const math::Vector3d &point : {
+         math::Vector3d::Zero, math::Vector3d(1., -2., 0.5),
+         math::Vector3d(-3., 0.25, 7.)})
+  {
+    EXPECT_EQ(field(point), fixedField(point));
+  }
+
+  const math::Region3d region(
+    math::Intervald::Closed(-1., 2.),
+    math::Intervald::Closed(-1., 1.),
+    math::Intervald::Closed(0., 1.));
+  math::Vector3d pMin, fixedPMin;
+  EXPECT_NEAR(field.Minimum(region, pMin),
+              fixedField.Minimum(region, fixedPMin), 1e-12);
+  EXPECT_NEAR(pMin.Distance(fixedPMin), 0., 1e-6);
+
+  std::ostringstream os, fixedOs;
+  os << field;
+  fixedOs << fixedField;
+  EXPECT_EQ(os.str(), fixedOs.str());
+}
+
+/////////////////////////////////////////////////
+TEST(FixedPolynomialTest, Stream)
+{
+  std::ostringstream os;
+  os << math::FixedPolynomiald<5>(-1., 0., 2., 0., -1., 0.5);
+  EXPECT_EQ("-x^5 + 2 x^3 - x + 0.5", os.str());
+  os.str("");
+  os << math::FixedPolynomiald<2>();
+  EXPECT_EQ("0", os.str());
+}
@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include <gz/math/GaussMarkovProcessBank.hh>
+#include <gz/math/Rand.hh>
+
+#include "gz/math/detail/Error.hh"
+#include "gz/math/detail/ParallelFor.hh"
+
+using namespace gz::math;
+
+//////////////////////////////////////////////////
+class gz::math::GaussMarkovProcessBank::Implementation
+{
+  /// \brief Current process values.
+  public: std::vector<double> value;
+
+  /// \brief Process start values.
+  public: std::vector<double> start;
+
+  /// \brief Process theta values.
+  public: std::vector<double> theta;
+
+  /// \brief Process mu values.
+  public: std::vector<double> mu;
+
+  /// \brief Process sigma values.
+  public: std::vector<double> sigma;
+
+  /// \brief Decay of each process over cachedDt, exp(-theta dt).
+  public: std::vector<double> decay;
+
+  /// \brief Standard deviation of the noise of each process over cachedDt.
+  public: std::vector<double> noiseScale;
+
+  /// \brief Time step of decay and noiseScale, NaN if they are stale.
+  public: double cachedDt = std::nan("");
+
+  /// \brief Noise of the current update.
+  public: std::vector<double> noise;
+
+  /// \brief Random stream of the bank.
+  public: RandStream stream;
+
+  /// \brief Constructor.
+  /// \param[in] _seed Seed of the random stream.
+  /// \param[in] _stream Index of the random stream.
+  public: Implementation(unsigned int _seed, uint64_t _stream)
+    : stream(_seed, _stream)
+  {
+  }
+
+  /// \brief Compute the decay and noise scale of the processes in
+  /// [_begin, _end) over a time step.
+  /// \param[in] _dt Time step in seconds.
+  /// \param[in] _begin First process.
+  /// \param[in] _end Process after the last one.
+  public: void UpdateCoefficients(double _dt, std::size_t _begin,
+                                  std::size_t _end)
+  {
+    for (std::size_t i = _begin; i < _end; ++i)
+    {
+      const double rate = this->theta[i] * _dt;
+      this->decay[i] = std::exp(-rate);
+      // Variance sigma^2 (1 - exp(-2 theta dt)) / (2 theta), which tends to
+      // sigma^2 dt for small theta dt.
+      const double variance = rate > 1e-8 ?
+        -std::expm1(-2.0 * rate) / (2.0 * this->theta[i]) : _dt;
+      this->noiseScale[i] = this->sigma[i] * std::sqrt(variance);
+    }
+  }
+};
+
+//////////////////////////////////////////////////
+GaussMarkovProcessBank::GaussMarkovProcessBank(uint64_t _stream)
+  : GaussMarkovProcessBank(Rand::Seed(), _stream)
+{
+}
+
+//////////////////////////////////////////////////
+GaussMarkovProcessBank::GaussMarkovProcessBank(unsigned int _seed,
+    uint64_t _stream)
+  : dataPtr(gz::utils::MakeImpl<Implementation>(_seed, _stream))
+{
+}
+
+//////////////////////////////////////////////////
+void GaussMarkovProcessBank::Seed(unsigned int _seed, uint64_t _stream)
+{
+  this->dataPtr->stream.Seed(_seed, _stream);
+}
+
+//////////////////////////////////////////////////
+std::size_t GaussMarkovProcessBank::Add(double _start, double _theta,
+    double _mu, double _sigma)
+{
+  this->dataPtr->value.push_back(_start);
+  this->dataPtr->start.push_back(_start);
+  this->dataPtr->theta.push_back(std::max(0.0, _theta));
+  this->dataPtr->mu.push_back(_mu);
+  this->dataPtr->sigma.push_back(std::max(0.0, _sigma));
+  this->dataPtr->cachedDt = std::nan("");
+  return this->dataPtr->value.size() - 1;
+}
+
+//////////////////////////////////////////////////
+bool GaussMarkovProcessBank::Set(std::size_t _index, double _start,
+    double _theta, double _mu, double _sigma)
+{
+  if (_index >= this->dataPtr->value.size())
+  {
+    std::ostringstream errStream;
+    errStream << "Process index[" << _index << "] out of range, the bank "
+              << "has " << this->dataPtr->value.size() << " processes";
+    detail::LogErrorMessage(errStream.str());
+    return false;
+  }
+
+  this->dataPtr->value[_index] = _start;
+  this->dataPtr->start[_index] = _start;
+  this->dataPtr->theta[_index] = std::max(0.0, _theta);
+  this->dataPtr->mu[_index] = _mu;
+  this->dataPtr->sigma[_index] = std::max(0.0, _sigma);
+  this->dataPtr->cachedDt = std::nan("");
+  return true;
+}
+
+//////////////////////////////////////////////////
+std::size_t GaussMarkovProcessBank::Size() const
+{
+  return this->dataPtr->value.size();
+}
+
+//////////////////////////////////////////////////
+void GaussMarkovProcessBank::Clear()
+{
+  this->dataPtr->value.clear();
+  this->dataPtr->start.clear();
+  this->dataPtr->theta.clear();
+  this->dataPtr->mu.clear();
+  this->dataPtr->sigma.clear();
+  this->dataPtr->cachedDt = std::nan("");
+}
+
+//////////////////////////////////////////////////
+void GaussMarkovProcessBank::Reset()
+{
+  this->dataPtr->value = this->dataPtr->start;
+}
+
+//////////////////////////////////////////////////
+const std::vector<double> &GaussMarkovProcessBank::Values() const
+{
+  return this->dataPtr->value;
+}
+
+//////////////////////////////////////////////////
+const std::vector<double> &GaussMarkovProcessBank::Start() const
+{
+  return this->dataPtr->start;
+}
+
+//////////////////////////////////////////////////
+const std::vector<double> &GaussMarkovProcessBank::Theta() const
+{
+  return this->dataPtr->theta;
+}
+
+//////////////////////////////////////////////////
+const std::vector<double> &GaussMarkovProcessBank::Mu() const
+{
+  return this->dataPtr->mu;
+}
+
+//////////////////////////////////////////////////
+const std::vector<double> &GaussMarkovProcessBank::Sigma() const
+{
+  return this->dataPtr->sigma;
+}
+
+//////////////////////////////////////////////////
+const std::vector<double> &GaussMarkovProcessBank::Update(
+    const clock::duration &_dt, unsigned int _threads)
+{
+  // Time difference in seconds
+  return this->Update(std::chrono::duration<double>(_dt).count(), _threads);
+}
+
+//////////////////////////////////////////////////
+const std::vector<double> &GaussMarkovProcessBank::Update(double _dt,
+    unsigned int _threads)
+{
+  auto &data = *this->dataPtr;
+  const std::size_t count = data.value.size();
+  if (count == 0)
+    return data.value;
+
+  // A negative time step would make the variance of the noise negative,
+  // and a null one would still draw noise.
+  if (!(_dt > 0))
+  {
+    std::ostringstream errStream;
+    errStream << "Time step[" << _dt << "] must be positive, the processes "
+              << "are not updated";
+    detail::LogErrorMessage(errStream.str());
+    return data.value;
+  }
+
+  // The noise is drawn in one go, so that it does not depend on how the
+  // processes are split over threads.
+  data.noise.resize(count);
+  data.stream.FillNormal(data.noise.data(), count, 0.0, 1.0, _threads);
+
+  // Coefficients only change with the time step, which is usually fixed.
+  const bool stale = !(std::abs(data.cachedDt - _dt) <= 0);
+  if (stale)
+  {
+    data.decay.resize(count);
+    data.noiseScale.resize(count);
+    data.cachedDt = _dt;
+  }
+
+  // Updating a process only takes a few operations.
+  const unsigned int threads = detail::ThreadCount(_threads, count, 4096);
+  detail::ParallelFor(count, threads,
+    [&](std::size_t _begin, std::size_t _end, unsigned int)
+    {
+      if (stale)
+        data.UpdateCoefficients(_dt, _begin, _end);
+
+      for (std::size_t i = _begin; i < _end; ++i)
+      {
+        data.value[i] = data.mu[i] +
+          (data.value[i] - data.mu[i]) * data.decay[i] +
+          data.noiseScale[i] * data.noise[i];
+      }
+    });
+  return data.value;
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "gz/math/GaussMarkovProcessBank.hh"
+
+using namespace gz;
+using namespace math;
+
+/////////////////////////////////////////////////
+TEST(GaussMarkovProcessBankTest, Parameters)
+{
+  GaussMarkovProcessBank bank(1, 0);
+  EXPECT_EQ(0u, bank.Size());
+  EXPECT_TRUE(bank.Update(0.1).empty());
+
+  EXPECT_EQ(0u, bank.Add(1.0, 0.5, 2.0, 0.1));
+  EXPECT_EQ(1u, bank.Add(-1.0, -0.5, 3.0, -0.1));
+  ASSERT_EQ(2u, bank.Size());
+  EXPECT_DOUBLE_EQ(1.0, bank.Start()[0]);
+  EXPECT_DOUBLE_EQ(-1.0, bank.Values()[1]);
+  EXPECT_DOUBLE_EQ(0.5, bank.Theta()[0]);
+  EXPECT_DOUBLE_EQ(3.0, bank.Mu()[1]);
+  EXPECT_DOUBLE_EQ(0.1, bank.Sigma()[0]);
+
+  // Negative theta and sigma are clamped to zero
+  EXPECT_DOUBLE_EQ(0.0, bank.Theta()[1]);
+  EXPECT_DOUBLE_EQ(0.0, bank.Sigma()[1]);
+
+  bank.Update(0.1);
+  EXPECT_NE(1.0, bank.Values()[0]);
+  // A process without theta nor sigma does not move
+  EXPECT_DOUBLE_EQ(-1.0, bank.Values()[1]);
+
+  bank.Reset();
+  EXPECT_DOUBLE_EQ(1.0, bank.Values()[0]);
+
+  EXPECT_TRUE(bank.Set(1, 4.0, 1.0, 5.0, 0.0));
+  EXPECT_DOUBLE_EQ(4.0, bank.Values()[1]);
+  EXPECT_FALSE(bank.Set(2, 4.0, 1.0, 5.0, 0.0));
+
+  bank.Clear();
+  EXPECT_EQ(0u, bank.Size());
+}
+
+/////////////////////////////////////////////////
+TEST(GaussMarkovProcessBankTest, Deterministic)
+{
+  GaussMarkovProcessBank bank(3, 1);
+  GaussMarkovProcessBank parallel(3, 1);
+  for (int i = 0; i < 20000; ++i)
+  {
+    bank.Add(0.01 * i, 0.1 * (i % 7), 1.0, 0.5);
+    parallel.Add(0.01 * i, 0.1 * (i % 7), 1.0, 0.5);
+  }
+
+  for (int step = 0; step < 5; ++step)
+  {
+    const double dt = step < 3 ? 0.01 : 0.02;
+    EXPECT_EQ(bank.Update(dt), parallel.Update(dt, 4));
+  }
+
+  // Reseeding restarts the noise sequence
+  bank.Reset();
+  bank.Seed(3, 1);
+  parallel.Reset();
+  parallel.Seed(3, 1);
+  EXPECT_EQ(bank.Update(0.01), parallel.Update(0.01, 3));
+
+  // Other streams differ
+  GaussMarkovProcessBank other(3, 2);
+  other.Add(0.0, 0.1, 1.0, 0.5);
+  GaussMarkovProcessBank same(3, 1);
+  same.Add(0.0, 0.1, 1.0, 0.5);
+  EXPECT_NE(other.Update(0.01)[0], same.Update(0.01)[0]);
+}
+
+/////////////////////////////////////////////////
+TEST(GaussMarkovProcessBankTest, InvalidTimeStep)
+{
+  GaussMarkovProcessBank bank(5, 0);
+  GaussMarkovProcessBank reference(5, 0);
+  bank.Add(1.0, 0.5, 2.0, 0.1);
+  reference.Add(1.0, 0.5, 2.0, 0.1);
+
+  // Negative, null and NaN time steps leave the values unchanged
+  for (double dt : {-0.1, 0.0, std::nan("")})
+  {
+    const std::vector<double> values = bank.Update(dt);
+    ASSERT_EQ(1u, values.size());
+    EXPECT_DOUBLE_EQ(1.0, values[0]) << dt;
+  }
+  EXPECT_DOUBLE_EQ(1.0,
+      bank.Update(clock::duration(std::chrono::milliseconds(-10)))[0]);
+
+  // Nor do they advance the noise stream
+  EXPECT_EQ(reference.Update(0.1), bank.Update(0.1));
+  EXPECT_TRUE(std::isfinite(bank.Values()[0]));
+}
+
+/////////////////////////////////////////////////
+TEST(GaussMarkovProcessBankTest, Statistics)
+{
+  // Without noise, processes decay exactly towards mu
+  GaussMarkovProcessBank bank(5, 0);
+  bank.Add(10.0, 2.0, 4.0, 0.0);
+  bank.Update(0.3);
+  bank.Update(std::chrono::milliseconds(200));
+  EXPECT_NEAR(4.0 + 6.0 * std::exp(-2.0 * 0.5), bank.Values()[0], 1e-12);
+
+  // The distribution after a step is exact, whatever the step
+  const int n = 50000;
+  const double theta = 0.7;
+  const double mu = -2.0;
+  const double sigma = 1.5;
+  for (const double dt : {0.01, 1.0})
+  {
+    GaussMarkovProcessBank processes(7, 0);
+    for (int i = 0; i < n; ++i)
+      processes.Add(1.0, theta, mu, sigma);
+    const std::vector<double> &values = processes.Update(dt);
+
+    double sum = 0;
+    double sum2 = 0;
+    for (double value : values)
+    {
+      sum += value;
+      sum2 += value * value;
+    }
+    const double mean = sum / n;
+    const double variance = sum2 / n - mean * mean;
+    const double decay = std::exp(-theta * dt);
+    const double expectedVariance =
+      sigma * sigma * (1.0 - decay * decay) / (2.0 * theta);
+    EXPECT_NEAR(mu + (1.0 - mu) * decay, mean,
+                5.0 * std::sqrt(expectedVariance / n));
+    EXPECT_NEAR(expectedVariance, variance, 0.03 * expectedVariance);
+  }
+
+  // Brownian motion when theta is zero
+  GaussMarkovProcessBank brownian(9, 0);
+  for (int i = 0; i < n; ++i)
+    brownian.Add(0.0, 0.0, 0.0, 2.0);
+  for (int step = 0; step < 4; ++step)
+    brownian.Update(0.25);
+  double sum2 = 0;
+  for (double value : brownian.Values())
+    sum2 += value * value;
+  EXPECT_NEAR(4.0, sum2 / n, 0.12);
+}
@@ -26,6 +26,71 @@
 using namespace gz;
 using namespace math;
 
+namespace
+{
+//////////////////////////////////////////////////
+/// \brief Check the arguments shared by all the clustering functions.
+/// \param[in] _numObs Number of observations.
+/// \param[in] _k Number of clusters.
+/// \return True if the arguments are valid.
+bool ValidClusterArgs(std::size_t _numObs, int _k)
+{
+  if (_numObs == 0)
+  {
+    detail::LogErrorMessage("Kmeans error: The set of observations is empty");
+    return false;
+  }
+
+  if (_k <= 0)
+  {
+    std::ostringstream errStream;
+    errStream << "Kmeans error: The number of clusters has to"
+              << " be positive but its value is [" << _k << "]";
+    detail::LogErrorMessage(errStream.str());
+    return false;
+  }
+
+  if (_k > static_cast<int>(_numObs))
+  {
+    std::ostringstream errStream;
+    errStream << "Kmeans error: The number of clusters [" << _k << "] has to be"
+              << " lower or equal to the number of observations ["
+              << _numObs << "]";
+    detail::LogErrorMessage(errStream.str());
+    return false;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// \brief Convert flat x, y, z values to points.
+/// \param[in] _values Flat values.
+/// \return The points.
+std::vector<Vector3d> ToPoints(const std::vector<double> &_values)
+{
+  std::vector<Vector3d> points(_values.size() / 3);
+  for (std::size_t i = 0; i < points.size(); ++i)
+    points[i].Set(_values[3 * i], _values[3 * i + 1], _values[3 * i + 2]);
+  return points;
+}
+
+//////////////////////////////////////////////////
+/// \brief Append points as flat x, y, z values.
+/// \param[in] _points Points to append.
+/// \param[in,out] _values Flat values.
+void AppendValues(const std::vector<Vector3d> &_points,
+                  std::vector<double> &_values)
+{
+  _values.reserve(_values.size() + 3 * _points.size());
+  for (const auto &p : _points)
+  {
+    _values.push_back(p.X());
+    _values.push_back(p.Y());
+    _values.push_back(p.Z());
+  }
+}
+}  // namespace
+
 //////////////////////////////////////////////////
 Kmeans::Kmeans(const std::vector<Vector3d> &_obs)
 : dataPtr(gz::utils::MakeImpl<Implementation>())
@@ -36,7 +101,7 @@ Kmeans::Kmeans(const std::vector<Vector3d> &_obs)
 //////////////////////////////////////////////////
 std::vector<Vector3d> Kmeans::Observations() const
 {
-  return this->dataPtr->obs;
+  return ToPoints(this->dataPtr->obs);
 }
 
 //////////////////////////////////////////////////
@@ -48,7 +113,11 @@ bool Kmeans::Observations(const std::vector<Vector3d> &_obs)
         "Kmeans::SetObservations() error: Observations vector is empty");
     return false;
   }
-  this->dataPtr->obs = _obs;
+  this->dataPtr->obs.clear();
+  AppendValues(_obs, this->dataPtr->obs);
+
+  // The previous centroids do not describe the new observations.
+  this->dataPtr->weights.clear();
   return true;
 }
 
@@ -61,7 +130,7 @@ bool Kmeans::AppendObservations(const std::vector<Vector3d> &_obs)
         "Kmeans::AppendObservations() error: input vector is empty");
     return false;
   }
-  this->dataPtr->obs.insert(this->dataPtr->obs.end(), _obs.begin(), _obs.end());
+  AppendValues(_obs, this->dataPtr->obs);
   return true;
 }
 
@@ -70,102 +139,150 @@ bool Kmeans::Cluster(int _k,
                      std::vector<Vector3d> &_centroids,
                      std::vector<unsigned int> &_labels)
 {
+  auto &obs = this->dataPtr->obs;
+  auto &engine = this->dataPtr->engine;
+
   // Sanity check.
-  if (this->dataPtr->obs.empty())
-  {
-    detail::LogErrorMessage("Kmeans error: The set of observations is empty");
+  if (!ValidClusterArgs(obs.size() / 3, _k))
     return false;
-  }
 
-  if (_k <= 0)
-  {
-    std::ostringstream errStream;
-    errStream << "Kmeans error: The number of clusters has to"
-              << " be positive but its value is [" << _k << "]";
-    detail::LogErrorMessage(errStream.str());
+  const auto k = static_cast<unsigned int>(_k);
+  auto &centroids = this->dataPtr->centroids;
+  auto &labels = this->dataPtr->labels;
+  centroids.resize(3 * k);
+  labels.resize(obs.size() / 3);
+
+  engine.Observations(obs.data(), obs.size() / 3);
+  if (!engine.Cluster(k, centroids.data(), labels.data()))
     return false;
-  }
+  this->dataPtr->iterations = engine.Iterations();
+
+  // Allow MiniBatchCluster() to continue from this result.
+  auto &weights = this->dataPtr->weights;
+  weights.assign(k, 0.0);
+  for (unsigned int label : labels)
+    weights[label] += 1.0;
 
-  if (_k > static_cast<int>(this->dataPtr->obs.size()))
+  _centroids = ToPoints(centroids);
+  _labels = labels;
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool Kmeans::MiniBatchCluster(int _k,
+                              unsigned int _batchSize,
+                              unsigned int _iterations,
+                              std::vector<Vector3d> &_centroids,
+                              std::vector<unsigned int> &_labels)
+{
+  auto &obs = this->dataPtr->obs;
+  auto &engine = this->dataPtr->engine;
+
+  // Sanity check.
+  if (!ValidClusterArgs(obs.size() / 3, _k))
+    return false;
+
+  if (_batchSize == 0)
   {
-    std::ostringstream errStream;
-    errStream << "Kmeans error: The number of clusters [" << _k << "] has to be"
-              << " lower or equal to the number of observations ["
-              << this->dataPtr->obs.size() << "]";
-    detail::LogErrorMessage(errStream.str());
+    detail::LogErrorMessage(
+        "Kmeans error: The mini-batch size has to be positive");
     return false;
   }
 
-  size_t changed = 0;
+  auto &centroids = this->dataPtr->centroids;
+  auto &weights = this->dataPtr->weights;
+  const auto k = static_cast<unsigned int>(_k);
+  engine.Observations(obs.data(), obs.size() / 3);
 
-  // Initialize the size of the vectors;
-  this->dataPtr->centroids.clear();
-  this->dataPtr->labels.resize(this->dataPtr->obs.size());
-  this->dataPtr->sums.resize(_k);
-  this->dataPtr->counters.resize(_k);
-
-  for (auto i = 0; i < _k; ++i)
+  // Warm start from the previous centroids when possible.
+  if (weights.size() != k || centroids.size() != 3 * k)
   {
-    // Choose a random observation and make sure it has not been chosen before.
-    // Note: This is not really random but it's faster than choosing a random
-    // one and verifying that it was not taken before.
-    this->dataPtr->centroids.push_back(this->dataPtr->obs[i]);
+    centroids.resize(3 * k);
+    if (!engine.SeedCentroids(k, centroids.data()))
+      return false;
+    weights.assign(k, 0.0);
   }
 
-  // Initialize labels.
-  for (auto i = 0u; i < this->dataPtr->obs.size(); ++i)
-    this->dataPtr->labels[i] = 0;
-
-  do
+  const int last = static_cast<int>(obs.size() / 3) - 1;
+  std::vector<std::size_t> batch(_batchSize);
+  std::vector<unsigned int> batchLabels(_batchSize);
+  for (auto it = 0u; it < _iterations; ++it)
   {
-    // Reset sums and counters.
-    for (auto i = 0u; i < this->dataPtr->centroids.size(); ++i)
-    {
-      this->dataPtr->sums[i] = Vector3d::Zero;
-      this->dataPtr->counters[i] = 0;
-    }
-    changed = 0;
+    for (auto &idx : batch)
+      idx = static_cast<std::size_t>(Rand::IntUniform(0, last));
 
-    for (auto i = 0u; i < this->dataPtr->obs.size(); ++i)
+    // Label the whole batch with the current centroids before moving them.
+    for (auto b = 0u; b < _batchSize; ++b)
     {
-      // Update the labels containing the closest centroid for each point.
-      auto label = this->ClosestCentroid(this->dataPtr->obs[i]);
-      if (this->dataPtr->labels[i] != label)
-      {
-        this->dataPtr->labels[i] = label;
-        changed++;
-      }
-      this->dataPtr->sums[label] += this->dataPtr->obs[i];
-      this->dataPtr->counters[label]++;
+      batchLabels[b] = KmeansN<double, 3>::ClosestCentroid(
+          obs.data() + 3 * batch[b], centroids.data(), k);
     }
 
-    // Update the centroids.
-    for (auto i = 0u; i < this->dataPtr->centroids.size(); ++i)
+    // Move each centroid towards its samples with a learning rate equal to
+    // the inverse of the number of samples it has absorbed so far.
+    for (auto b = 0u; b < _batchSize; ++b)
     {
-      this->dataPtr->centroids[i] =
-        this->dataPtr->sums[i] / this->dataPtr->counters[i];
+      const unsigned int label = batchLabels[b];
+      weights[label] += 1.0;
+      const double rate = 1.0 / weights[label];
+      const double *o = obs.data() + 3 * batch[b];
+      double *c = centroids.data() + 3 * label;
+      for (int d = 0; d < 3; ++d)
+        c[d] += (o[d] - c[d]) * rate;
     }
   }
-  while (changed > (this->dataPtr->obs.size() >> 10)); // NOLINT
 
-  _centroids = this->dataPtr->centroids;
-  _labels = this->dataPtr->labels;
+  auto &labels = this->dataPtr->labels;
+  labels.resize(obs.size() / 3);
+  engine.Label(k, centroids.data(), labels.data());
+  this->dataPtr->iterations = _iterations;
+
+  _centroids = ToPoints(centroids);
+  _labels = labels;
   return true;
 }
 
+//////////////////////////////////////////////////
+KmeansSeeding Kmeans::Seeding() const
+{
+  return this->dataPtr->engine.Seeding();
+}
+
+//////////////////////////////////////////////////
+void Kmeans::Seeding(KmeansSeeding _seeding)
+{
+  this->dataPtr->engine.Seeding(_seeding);
+}
+
+//////////////////////////////////////////////////
+unsigned int Kmeans::Threads() const
+{
+  return this->dataPtr->engine.Threads();
+}
+
+//////////////////////////////////////////////////
+void Kmeans::Threads(unsigned int _threads)
+{
+  this->dataPtr->engine.Threads(_threads);
+}
+
+//////////////////////////////////////////////////
+unsigned int Kmeans::Iterations() const
+{
+  return this->dataPtr->iterations;
+}
+
+//////////////////////////////////////////////////
+double Kmeans::Inertia() const
+{
+  return this->dataPtr->engine.Inertia();
+}
+
 //////////////////////////////////////////////////
 unsigned int Kmeans::ClosestCentroid(const Vector3d &_p) const
 {
-  double min = HUGE_VAL;
-  unsigned int minIdx = 0;
-  for (auto i = 0u; i < this->dataPtr->centroids.size(); ++i)
-  {
-    double d = _p.Distance(this->dataPtr->centroids[i]);
-    if (d < min)
-    {
-      min = d;
-      minIdx = i;
-    }
-  }
-  return minIdx;
+  const double p[3] = {_p.X(), _p.Y(), _p.Z()};
+  return KmeansN<double, 3>::ClosestCentroid(p,
+      this->dataPtr->centroids.data(),
+      static_cast<unsigned int>(this->dataPtr->centroids.size() / 3));
 }
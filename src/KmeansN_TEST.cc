@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "gz/math/Kmeans.hh"
+#include "gz/math/KmeansN.hh"
+#include "gz/math/Rand.hh"
+
+using namespace gz;
+
+//////////////////////////////////////////////////
+TEST(KmeansNTest, Errors)
+{
+  math::KmeansN<float, 2> empty;
+  EXPECT_EQ(nullptr, empty.Observations());
+  EXPECT_EQ(0u, empty.ObservationCount());
+
+  std::vector<float> centroids(4);
+  std::vector<unsigned int> labels(2);
+  EXPECT_FALSE(empty.Cluster(2, centroids.data(), labels.data()));
+  EXPECT_FALSE(empty.Observations(nullptr, 3));
+
+  std::vector<float> obs = {0, 0, 1, 1};
+  math::KmeansN<float, 2> kmeans(obs.data(), 2);
+  EXPECT_EQ(obs.data(), kmeans.Observations());
+  EXPECT_EQ(2u, kmeans.ObservationCount());
+  EXPECT_FALSE(kmeans.Cluster(0, centroids.data(), labels.data()));
+  EXPECT_FALSE(kmeans.Cluster(3, centroids.data(), labels.data()));
+  EXPECT_FALSE(kmeans.Cluster(2, nullptr, labels.data()));
+  EXPECT_FALSE(kmeans.Cluster(2, centroids.data(), nullptr));
+  EXPECT_TRUE(kmeans.Cluster(2, centroids.data(), labels.data()));
+}
+
+//////////////////////////////////////////////////
+TEST(KmeansNTest, TwoDimensionsFloat)
+{
+  // Same layout as the Kmeans test, without the constant coordinates.
+  std::vector<float> obs = {
+    1.0f, 1.0f, 1.1f, 1.0f, 1.2f, 1.0f, 1.3f, 1.0f, 1.4f, 1.0f,
+    5.0f, 1.0f, 5.1f, 1.0f, 5.2f, 1.0f, 5.3f, 1.0f, 5.4f, 1.0f};
+
+  math::KmeansN<float, 2> kmeans(obs.data(), obs.size() / 2);
+  std::vector<float> centroids(2 * 2);
+  std::vector<unsigned int> labels(obs.size() / 2, 99u);
+  ASSERT_TRUE(kmeans.Cluster(2, centroids.data(), labels.data()));
+  EXPECT_GT(kmeans.Iterations(), 0u);
+
+  for (auto i = 1u; i < 5u; ++i)
+  {
+    EXPECT_EQ(labels[0], labels[i]);
+    EXPECT_EQ(labels[5], labels[5 + i]);
+  }
+  EXPECT_NE(labels[0], labels[5]);
+  EXPECT_NEAR(1.2f, centroids[labels[0] * 2], 1e-5f);
+  EXPECT_NEAR(5.2f, centroids[labels[5] * 2], 1e-5f);
+  EXPECT_NEAR(1.0f, centroids[labels[0] * 2 + 1], 1e-5f);
+  EXPECT_NEAR(0.2, kmeans.Inertia(), 1e-5);
+
+  // Seeding and labelling without moving the centroids
+  std::vector<float> seeds(2 * 2);
+  ASSERT_TRUE(kmeans.SeedCentroids(2, seeds.data()));
+  EXPECT_FLOAT_EQ(1.0f, seeds[0]);
+  EXPECT_FLOAT_EQ(1.1f, seeds[2]);
+  EXPECT_FALSE(kmeans.SeedCentroids(11, seeds.data()));
+  EXPECT_FALSE(kmeans.Label(2, centroids.data(), nullptr));
+
+  std::vector<unsigned int> relabels(obs.size() / 2, 99u);
+  ASSERT_TRUE(kmeans.Label(2, centroids.data(), relabels.data()));
+  EXPECT_EQ(labels, relabels);
+  EXPECT_NEAR(0.2, kmeans.Inertia(), 1e-5);
+
+  const float point[2] = {4.0f, 0.0f};
+  using KmeansN2f = math::KmeansN<float, 2>;
+  EXPECT_EQ(labels[5],
+            KmeansN2f::ClosestCentroid(point, centroids.data(), 2));
+}
+
+//////////////////////////////////////////////////
+TEST(KmeansNTest, HighDimension)
+{
+  math::Rand::Seed(11);
+  const std::size_t perCluster = 300;
+  std::vector<float> obs;
+  for (auto c = 0u; c < 3u; ++c)
+  {
+    for (auto i = 0u; i < perCluster; ++i)
+    {
+      for (auto d = 0u; d < 8u; ++d)
+      {
+        const float center = (d == c) ? 10.0f : 0.0f;
+        obs.push_back(center +
+            static_cast<float>(math::Rand::DblUniform(-1, 1)));
+      }
+    }
+  }
+
+  math::KmeansN<float, 8> kmeans(obs.data(), obs.size() / 8);
+  kmeans.Seeding(math::KmeansSeeding::KmeansPlusPlus);
+  std::vector<float> centroids(3 * 8);
+  std::vector<unsigned int> labels(obs.size() / 8);
+  ASSERT_TRUE(kmeans.Cluster(3, centroids.data(), labels.data()));
+
+  for (auto c = 0u; c < 3u; ++c)
+  {
+    const unsigned int label = labels[c * perCluster];
+    for (auto i = 0u; i < perCluster; ++i)
+      EXPECT_EQ(label, labels[c * perCluster + i]);
+    EXPECT_NEAR(10.0f, centroids[label * 8 + c], 0.2f);
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(KmeansNTest, MatchesKmeans)
+{
+  math::Rand::Seed(5);
+  std::vector<math::Vector3d> points;
+  std::vector<double> flat;
+  for (auto i = 0u; i < 20000u; ++i)
+  {
+    math::Vector3d p(math::Rand::DblUniform(0, 10),
+                     math::Rand::DblUniform(0, 10),
+                     math::Rand::DblUniform(0, 10));
+    points.push_back(p);
+    flat.insert(flat.end(), {p.X(), p.Y(), p.Z()});
+  }
+
+  for (auto seeding : {math::KmeansSeeding::FirstK,
+                       math::KmeansSeeding::KmeansPlusPlus})
+  {
+    math::Kmeans kmeans(points);
+    kmeans.Seeding(seeding);
+    std::vector<math::Vector3d> centroids;
+    std::vector<unsigned int> labels;
+    math::Rand::Seed(9);
+    ASSERT_TRUE(kmeans.Cluster(6, centroids, labels));
+
+    math::KmeansN<double, 3> kmeansN(flat.data(), points.size());
+    kmeansN.Seeding(seeding);
+    kmeansN.Threads(2);
+    std::vector<double> centroidsN(6 * 3);
+    std::vector<unsigned int> labelsN(points.size());
+    math::Rand::Seed(9);
+    ASSERT_TRUE(kmeansN.Cluster(6, centroidsN.data(), labelsN.data()));
+
+    EXPECT_EQ(labels, labelsN);
+    EXPECT_EQ(kmeans.Iterations(), kmeansN.Iterations());
+    EXPECT_NEAR(kmeans.Inertia(), kmeansN.Inertia(), 1e-6);
+    for (auto c = 0u; c < 6u; ++c)
+    {
+      EXPECT_NEAR(centroids[c].X(), centroidsN[c * 3], 1e-9);
+      EXPECT_NEAR(centroids[c].Y(), centroidsN[c * 3 + 1], 1e-9);
+      EXPECT_NEAR(centroids[c].Z(), centroidsN[c * 3 + 2], 1e-9);
+    }
+  }
+}
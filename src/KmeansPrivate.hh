@@ -22,6 +22,7 @@
 #include <gz/math/Helpers.hh>
 #include <gz/math/config.hh>
 #include <gz/math/Kmeans.hh>
+#include <gz/math/KmeansN.hh>
 
 namespace gz
 {
@@ -33,20 +34,28 @@ namespace gz
     /// \brief Private data for Kmeans class
     class Kmeans::Implementation
     {
-      /// \brief Observations.
-      public: std::vector<Vector3d> obs;
+      /// \brief Observations, stored as consecutive x, y, z values.
+      public: std::vector<double> obs;
 
-      /// \brief Centroids.
-      public: std::vector<Vector3d> centroids;
+      /// \brief Centroids, stored as consecutive x, y, z values.
+      public: std::vector<double> centroids;
 
       /// \brief Each element stores the cluster to which observation i belongs.
       public: std::vector<unsigned int> labels;
 
-      /// \brief Used to calculate the centroid of each partition.
-      public: std::vector<Vector3d> sums;
+      /// \brief Clustering engine. It holds the seeding strategy, the
+      /// number of threads and the inertia of the last clustering. Its
+      /// observations must be pointed at obs before each use since obs may
+      /// have been reallocated.
+      public: KmeansN<double, 3> engine;
 
-      /// \brief Counts the number of observations contained in each partition.
-      public: std::vector<unsigned int> counters;
+      /// \brief Number of observations assigned to each centroid so far.
+      /// Used as the learning rate of MiniBatchCluster(). It is empty when
+      /// there are no centroids to warm start from.
+      public: std::vector<double> weights;
+
+      /// \brief Number of iterations executed by the last clustering.
+      public: unsigned int iterations = 0;
     };
     }
   }
@@ -16,8 +16,13 @@
 */
 
 #include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
 #include <vector>
+
 #include "gz/math/Kmeans.hh"
+#include "gz/math/Rand.hh"
 
 using namespace gz;
 
@@ -143,3 +148,154 @@ TEST(KmeansTest, Append)
   std::vector<math::Vector3d> emptyVector;
   EXPECT_FALSE(kmeans.AppendObservations(emptyVector));
 }
+
+//////////////////////////////////////////////////
+/// \brief Generate observations around a set of centers.
+/// \param[in] _centers Centers of the blobs.
+/// \param[in] _perCenter Number of observations around each center.
+/// \return The observations, grouped by center.
+std::vector<math::Vector3d> Blobs(const std::vector<math::Vector3d> &_centers,
+                                  unsigned int _perCenter)
+{
+  std::vector<math::Vector3d> obs;
+  for (const auto &center : _centers)
+  {
+    for (auto i = 0u; i < _perCenter; ++i)
+    {
+      obs.push_back(center + math::Vector3d(math::Rand::DblUniform(-1, 1),
+                                            math::Rand::DblUniform(-1, 1),
+                                            math::Rand::DblUniform(-1, 1)));
+    }
+  }
+  return obs;
+}
+
+//////////////////////////////////////////////////
+TEST(KmeansTest, Options)
+{
+  math::Kmeans kmeans({math::Vector3d::Zero});
+  EXPECT_EQ(math::KmeansSeeding::FirstK, kmeans.Seeding());
+  EXPECT_EQ(1u, kmeans.Threads());
+  EXPECT_EQ(0u, kmeans.Iterations());
+  EXPECT_DOUBLE_EQ(0.0, kmeans.Inertia());
+
+  kmeans.Seeding(math::KmeansSeeding::KmeansPlusPlus);
+  EXPECT_EQ(math::KmeansSeeding::KmeansPlusPlus, kmeans.Seeding());
+  kmeans.Threads(4);
+  EXPECT_EQ(4u, kmeans.Threads());
+}
+
+//////////////////////////////////////////////////
+TEST(KmeansTest, KmeansPlusPlus)
+{
+  math::Rand::Seed(42);
+  std::vector<math::Vector3d> centers = {
+    {0, 0, 0}, {20, 0, 0}, {0, 20, 0}, {0, 0, 20}};
+  auto obs = Blobs(centers, 50);
+
+  math::Kmeans kmeans(obs);
+  kmeans.Seeding(math::KmeansSeeding::KmeansPlusPlus);
+
+  std::vector<math::Vector3d> centroids;
+  std::vector<unsigned int> labels;
+  ASSERT_TRUE(kmeans.Cluster(4, centroids, labels));
+  ASSERT_EQ(4u, centroids.size());
+  ASSERT_EQ(obs.size(), labels.size());
+  EXPECT_GT(kmeans.Iterations(), 0u);
+
+  // Every blob ends up in its own cluster.
+  for (auto c = 0u; c < centers.size(); ++c)
+  {
+    for (auto i = 0u; i < 50u; ++i)
+      EXPECT_EQ(labels[c * 50], labels[c * 50 + i]);
+    for (auto other = 0u; other < c; ++other)
+      EXPECT_NE(labels[c * 50], labels[other * 50]);
+    EXPECT_LT(centroids[labels[c * 50]].Distance(centers[c]), 0.5);
+  }
+
+  // The inertia matches the definition.
+  double inertia = 0;
+  for (auto i = 0u; i < obs.size(); ++i)
+    inertia += (obs[i] - centroids[labels[i]]).SquaredLength();
+  EXPECT_NEAR(inertia, kmeans.Inertia(), 1e-6);
+}
+
+//////////////////////////////////////////////////
+TEST(KmeansTest, Threads)
+{
+  math::Rand::Seed(7);
+  std::vector<math::Vector3d> centers = {
+    {0, 0, 0}, {3, 0, 0}, {0, 3, 0}, {0, 0, 3}, {3, 3, 3}};
+  auto obs = Blobs(centers, 5000);
+
+  math::Kmeans single(obs);
+  std::vector<math::Vector3d> centroidsSingle;
+  std::vector<unsigned int> labelsSingle;
+  ASSERT_TRUE(single.Cluster(5, centroidsSingle, labelsSingle));
+
+  math::Kmeans multi(obs);
+  multi.Threads(4);
+  std::vector<math::Vector3d> centroidsMulti;
+  std::vector<unsigned int> labelsMulti;
+  ASSERT_TRUE(multi.Cluster(5, centroidsMulti, labelsMulti));
+
+  EXPECT_EQ(single.Iterations(), multi.Iterations());
+  EXPECT_NEAR(single.Inertia(), multi.Inertia(), 1e-6 * single.Inertia());
+  ASSERT_EQ(centroidsSingle.size(), centroidsMulti.size());
+  for (auto i = 0u; i < centroidsSingle.size(); ++i)
+    EXPECT_TRUE(centroidsSingle[i].Equal(centroidsMulti[i], 1e-9));
+  EXPECT_EQ(labelsSingle, labelsMulti);
+
+  // The labels are consistent with an exhaustive search over the centroids
+  // of the previous iteration, so each label is close to optimal.
+  for (auto i = 0u; i < obs.size(); i += 97)
+  {
+    double best = HUGE_VAL;
+    for (const auto &c : centroidsSingle)
+      best = std::min(best, obs[i].Distance(c));
+    EXPECT_LT(obs[i].Distance(centroidsSingle[labelsSingle[i]]), best + 0.1);
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(KmeansTest, MiniBatch)
+{
+  math::Rand::Seed(3);
+  std::vector<math::Vector3d> centers = {{0, 0, 0}, {20, 0, 0}};
+  auto obs = Blobs(centers, 100);
+
+  math::Kmeans kmeans(obs);
+  kmeans.Seeding(math::KmeansSeeding::KmeansPlusPlus);
+
+  std::vector<math::Vector3d> centroids;
+  std::vector<unsigned int> labels;
+  EXPECT_FALSE(kmeans.MiniBatchCluster(2, 0, 10, centroids, labels));
+  EXPECT_FALSE(kmeans.MiniBatchCluster(0, 10, 10, centroids, labels));
+  ASSERT_TRUE(kmeans.MiniBatchCluster(2, 20, 50, centroids, labels));
+  EXPECT_EQ(50u, kmeans.Iterations());
+  ASSERT_EQ(2u, centroids.size());
+  ASSERT_EQ(obs.size(), labels.size());
+  EXPECT_NE(labels[0], labels[100]);
+  for (auto i = 0u; i < 100u; ++i)
+  {
+    EXPECT_EQ(labels[0], labels[i]);
+    EXPECT_EQ(labels[100], labels[100 + i]);
+  }
+  EXPECT_LT(centroids[labels[0]].Distance(centers[0]), 1.0);
+  EXPECT_LT(centroids[labels[100]].Distance(centers[1]), 1.0);
+
+  // Stream more observations around the same centers and refine the
+  // previous centroids instead of starting over.
+  const auto previous = centroids;
+  EXPECT_TRUE(kmeans.AppendObservations(Blobs(centers, 100)));
+  ASSERT_TRUE(kmeans.MiniBatchCluster(2, 20, 10, centroids, labels));
+  ASSERT_EQ(400u, labels.size());
+  EXPECT_LT(centroids[0].Distance(previous[0]), 0.5);
+  EXPECT_LT(centroids[1].Distance(previous[1]), 0.5);
+
+  // Cluster() results can be refined with mini-batches as well.
+  ASSERT_TRUE(kmeans.Cluster(2, centroids, labels));
+  const double inertia = kmeans.Inertia();
+  ASSERT_TRUE(kmeans.MiniBatchCluster(2, 20, 10, centroids, labels));
+  EXPECT_LT(kmeans.Inertia(), inertia * 1.1);
+}
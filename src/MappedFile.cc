@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include "gz/math/MappedFile.hh"
+
+#include <algorithm>
+#include <utility>
+
+#ifdef _WIN32
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include "gz/math/detail/Error.hh"
+
+using namespace gz;
+using namespace math;
+
+// Private data class
+class gz::math::MappedFile::Implementation
+{
+  /// \brief Unmap the file, if any.
+  public: void Unmap()
+  {
+    if (this->data == nullptr)
+      return;
+#ifdef _WIN32
+    UnmapViewOfFile(this->data);
+#else
+    munmap(const_cast<uint8_t *>(this->data), this->size);
+#endif
+    this->data = nullptr;
+    this->size = 0;
+  }
+
+  /// \brief Clip a range to the file and align its start to a page.
+  /// \param[in] _offset Offset of the range in bytes.
+  /// \param[in] _size Size of the range in bytes.
+  /// \param[out] _begin Page aligned start of the range.
+  /// \param[out] _length Length of the range from _begin.
+  /// \return False if the range is empty once clipped.
+  public: bool PageRange(std::size_t _offset, std::size_t _size,
+                         uint8_t *&_begin, std::size_t &_length) const
+  {
+    if (this->data == nullptr || _offset >= this->size || _size == 0)
+      return false;
+    const std::size_t end = _offset + std::min(_size, this->size - _offset);
+    const std::size_t start = _offset - _offset % this->pageSize;
+    _begin = const_cast<uint8_t *>(this->data) + start;
+    _length = end - start;
+    return true;
+  }
+
+  /// \brief Start of the mapping.
+  public: const uint8_t *data = nullptr;
+
+  /// \brief Size of the mapping in bytes.
+  public: std::size_t size = 0;
+
+  /// \brief Size of a memory page, which is the alignment required by the
+  /// hints.
+  public: std::size_t pageSize = 4096;
+};
+
+//////////////////////////////////////////////////
+MappedFile::MappedFile()
+  : dataPtr(gz::utils::MakeUniqueImpl<Implementation>())
+{
+}
+
+//////////////////////////////////////////////////
+bool MappedFile::Open(const std::string &_path)
+{
+  this->Close();
+
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  this->dataPtr->pageSize = info.dwAllocationGranularity;
+
+  HANDLE file = CreateFileA(_path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+      nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    detail::LogErrorMessage("MappedFile::Open() error: cannot open [" +
+        _path + "].");
+    return false;
+  }
+  LARGE_INTEGER size;
+  void *data = nullptr;
+  if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+  {
+    HANDLE mapping =
+      CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping != nullptr)
+    {
+      data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      // The view keeps the mapping alive.
+      CloseHandle(mapping);
+    }
+  }
+  CloseHandle(file);
+  if (data == nullptr)
+  {
+    detail::LogErrorMessage("MappedFile::Open() error: cannot map [" +
+        _path + "].");
+    return false;
+  }
+  this->dataPtr->size = static_cast<std::size_t>(size.QuadPart);
+#else
+  this->dataPtr->pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+  const int file = open(_path.c_str(), O_RDONLY);
+  if (file < 0)
+  {
+    detail::LogErrorMessage("MappedFile::Open() error: cannot open [" +
+        _path + "].");
+    return false;
+  }
+  struct stat info;
+  void *data = MAP_FAILED;
+  if (fstat(file, &info) == 0 && info.st_size > 0)
+  {
+    data = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ,
+                MAP_SHARED, file, 0);
+  }
+  // The mapping keeps the file alive.
+  close(file);
+  if (data == MAP_FAILED)
+  {
+    detail::LogErrorMessage("MappedFile::Open() error: cannot map [" +
+        _path + "].");
+    return false;
+  }
+  this->dataPtr->size = static_cast<std::size_t>(info.st_size);
+#endif
+
+  this->dataPtr->data = static_cast<const uint8_t *>(data);
+  return true;
+}
+
+//////////////////////////////////////////////////
+void MappedFile::Close()
+{
+  this->dataPtr->Unmap();
+}
+
+//////////////////////////////////////////////////
+bool MappedFile::IsOpen() const
+{
+  return this->dataPtr->data != nullptr;
+}
+
+//////////////////////////////////////////////////
+const uint8_t *MappedFile::Data() const
+{
+  return this->dataPtr->data;
+}
+
+//////////////////////////////////////////////////
+std::size_t MappedFile::Size() const
+{
+  return this->dataPtr->size;
+}
+
+//////////////////////////////////////////////////
+void MappedFile::Prefetch(std::size_t _offset, std::size_t _size) const
+{
+  uint8_t *begin;
+  std::size_t length;
+  if (!this->dataPtr->PageRange(_offset, _size, begin, length))
+    return;
+#ifdef _WIN32
+  WIN32_MEMORY_RANGE_ENTRY range{begin, length};
+  PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+  madvise(begin, length, MADV_WILLNEED);
+#endif
+}
+
+//////////////////////////////////////////////////
+void MappedFile::Release(std::size_t _offset, std::size_t _size) const
+{
+  uint8_t *begin;
+  std::size_t length;
+  if (!this->dataPtr->PageRange(_offset, _size, begin, length))
+    return;
+#ifdef _WIN32
+  // Only whole pages can be released, and the contents stay readable.
+  VirtualUnlock(begin, length);
+#else
+  // Pages of a read-only file mapping are reloaded from the file if they
+  // are accessed again.
+  madvise(begin, length, MADV_DONTNEED);
+#endif
+}
+
+//////////////////////////////////////////////////
+MappedFile::~MappedFile()
+{
+  if (this->dataPtr)
+    this->dataPtr->Unmap();
+}
+
+//////////////////////////////////////////////////
+MappedFile::MappedFile(MappedFile &&_other) noexcept
+  : dataPtr(gz::utils::MakeUniqueImpl<Implementation>())
+{
+  std::swap(this->dataPtr, _other.dataPtr);
+}
+
+//////////////////////////////////////////////////
+MappedFile &MappedFile::operator=(MappedFile &&_other) noexcept
+{
+  if (this != &_other)
+  {
+    this->Close();
+    std::swap(this->dataPtr, _other.dataPtr);
+  }
+  return *this;
+}
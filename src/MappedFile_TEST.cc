@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+
+#include "gz/math/MappedFile.hh"
+
+using namespace gz;
+
+//////////////////////////////////////////////////
+TEST(MappedFileTest, Open)
+{
+  const std::string path =
+    (std::filesystem::temp_directory_path() / "MappedFileTest.bin").string();
+  std::string contents;
+  for (int i = 0; i < 20000; ++i)
+    contents.push_back(static_cast<char>(i % 251));
+  {
+    std::ofstream out(path, std::ios::binary);
+    out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+  }
+
+  math::MappedFile file;
+  EXPECT_FALSE(file.IsOpen());
+  EXPECT_EQ(nullptr, file.Data());
+  EXPECT_EQ(0u, file.Size());
+
+  ASSERT_TRUE(file.Open(path));
+  EXPECT_TRUE(file.IsOpen());
+  ASSERT_EQ(contents.size(), file.Size());
+  EXPECT_EQ(0, std::memcmp(contents.data(), file.Data(), file.Size()));
+
+  // Hints do not change the contents, and ranges are clipped.
+  file.Prefetch(5000, 10000);
+  file.Release(0, 30000);
+  file.Prefetch(30000, 10);
+  EXPECT_EQ(0, std::memcmp(contents.data(), file.Data(), file.Size()));
+
+  math::MappedFile moved(std::move(file));
+  EXPECT_TRUE(moved.IsOpen());
+  EXPECT_EQ(contents.size(), moved.Size());
+  EXPECT_EQ(contents[12345], static_cast<char>(moved.Data()[12345]));
+
+  moved.Close();
+  EXPECT_FALSE(moved.IsOpen());
+  EXPECT_EQ(nullptr, moved.Data());
+  EXPECT_EQ(0u, moved.Size());
+
+  std::filesystem::remove(path);
+}
+
+//////////////////////////////////////////////////
+TEST(MappedFileTest, Invalid)
+{
+  math::MappedFile file;
+  EXPECT_FALSE(file.Open("/this/file/does/not/exist"));
+  EXPECT_FALSE(file.IsOpen());
+
+  // Empty files cannot be mapped.
+  const std::string path =
+    (std::filesystem::temp_directory_path() / "MappedFileEmpty.bin").string();
+  std::ofstream(path).close();
+  EXPECT_FALSE(file.Open(path));
+  EXPECT_FALSE(file.IsOpen());
+  std::filesystem::remove(path);
+
+  // Hints without a file do nothing.
+  file.Prefetch(0, 100);
+  file.Release(0, 100);
+}
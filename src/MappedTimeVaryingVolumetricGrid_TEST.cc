@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <gz/math/MappedTimeVaryingVolumetricGrid.hh>
+#include <gz/math/Rand.hh>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace gz;
+using namespace math;
+
+namespace
+{
+/// \brief A small time varying field on a non uniform grid, with a hole.
+struct TestField
+{
+  std::vector<double> x{0, 1, 2.5, 3, 4, 6};
+  std::vector<double> y{-2, -1, 0, 1.5};
+  std::vector<double> z{0, 0.5, 1};
+  std::vector<double> times{0, 0.5, 1.5, 2};
+  std::vector<double> values;
+
+  TestField()
+  {
+    Rand::Seed(42);
+    values.resize(times.size() * x.size() * y.size() * z.size());
+    for (auto &value : values)
+      value = Rand::DblUniform(-10, 10);
+    // A missing point in the second frame.
+    values[x.size() * y.size() * z.size() + 7] =
+      std::numeric_limits<double>::quiet_NaN();
+  }
+
+  InMemoryTimeVaryingVolumetricGrid<double> BuildInMemory() const
+  {
+    InMemoryTimeVaryingVolumetricGridFactory<double, double> factory;
+    std::size_t i = 0;
+    for (double t : times)
+      for (double pz : z)
+        for (double py : y)
+          for (double px : x)
+          {
+            const double value = values[i++];
+            if (!std::isnan(value))
+              factory.AddPoint(t, Vector3d{px, py, pz}, value);
+          }
+    return factory.Build();
+  }
+};
+
+/// \brief Get a path for a temporary file.
+std::string TempPath(const std::string &_name)
+{
+  return (std::filesystem::temp_directory_path() / _name).string();
+}
+}
+
+/////////////////////////////////////////////////
+TEST(MappedTimeVaryingVolumetricGridTest, MatchesInMemoryGrid)
+{
+  const TestField data;
+  const std::string path = TempPath("MappedGridTest.gzgrid");
+  ASSERT_TRUE(WriteVolumetricGridFile(path, data.x, data.y, data.z,
+      data.times, data.values, VolumetricGridEncoding::FLOAT64, {{2, 3, 2}}));
+
+  MappedTimeVaryingVolumetricGrid<double> grid;
+  ASSERT_TRUE(grid.Open(path));
+  const auto memGrid = data.BuildInMemory();
+
+  auto bounds = grid.Bounds(grid.CreateSession());
+  auto memBounds = memGrid.Bounds(memGrid.CreateSession());
+  EXPECT_EQ(memBounds.first, bounds.first);
+  EXPECT_EQ(memBounds.second, bounds.second);
+
+  auto session = grid.CreateSession();
+  auto memSession = memGrid.CreateSession();
+  Rand::Seed(7);
+  for (double t = 0; t <= 2.01; t += 0.1)
+  {
+    auto next = grid.StepTo(session, t);
+    auto memNext = memGrid.StepTo(memSession, t);
+    ASSERT_EQ(memNext.has_value(), next.has_value()) << t;
+    if (next)
+    {
+      session = *next;
+      memSession = *memNext;
+    }
+    ASSERT_EQ(memGrid.IsValid(memSession), grid.IsValid(session));
+
+    for (int i = 0; i < 50; ++i)
+    {
+      Vector3d pos(Rand::DblUniform(-0.5, 6.5), Rand::DblUniform(-2.5, 2),
+                   Rand::DblUniform(-0.2, 1.2));
+      // Some queries on grid planes.
+      if (i % 5 == 0)
+        pos.X(data.x[i % data.x.size()]);
+      if (i % 7 == 0)
+        pos.Z(data.z[i % data.z.size()]);
+
+      auto value = grid.LookUp(session, pos);
+      auto memValue = memGrid.LookUp(memSession, pos);
+      ASSERT_EQ(memValue.has_value(), value.has_value()) << pos;
+      if (value)
+      {
+        EXPECT_DOUBLE_EQ(*memValue, *value) << t << " " << pos;
+      }
+    }
+  }
+
+  // Batches of lookups and lookups with a hint match single ones.
+  std::vector<Vector3d> positions;
+  for (int i = 0; i < 3000; ++i)
+  {
+    positions.emplace_back(Rand::DblUniform(-0.5, 6.5),
+      Rand::DblUniform(-2.5, 2), Rand::DblUniform(-0.2, 1.2));
+  }
+  auto batchSession = grid.CreateSession(0.7);
+  for (unsigned int threads : {1u, 3u})
+  {
+    std::vector<std::optional<double>> values;
+    grid.LookUp(batchSession, positions, values, threads);
+    ASSERT_EQ(positions.size(), values.size());
+    VolumetricGridLookupHint hint;
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+      auto value = grid.LookUp(batchSession, positions[i]);
+      auto hinted = grid.LookUp(batchSession, hint, positions[i]);
+      ASSERT_EQ(value.has_value(), values[i].has_value());
+      ASSERT_EQ(value.has_value(), hinted.has_value());
+      if (value)
+      {
+        EXPECT_DOUBLE_EQ(*value, *values[i]);
+        EXPECT_DOUBLE_EQ(*value, *hinted);
+      }
+    }
+  }
+
+  // Sessions created at a time.
+  for (double t : {-1.0, 0.0, 0.7, 2.0, 3.0})
+  {
+    auto s = grid.CreateSession(t);
+    auto memS = memGrid.CreateSession(t);
+    ASSERT_EQ(memGrid.IsValid(memS), grid.IsValid(s));
+    if (!grid.IsValid(s))
+      continue;
+    auto value = grid.LookUp(s, Vector3d(2, -0.5, 0.25));
+    auto memValue = memGrid.LookUp(memS, Vector3d(2, -0.5, 0.25));
+    ASSERT_TRUE(value.has_value());
+    EXPECT_DOUBLE_EQ(*memValue, *value);
+  }
+
+  std::filesystem::remove(path);
+}
+
+/////////////////////////////////////////////////
+TEST(MappedTimeVaryingVolumetricGridTest, BoundedCache)
+{
+  const TestField data;
+  const std::string path = TempPath("MappedGridCacheTest.gzgrid");
+  ASSERT_TRUE(WriteVolumetricGridFile(path, data.x, data.y, data.z,
+      data.times, data.values, VolumetricGridEncoding::FLOAT32, {{2, 2, 2}}));
+
+  MappedTimeVaryingVolumetricGrid<double> grid;
+  ASSERT_TRUE(grid.Open(path, 4));
+  EXPECT_EQ(4u, grid.CacheSize());
+  EXPECT_EQ(0u, grid.CachedTiles());
+  const auto memGrid = data.BuildInMemory();
+
+  auto session = grid.CreateSession(0.5);
+  auto memSession = memGrid.CreateSession(0.5);
+  session = *grid.StepTo(session, 1.0);
+  memSession = *memGrid.StepTo(memSession, 1.0);
+
+  Rand::Seed(3);
+  for (int i = 0; i < 200; ++i)
+  {
+    Vector3d pos(Rand::DblUniform(0, 6), Rand::DblUniform(-2, 1.5),
+                 Rand::DblUniform(0, 1));
+    auto value = grid.LookUp(session, pos);
+    auto memValue = memGrid.LookUp(memSession, pos);
+    ASSERT_TRUE(value.has_value());
+    // Values are stored as floats.
+    EXPECT_NEAR(*memValue, *value, 1e-5);
+    EXPECT_LE(grid.CachedTiles(), 4u);
+  }
+  EXPECT_EQ(4u, grid.CachedTiles());
+
+  grid.SetCacheSize(1);
+  EXPECT_EQ(1u, grid.CachedTiles());
+  EXPECT_TRUE(grid.LookUp(session, Vector3d(3, 0, 0.5)).has_value());
+
+  std::filesystem::remove(path);
+}
+
+/////////////////////////////////////////////////
+TEST(MappedTimeVaryingVolumetricGridTest, InvalidFiles)
+{
+  MappedTimeVaryingVolumetricGrid<double> grid;
+  EXPECT_FALSE(grid.IsOpen());
+  EXPECT_FALSE(grid.IsValid(grid.CreateSession()));
+  EXPECT_FALSE(grid.LookUp(grid.CreateSession(), Vector3d::Zero));
+  EXPECT_FALSE(grid.Open("/this/file/does/not/exist"));
+
+  const std::string path = TempPath("MappedGridInvalidTest.gzgrid");
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << std::string(256, 'x');
+  }
+  EXPECT_FALSE(grid.Open(path));
+  EXPECT_FALSE(grid.IsOpen());
+
+  // Mismatched sizes are rejected by the writer.
+  EXPECT_FALSE(WriteVolumetricGridFile(path, {0, 1}, {0, 1}, {0}, {0},
+      std::vector<double>{1, 2, 3}));
+  // So are unordered times.
+  EXPECT_FALSE(WriteVolumetricGridFile(path, {0}, {0}, {0}, {1, 0},
+      std::vector<double>{1, 2}));
+
+  // Truncated files are rejected.
+  ASSERT_TRUE(WriteVolumetricGridFile(path, {0, 1}, {0, 1}, {0, 1}, {0, 1},
+      std::vector<double>(16, 1.0)));
+  EXPECT_TRUE(grid.Open(path));
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+  EXPECT_FALSE(grid.Open(path));
+
+  std::filesystem::remove(path);
+}
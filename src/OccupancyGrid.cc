@@ -16,12 +16,23 @@
  */
 #include "gz/math/OccupancyGrid.hh"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
+#include <functional>
 #include <gz/utils/ImplPtr.hh>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "gz/math/detail/Error.hh"
+#include "gz/math/detail/ParallelFor.hh"
+
 using namespace gz;
 using namespace math;
 
@@ -30,6 +41,34 @@ using namespace math;
 class OccupancyGrid::Implementation
 {
 public:
+  // Cells are stored with 2 bits each, grouped in square tiles of
+  // kTileSize x kTileSize cells. Each tile row is one 32 bit word, so a
+  // whole tile fills exactly one 64 byte cache line. Tiles are only
+  // allocated once one of their cells becomes known, so large unexplored
+  // areas cost 4 bytes per tile.
+  static constexpr int kTileShift = 4;
+  static constexpr int kTileSize = 1 << kTileShift;
+  static constexpr int kTileMask = kTileSize - 1;
+  static constexpr uint32_t kNoTile = UINT32_MAX;
+
+  // Codes stored in the packed cells. Unknown must be zero so that newly
+  // allocated tiles start unknown.
+  static constexpr uint32_t kUnknownCode = 0u;
+  static constexpr uint32_t kFreeCode = 1u;
+  static constexpr uint32_t kOccupiedCode = 2u;
+
+  struct alignas(64) Tile
+  {
+    std::array<uint32_t, kTileSize> rows{};
+  };
+
+  // Tile of fixed point log-odds, used in log-odds mode.
+  template<typename T>
+  struct alignas(64) LogOddsTile
+  {
+    std::array<T, kTileSize * kTileSize> cells{};
+  };
+
   double resolutionMeters;
   int widthCells;
   int heightCells;
@@ -38,12 +77,938 @@ public:
   double originX;
   double originY;
 
-  std::vector<OccupancyCellState> gridData;
+  // Number of tiles along each axis
+  int tilesX;
+  int tilesY;
+
+  // Index into tiles for each tile of the grid, tile-major, or kNoTile if
+  // the tile was never allocated (all of its cells are unknown).
+  std::vector<uint32_t> tileIndex;
+
+  // Allocated tiles
+  std::vector<Tile> tiles;
+
+  // In log-odds mode, tileIndex refers to logOddsTiles8 or logOddsTiles16
+  // (depending on the precision) instead of tiles, and the state of each
+  // cell is derived from its log-odds.
+  bool logOdds{false};
+
+  // Log-odds parameters
+  OccupancyLogOddsParams logOddsParams;
+
+  // Fixed point scale: stored value = log-odds * logOddsScale
+  double logOddsScale{1.0};
+
+  // Quantized log-odds parameters
+  int hitQ{0};
+  int missQ{0};
+  int minQ{0};
+  int maxQ{0};
+  int occupiedQ{0};
+  int freeQ{0};
+
+  // Allocated log-odds tiles
+  std::vector<LogOddsTile<int8_t>> logOddsTiles8;
+  std::vector<LogOddsTile<int16_t>> logOddsTiles16;
+
+  // Radius of the information gain map in cells, 0 if it is disabled
+  int gainRadius{0};
+
+  // Visibility tree of the information gain map. Each node is a prefix of
+  // the lines of sight from a viewpoint. Nodes are in depth-first order, so
+  // the subtree of node i ends at gainNodeEnds[i]. The offsets of the cells
+  // within gainRadius whose line of sight, without the cell itself, is the
+  // prefix of node i are listed in gainTargets, from gainTargetStarts[i]
+  // to gainTargetStarts[i+1]. The nodes whose prefix ends with the cell of
+  // offset (dx, dy) are listed in gainCellNodes, from gainCellNodeStarts[k]
+  // to gainCellNodeStarts[k+1] with k = (dy + r) * (2r + 1) + dx + r.
+  std::vector<int> gainNodeEnds;
+  std::vector<std::size_t> gainTargetStarts;
+  std::vector<std::pair<int, int>> gainTargets;
+  std::vector<std::size_t> gainCellNodeStarts;
+  std::vector<int> gainCellNodes;
+
+  // Information gain of each cell, in row-major order
+  std::vector<int32_t> gains;
+
+  // Tiles whose cells changed since the last update of the gain map
+  std::vector<uint8_t> gainDirty;
+  bool gainAnyDirty{false};
+
+  // Whether the distance field has been computed and is kept up to date
+  bool distanceEnabled{false};
+
+  // Index of the nearest occupied cell of each cell, or -1 if there is none
+  std::vector<int32_t> nearest;
+
+  // Distance of each cell to the nearest occupied cell in meters
+  std::vector<float> distances;
+
+  // Occupied cells as of the last update of the distance field
+  std::vector<uint8_t> distanceOccupied;
+
+  // Cells whose nearest obstacle was removed during an incremental update.
+  // All zero between updates.
+  std::vector<uint8_t> distanceRaise;
+
+  // Tiles whose cells changed since the last update of the distance field
+  std::vector<uint8_t> distanceDirty;
+  bool distanceAnyDirty{false};
+
+  // Convert a cell state into its packed code
+  static uint32_t Encode(OccupancyCellState _state)
+  {
+    switch (_state)
+    {
+      case OccupancyCellState::Free:
+        return kFreeCode;
+      case OccupancyCellState::Occupied:
+        return kOccupiedCode;
+      case OccupancyCellState::Unknown:
+      default:
+        return kUnknownCode;
+    }
+  }
+
+  // Convert a packed code into a cell state
+  static OccupancyCellState Decode(uint32_t _code)
+  {
+    switch (_code)
+    {
+      case kFreeCode:
+        return OccupancyCellState::Free;
+      case kOccupiedCode:
+        return OccupancyCellState::Occupied;
+      default:
+        return OccupancyCellState::Unknown;
+    }
+  }
+
+  // Helper to get the tile slot from 2D grid coordinates
+  int GetTileSlot(int _gridX, int _gridY) const
+  {
+    return (_gridY >> kTileShift) * this->tilesX + (_gridX >> kTileShift);
+  }
+
+  // Flag a tile as changed for the information gain map and the distance
+  // field.
+  void MarkTileDirty(int _slot)
+  {
+    if (this->gainRadius > 0)
+    {
+      this->gainDirty[_slot] = 1u;
+      this->gainAnyDirty = true;
+    }
+    if (this->distanceEnabled)
+    {
+      this->distanceDirty[_slot] = 1u;
+      this->distanceAnyDirty = true;
+    }
+  }
+
+  // Flag the tile of a cell as changed.
+  void MarkDirty(int _gridX, int _gridY)
+  {
+    this->MarkTileDirty(this->GetTileSlot(_gridX, _gridY));
+  }
+
+  // Flag the tiles overlapping a box of cells as changed.
+  void MarkDirty(int _minX, int _minY, int _maxX, int _maxY)
+  {
+    if (this->gainRadius <= 0 && !this->distanceEnabled)
+      return;
+    for (int ty = _minY >> kTileShift; ty <= _maxY >> kTileShift; ++ty)
+    {
+      for (int tx = _minX >> kTileShift; tx <= _maxX >> kTileShift; ++tx)
+        this->MarkTileDirty(ty * this->tilesX + tx);
+    }
+  }
+
+  // Call _func with the log-odds tiles of the configured precision.
+  template<typename Self, typename Func>
+  static decltype(auto) WithLogOddsTiles(Self &_self, const Func &_func)
+  {
+    if (_self.logOddsParams.precision == OccupancyLogOddsPrecision::Int8)
+      return _func(_self.logOddsTiles8);
+    return _func(_self.logOddsTiles16);
+  }
+
+  // Get the fixed point log-odds of a cell. Coordinates must be valid.
+  int LogOddsValue(int _gridX, int _gridY) const
+  {
+    const uint32_t tile = this->tileIndex[this->GetTileSlot(_gridX, _gridY)];
+    if (tile == kNoTile)
+      return 0;
+    const int cell = (_gridY & kTileMask) * kTileSize + (_gridX & kTileMask);
+    return WithLogOddsTiles(*this, [&](const auto &_tiles)
+    {
+      return static_cast<int>(_tiles[tile].cells[cell]);
+    });
+  }
+
+  // Get a row of fixed point log-odds, allocating the tile if needed.
+  template<typename T>
+  T *LogOddsTileRow(std::vector<LogOddsTile<T>> &_tiles, int _tileX,
+                    int _gridY)
+  {
+    uint32_t &tile =
+      this->tileIndex[(_gridY >> kTileShift) * this->tilesX + _tileX];
+    if (tile == kNoTile)
+    {
+      tile = static_cast<uint32_t>(_tiles.size());
+      _tiles.emplace_back();
+    }
+    return _tiles[tile].cells.data() + (_gridY & kTileMask) * kTileSize;
+  }
+
+  // Set the fixed point log-odds of a cell. Coordinates must be valid.
+  void LogOddsValue(int _gridX, int _gridY, int _value)
+  {
+    this->MarkDirty(_gridX, _gridY);
+    if (_value == 0 &&
+        this->tileIndex[this->GetTileSlot(_gridX, _gridY)] == kNoTile)
+    {
+      return;
+    }
+    WithLogOddsTiles(*this, [&](auto &_tiles)
+    {
+      auto *row = this->LogOddsTileRow(_tiles, _gridX >> kTileShift, _gridY);
+      using T = std::remove_pointer_t<decltype(row)>;
+      row[_gridX & kTileMask] = static_cast<T>(_value);
+    });
+  }
+
+  // Add a fixed point increment to the log-odds of a cell, saturating at
+  // the clamping bounds. Coordinates must be valid.
+  void Observe(int _gridX, int _gridY, int _delta)
+  {
+    this->LogOddsValue(_gridX, _gridY, std::clamp(
+        this->LogOddsValue(_gridX, _gridY) + _delta, this->minQ, this->maxQ));
+  }
+
+  // Add the miss increment to the cells of a tile row whose bit is set in
+  // _free and the hit increment to the cells whose bit is set in _hit.
+  // The loop has no branches so that it can be vectorized.
+  template<typename T>
+  void UpdateLogOddsRow(T *_row, uint32_t _free, uint32_t _hit) const
+  {
+    for (int i = 0; i < kTileSize; ++i)
+    {
+      const int delta =
+        static_cast<int>((_free >> i) & 1u) * this->missQ +
+        static_cast<int>((_hit >> i) & 1u) * this->hitQ;
+      _row[i] = static_cast<T>(std::clamp(static_cast<int>(_row[i]) + delta,
+                                          this->minQ, this->maxQ));
+    }
+  }
+
+  // Get the code of a fixed point log-odds value
+  uint32_t LogOddsCode(int _value) const
+  {
+    if (_value > this->occupiedQ)
+      return kOccupiedCode;
+    if (_value < this->freeQ)
+      return kFreeCode;
+    return kUnknownCode;
+  }
 
-  // Helper to get the 1D index from 2D grid coordinates
-  int GetIndex(int _gridX, int _gridY) const
+  // Get the packed code of a cell. Coordinates must be valid.
+  uint32_t Code(int _gridX, int _gridY) const
   {
-    return _gridY * this->widthCells + _gridX;
+    if (this->logOdds)
+      return this->LogOddsCode(this->LogOddsValue(_gridX, _gridY));
+
+    const uint32_t tile = this->tileIndex[this->GetTileSlot(_gridX, _gridY)];
+    if (tile == kNoTile)
+      return kUnknownCode;
+    const uint32_t row = this->tiles[tile].rows[_gridY & kTileMask];
+    return (row >> ((_gridX & kTileMask) * 2)) & 3u;
+  }
+
+  // Set the packed code of a cell. Coordinates must be valid.
+  void Code(int _gridX, int _gridY, uint32_t _code)
+  {
+    if (this->logOdds)
+    {
+      int value = 0;
+      if (_code == kOccupiedCode)
+        value = this->maxQ;
+      else if (_code == kFreeCode)
+        value = this->minQ;
+      this->LogOddsValue(_gridX, _gridY, value);
+      return;
+    }
+
+    this->MarkDirty(_gridX, _gridY);
+    uint32_t &tile = this->tileIndex[this->GetTileSlot(_gridX, _gridY)];
+    if (tile == kNoTile)
+    {
+      if (_code == kUnknownCode)
+        return;
+      tile = static_cast<uint32_t>(this->tiles.size());
+      this->tiles.emplace_back();
+    }
+    uint32_t &row = this->tiles[tile].rows[_gridY & kTileMask];
+    const int shift = (_gridX & kTileMask) * 2;
+    row = (row & ~(3u << shift)) | (_code << shift);
+  }
+
+  // Get a row of packed codes of a tile, allocating the tile if needed.
+  uint32_t &TileRow(int _tileX, int _gridY)
+  {
+    uint32_t &tile =
+      this->tileIndex[(_gridY >> kTileShift) * this->tilesX + _tileX];
+    if (tile == kNoTile)
+    {
+      tile = static_cast<uint32_t>(this->tiles.size());
+      this->tiles.emplace_back();
+    }
+    return this->tiles[tile].rows[_gridY & kTileMask];
+  }
+
+  // Call _func(gridX, gridY, code) for every cell, in row-major order.
+  template<typename Func>
+  void ForEachCell(const Func &_func) const
+  {
+    if (this->logOdds)
+    {
+      WithLogOddsTiles(*this, [&](const auto &_tiles)
+      {
+        for (int gridY = 0; gridY < this->heightCells; ++gridY)
+        {
+          const int tileRow = (gridY >> kTileShift) * this->tilesX;
+          const int rowOffset = (gridY & kTileMask) * kTileSize;
+          for (int tx = 0; tx < this->tilesX; ++tx)
+          {
+            const int x0 = tx << kTileShift;
+            const int x1 = std::min(x0 + kTileSize, this->widthCells);
+            const uint32_t tile = this->tileIndex[tileRow + tx];
+            for (int gridX = x0; gridX < x1; ++gridX)
+            {
+              const int value = (tile == kNoTile) ? 0 :
+                _tiles[tile].cells[rowOffset + gridX - x0];
+              _func(gridX, gridY, this->LogOddsCode(value));
+            }
+          }
+        }
+      });
+      return;
+    }
+
+    for (int gridY = 0; gridY < this->heightCells; ++gridY)
+    {
+      const int tileRow = (gridY >> kTileShift) * this->tilesX;
+      for (int tx = 0; tx < this->tilesX; ++tx)
+      {
+        const int x0 = tx << kTileShift;
+        const int x1 = std::min(x0 + kTileSize, this->widthCells);
+        const uint32_t tile = this->tileIndex[tileRow + tx];
+        uint32_t row = 0;
+        if (tile != kNoTile)
+          row = this->tiles[tile].rows[gridY & kTileMask];
+        for (int gridX = x0; gridX < x1; ++gridX, row >>= 2)
+          _func(gridX, gridY, row & 3u);
+      }
+    }
+  }
+
+  // Call _func(gridX, gridY) for every cell crossed by Bresenham's line
+  // from (_x0, _y0) to (_x1, _y1), both included. The cells may be
+  // reported in reverse order. On a binary grid MarkLine does not match
+  // this line: it skips the error update after each occupied cell, so it
+  // drifts away from the line once it crosses an obstacle.
+  template<typename Func>
+  static void ForEachLineCell(int _x0, int _y0, int _x1, int _y1,
+                              const Func &_func)
+  {
+    const bool steep = std::abs(_y1 - _y0) > std::abs(_x1 - _x0);
+    if (steep)
+    {
+      std::swap(_x0, _y0);
+      std::swap(_x1, _y1);
+    }
+    if (_x0 > _x1)
+    {
+      std::swap(_x0, _x1);
+      std::swap(_y0, _y1);
+    }
+
+    const int dx = _x1 - _x0;
+    const int dy = std::abs(_y1 - _y0);
+    const int yStep = (_y0 < _y1) ? 1 : -1;
+    int error = dx / 2;
+    int y = _y0;
+
+    // Two copies of the loop keep the steep test out of the hot path.
+    if (steep)
+    {
+      for (int x = _x0; x <= _x1; ++x)
+      {
+        _func(y, x);
+        error -= dy;
+        if (error < 0)
+        {
+          y += yStep;
+          error += dx;
+        }
+      }
+    }
+    else
+    {
+      for (int x = _x0; x <= _x1; ++x)
+      {
+        _func(x, y);
+        error -= dy;
+        if (error < 0)
+        {
+          y += yStep;
+          error += dx;
+        }
+      }
+    }
+  }
+
+  // Build the visibility tree of the information gain map. The line of
+  // sight to each cell within _radius is the same Bresenham line traced by
+  // CalculateIGain. These lines do not extend each other: the line to a
+  // cell may differ from the line to its previous cell on the line. Each
+  // cell is therefore visible exactly when the whole prefix of its own
+  // line is clear, and lines share the nodes of their common prefixes.
+  void BuildGainTree(int _radius)
+  {
+    const int side = 2 * _radius + 1;
+    auto key = [&](const std::pair<int, int> &_offset)
+    {
+      return (_offset.second + _radius) * side + _offset.first + _radius;
+    };
+
+    // Trie of the lines of sight, in creation order. Node 0 is the
+    // viewpoint, which starts every line.
+    std::vector<std::pair<int, int>> cells{{0, 0}};
+    std::vector<std::vector<int>> children(1);
+    std::vector<std::vector<std::pair<int, int>>> targets(1);
+    std::unordered_map<int64_t, int> childIndex;
+    std::vector<std::pair<int, int>> line;
+    for (int dy = -_radius; dy <= _radius; ++dy)
+    {
+      for (int dx = -_radius; dx <= _radius; ++dx)
+      {
+        if ((dx == 0 && dy == 0) || dx * dx + dy * dy > _radius * _radius)
+          continue;
+
+        line.clear();
+        ForEachLineCell(0, 0, dx, dy, [&](int _x, int _y)
+        {
+          line.emplace_back(_x, _y);
+        });
+        if (line.front() != std::make_pair(0, 0))
+          std::reverse(line.begin(), line.end());
+
+        int node = 0;
+        for (std::size_t k = 1; k + 1 < line.size(); ++k)
+        {
+          const int64_t childKey =
+            static_cast<int64_t>(node) * side * side + key(line[k]);
+          const auto inserted = childIndex.emplace(
+              childKey, static_cast<int>(cells.size()));
+          if (inserted.second)
+          {
+            cells.push_back(line[k]);
+            children.emplace_back();
+            targets.emplace_back();
+            children[node].push_back(inserted.first->second);
+          }
+          node = inserted.first->second;
+        }
+        targets[node].emplace_back(dx, dy);
+      }
+    }
+
+    // Depth-first order, so that the targets hidden by a blocked cell are
+    // contiguous.
+    std::vector<int> nodeKeys;
+    this->gainNodeEnds.assign(cells.size(), 0);
+    this->gainTargetStarts.assign(1, 0);
+    this->gainTargets.clear();
+    // Stack of the nodes being visited, with their position in the
+    // depth-first order and the index of their next child.
+    struct Visit
+    {
+      int node;
+      int position;
+      std::size_t nextChild;
+    };
+    std::vector<Visit> stack;
+    auto enter = [&](int _node)
+    {
+      stack.push_back({_node, static_cast<int>(nodeKeys.size()), 0u});
+      nodeKeys.push_back(key(cells[_node]));
+      this->gainTargets.insert(this->gainTargets.end(),
+                               targets[_node].begin(), targets[_node].end());
+      this->gainTargetStarts.push_back(this->gainTargets.size());
+    };
+    enter(0);
+    while (!stack.empty())
+    {
+      Visit &visit = stack.back();
+      if (visit.nextChild < children[visit.node].size())
+      {
+        enter(children[visit.node][visit.nextChild++]);
+      }
+      else
+      {
+        this->gainNodeEnds[visit.position] =
+          static_cast<int>(nodeKeys.size());
+        stack.pop_back();
+      }
+    }
+
+    this->gainCellNodeStarts.assign(static_cast<std::size_t>(side) * side + 1,
+                                    0u);
+    for (int nodeKey : nodeKeys)
+      ++this->gainCellNodeStarts[nodeKey + 1];
+    std::partial_sum(this->gainCellNodeStarts.begin(),
+                     this->gainCellNodeStarts.end(),
+                     this->gainCellNodeStarts.begin());
+    this->gainCellNodes.resize(nodeKeys.size());
+    std::vector<std::size_t> next(this->gainCellNodeStarts.begin(),
+                                  this->gainCellNodeStarts.end() - 1);
+    for (std::size_t n = 0; n < nodeKeys.size(); ++n)
+      this->gainCellNodes[next[nodeKeys[n]]++] = static_cast<int>(n);
+  }
+
+  // Recompute the information gain of the viewpoints that may see a cell
+  // of a dirty tile.
+  void UpdateGains(unsigned int _threads)
+  {
+    // Code of the cells outside of the grid in the snapshot below. Like
+    // occupied cells, they block the line of sight.
+    constexpr uint8_t kOutsideCode = 3u;
+
+    if (!this->gainAnyDirty)
+      return;
+
+    // Tiles containing the viewpoints to update.
+    const int reach = (this->gainRadius + kTileMask) >> kTileShift;
+    std::vector<uint8_t> affected(this->gainDirty.size(), 0u);
+    int minTileX = this->tilesX, maxTileX = -1;
+    int minTileY = this->tilesY, maxTileY = -1;
+    for (int ty = 0; ty < this->tilesY; ++ty)
+    {
+      for (int tx = 0; tx < this->tilesX; ++tx)
+      {
+        if (!this->gainDirty[ty * this->tilesX + tx])
+          continue;
+        const int y0 = std::max(ty - reach, 0);
+        const int y1 = std::min(ty + reach, this->tilesY - 1);
+        const int x0 = std::max(tx - reach, 0);
+        const int x1 = std::min(tx + reach, this->tilesX - 1);
+        for (int y = y0; y <= y1; ++y)
+          std::fill_n(affected.begin() + y * this->tilesX + x0, x1 - x0 + 1,
+                      uint8_t{1});
+        minTileX = std::min(minTileX, x0);
+        maxTileX = std::max(maxTileX, x1);
+        minTileY = std::min(minTileY, y0);
+        maxTileY = std::max(maxTileY, y1);
+      }
+    }
+    std::fill(this->gainDirty.begin(), this->gainDirty.end(), uint8_t{0});
+    this->gainAnyDirty = false;
+    if (maxTileX < 0)
+      return;
+
+    std::vector<int> tileList;
+    for (int t = 0; t < static_cast<int>(affected.size()); ++t)
+    {
+      if (affected[t])
+        tileList.push_back(t);
+    }
+
+    // Snapshot of the cell codes around the viewpoints, with a margin of
+    // gainRadius cells so that no bounds check is needed while counting.
+    const int r = this->gainRadius;
+    const int snapX0 = (minTileX << kTileShift) - r;
+    const int snapY0 = (minTileY << kTileShift) - r;
+    const int snapX1 = std::min((maxTileX + 1) << kTileShift,
+                                this->widthCells) - 1 + r;
+    const int snapY1 = std::min((maxTileY + 1) << kTileShift,
+                                this->heightCells) - 1 + r;
+    const int stride = snapX1 - snapX0 + 1;
+    std::vector<uint8_t> snapshot(
+        static_cast<std::size_t>(stride) * (snapY1 - snapY0 + 1),
+        kOutsideCode);
+    for (int y = std::max(snapY0, 0);
+         y <= std::min(snapY1, this->heightCells - 1); ++y)
+    {
+      uint8_t *row = snapshot.data() +
+        static_cast<std::size_t>(y - snapY0) * stride - snapX0;
+      for (int x = std::max(snapX0, 0);
+           x <= std::min(snapX1, this->widthCells - 1); ++x)
+      {
+        row[x] = static_cast<uint8_t>(this->Code(x, y));
+      }
+    }
+
+    // Prefix sums of the blocking and unknown cells along the rows of the
+    // snapshot. Sums wrap around on huge grids, which does not change the
+    // differences.
+    const int rows = snapY1 - snapY0 + 1;
+    const std::size_t sumStride = static_cast<std::size_t>(stride) + 1;
+    std::vector<uint32_t> blockedSums(sumStride * rows, 0u);
+    std::vector<uint32_t> unknownSums(sumStride * rows, 0u);
+    for (int y = 0; y < rows; ++y)
+    {
+      const uint8_t *row =
+        snapshot.data() + static_cast<std::size_t>(y) * stride;
+      uint32_t *blocked = blockedSums.data() + y * sumStride;
+      uint32_t *unknown = unknownSums.data() + y * sumStride;
+      for (int x = 0; x < stride; ++x)
+      {
+        blocked[x + 1] = blocked[x] + (row[x] >= kOccupiedCode);
+        unknown[x + 1] = unknown[x] + (row[x] == kUnknownCode);
+      }
+    }
+
+    // Half width of the disk on each of its rows.
+    std::vector<int> halfWidths(2 * r + 1, 0);
+    for (int dy = -r; dy <= r; ++dy)
+    {
+      int &width = halfWidths[dy + r];
+      while ((width + 1) * (width + 1) + dy * dy <= r * r)
+        ++width;
+    }
+
+    const int nodes = static_cast<int>(this->gainNodeEnds.size());
+    const int side = 2 * r + 1;
+    std::vector<std::ptrdiff_t> targetLinear(this->gainTargets.size());
+    std::transform(this->gainTargets.begin(), this->gainTargets.end(),
+        targetLinear.begin(), [stride](const std::pair<int, int> &_offset)
+        {
+          return static_cast<std::ptrdiff_t>(_offset.second) * stride +
+            _offset.first;
+        });
+
+    // Each tile covers many cells.
+    const unsigned int threads =
+      detail::ThreadCount(_threads, tileList.size(), 4);
+    detail::ParallelFor(tileList.size(), threads,
+        [&](std::size_t _begin, std::size_t _end, unsigned int)
+        {
+          // Nodes of the tree whose last cell blocks the line of sight.
+          std::vector<uint8_t> blockedNodes(nodes, 0u);
+          std::vector<int> marked;
+          for (auto t = _begin; t < _end; ++t)
+          {
+            const int tileX = tileList[t] % this->tilesX;
+            const int tileY = tileList[t] / this->tilesX;
+            const int x0 = tileX << kTileShift;
+            const int y0 = tileY << kTileShift;
+            const int x1 = std::min(x0 + kTileSize, this->widthCells);
+            const int y1 = std::min(y0 + kTileSize, this->heightCells);
+            for (int y = y0; y < y1; ++y)
+            {
+              for (int x = x0; x < x1; ++x)
+              {
+                const int sx = x - snapX0;
+                const int sy = y - snapY0;
+                const uint8_t *center = snapshot.data() +
+                  static_cast<std::size_t>(sy) * stride + sx;
+
+                // Count the unknown cells of the disk, and find its
+                // blocking cells in the rows that have some.
+                uint32_t gain = 0u;
+                marked.clear();
+                for (int dy = -r; dy <= r; ++dy)
+                {
+                  const int width = halfWidths[dy + r];
+                  const std::size_t rowStart = (sy + dy) * sumStride;
+                  const uint32_t *unknown = unknownSums.data() + rowStart;
+                  const uint32_t *blocked = blockedSums.data() + rowStart;
+                  gain += unknown[sx + width + 1] - unknown[sx - width];
+                  if (blocked[sx + width + 1] == blocked[sx - width])
+                    continue;
+
+                  const uint8_t *row = center + dy * stride;
+                  for (int dx = -width; dx <= width; ++dx)
+                  {
+                    if (row[dx] < kOccupiedCode)
+                      continue;
+                    const int cell = (dy + r) * side + dx + r;
+                    for (std::size_t k = this->gainCellNodeStarts[cell];
+                         k < this->gainCellNodeStarts[cell + 1]; ++k)
+                    {
+                      blockedNodes[this->gainCellNodes[k]] = 1u;
+                      marked.push_back(this->gainCellNodes[k]);
+                    }
+                  }
+                }
+
+                // The targets below a blocked node are hidden. Nested
+                // blocked nodes are skipped with the subtree of the first.
+                for (int n = 0; !marked.empty();)
+                {
+                  n = static_cast<int>(std::find(blockedNodes.begin() + n,
+                      blockedNodes.end(), 1u) - blockedNodes.begin());
+                  if (n == nodes)
+                    break;
+                  for (std::size_t k = this->gainTargetStarts[n];
+                       k < this->gainTargetStarts[this->gainNodeEnds[n]];
+                       ++k)
+                  {
+                    gain -= (center[targetLinear[k]] == kUnknownCode);
+                  }
+                  n = this->gainNodeEnds[n];
+                }
+                for (int n : marked)
+                  blockedNodes[n] = 0u;
+
+                this->gains[static_cast<std::size_t>(y) * this->widthCells +
+                            x] = static_cast<int32_t>(gain);
+              }
+            }
+          }
+        });
+  }
+
+  // Squared distance in cells between two cells given by their indices.
+  int64_t DistanceSquared(int32_t _a, int32_t _b) const
+  {
+    const int64_t dx = _a % this->widthCells - _b % this->widthCells;
+    const int64_t dy = _a / this->widthCells - _b / this->widthCells;
+    return dx * dx + dy * dy;
+  }
+
+  // Set the nearest obstacle of a cell, or -1 to clear it.
+  void Nearest(int32_t _cell, int32_t _obstacle)
+  {
+    this->nearest[_cell] = _obstacle;
+    this->distances[_cell] = (_obstacle < 0) ?
+      std::numeric_limits<float>::infinity() :
+      static_cast<float>(std::sqrt(static_cast<double>(
+          this->DistanceSquared(_cell, _obstacle))) * this->resolutionMeters);
+  }
+
+  // Compute the distance field from scratch with the algorithm of
+  // Felzenszwalb and Huttenlocher, "Distance Transforms of Sampled
+  // Functions". Columns and then rows are processed independently, so each
+  // pass is split among threads.
+  void ComputeDistances(unsigned int _threads)
+  {
+    const int width = std::max(this->widthCells, 0);
+    const int height = std::max(this->heightCells, 0);
+    const std::size_t count = static_cast<std::size_t>(width) * height;
+    this->distanceOccupied.assign(count, 0u);
+    this->ForEachCell([&](int _x, int _y, uint32_t _code)
+    {
+      this->distanceOccupied[static_cast<std::size_t>(_y) * width + _x] =
+        (_code == kOccupiedCode);
+    });
+    this->nearest.assign(count, -1);
+    this->distances.assign(count, std::numeric_limits<float>::infinity());
+    this->distanceRaise.assign(count, 0u);
+    this->distanceDirty.assign(this->tileIndex.size(), 0u);
+    this->distanceAnyDirty = false;
+    this->distanceEnabled = true;
+
+    // Column pass: nearest occupied row in the same column, found with one
+    // downward and one upward sweep. Threads take ranges of columns but
+    // walk them row by row, to read memory in order.
+    std::vector<int32_t> rows(count, -1);
+    // Each column or row spans the whole grid.
+    const unsigned int columnThreads = detail::ThreadCount(
+        _threads, static_cast<std::size_t>(width), 64);
+    detail::ParallelFor(static_cast<std::size_t>(width), columnThreads,
+        [&](std::size_t _begin, std::size_t _end, unsigned int)
+        {
+          for (int y = 0; y < height; ++y)
+          {
+            const std::size_t row = static_cast<std::size_t>(y) * width;
+            for (std::size_t x = _begin; x < _end; ++x)
+            {
+              if (this->distanceOccupied[row + x])
+                rows[row + x] = y;
+              else if (y > 0)
+                rows[row + x] = rows[row - width + x];
+            }
+          }
+          for (int y = height - 2; y >= 0; --y)
+          {
+            const std::size_t row = static_cast<std::size_t>(y) * width;
+            for (std::size_t x = _begin; x < _end; ++x)
+            {
+              const int32_t below = rows[row + width + x];
+              if (below >= 0 &&
+                  (rows[row + x] < 0 || below - y < y - rows[row + x]))
+              {
+                rows[row + x] = below;
+              }
+            }
+          }
+        });
+
+    // Row pass: lower envelope of the parabolas (x - q)^2 + f(q), where
+    // f(q) is the squared column distance of cell q.
+    const unsigned int rowThreads = detail::ThreadCount(
+        _threads, static_cast<std::size_t>(height), 64);
+    detail::ParallelFor(static_cast<std::size_t>(height), rowThreads,
+        [&](std::size_t _begin, std::size_t _end, unsigned int)
+        {
+          std::vector<int> sites(width);
+          std::vector<double> bounds(width + 1);
+          std::vector<double> f(width);
+          for (auto y = static_cast<int>(_begin);
+               y < static_cast<int>(_end); ++y)
+          {
+            const std::size_t row = static_cast<std::size_t>(y) * width;
+            int k = -1;
+            for (int q = 0; q < width; ++q)
+            {
+              if (rows[row + q] < 0)
+                continue;
+              const double dy = rows[row + q] - y;
+              f[q] = dy * dy;
+              double s = 0;
+              while (k >= 0)
+              {
+                const int v = sites[k];
+                s = ((f[q] + static_cast<double>(q) * q) -
+                     (f[v] + static_cast<double>(v) * v)) / (2.0 * (q - v));
+                if (s > bounds[k])
+                  break;
+                --k;
+              }
+              ++k;
+              sites[k] = q;
+              bounds[k] = (k == 0) ?
+                -std::numeric_limits<double>::infinity() : s;
+            }
+            if (k < 0)
+              continue;
+            bounds[k + 1] = std::numeric_limits<double>::infinity();
+
+            int j = 0;
+            for (int x = 0; x < width; ++x)
+            {
+              while (bounds[j + 1] < x)
+                ++j;
+              const int32_t cell = static_cast<int32_t>(row) + x;
+              this->Nearest(cell,
+                  rows[row + sites[j]] * width + sites[j]);
+            }
+          }
+        });
+  }
+
+  // Update the distance field around the cells that changed since the
+  // last update, with the dynamic brushfire algorithm of Lau et al.,
+  // "Efficient grid-based spatial representations for robot navigation in
+  // dynamic environments". Cells that lost their nearest obstacle are
+  // cleared by a raise wave, and then a lower wave propagates the remaining
+  // and new obstacles, both in order of distance.
+  void UpdateDistances()
+  {
+    if (!this->distanceAnyDirty)
+      return;
+
+    using Entry = std::pair<int64_t, int32_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+
+    const int width = this->widthCells;
+    for (int ty = 0; ty < this->tilesY; ++ty)
+    {
+      for (int tx = 0; tx < this->tilesX; ++tx)
+      {
+        if (!this->distanceDirty[ty * this->tilesX + tx])
+          continue;
+        const int x0 = tx << kTileShift;
+        const int y0 = ty << kTileShift;
+        const int x1 = std::min(x0 + kTileSize, width);
+        const int y1 = std::min(y0 + kTileSize, this->heightCells);
+        for (int y = y0; y < y1; ++y)
+        {
+          for (int x = x0; x < x1; ++x)
+          {
+            const int32_t cell = y * width + x;
+            const uint8_t occupied = (this->Code(x, y) == kOccupiedCode);
+            if (occupied == this->distanceOccupied[cell])
+              continue;
+            this->distanceOccupied[cell] = occupied;
+            if (occupied)
+            {
+              this->Nearest(cell, cell);
+              this->distanceRaise[cell] = 0u;
+            }
+            else
+            {
+              this->Nearest(cell, -1);
+              this->distanceRaise[cell] = 1u;
+            }
+            open.emplace(0, cell);
+          }
+        }
+      }
+    }
+    std::fill(this->distanceDirty.begin(), this->distanceDirty.end(),
+              uint8_t{0});
+    this->distanceAnyDirty = false;
+
+    auto forEachNeighbor = [&](int32_t _cell, const auto &_func)
+    {
+      const int x = _cell % width;
+      const int y = _cell / width;
+      for (int ny = std::max(y - 1, 0);
+           ny <= std::min(y + 1, this->heightCells - 1); ++ny)
+      {
+        for (int nx = std::max(x - 1, 0); nx <= std::min(x + 1, width - 1);
+             ++nx)
+        {
+          if (nx != x || ny != y)
+            _func(ny * width + nx);
+        }
+      }
+    };
+
+    while (!open.empty())
+    {
+      const int32_t cell = open.top().second;
+      open.pop();
+      if (this->distanceRaise[cell])
+      {
+        forEachNeighbor(cell, [&](int32_t _neighbor)
+        {
+          const int32_t obstacle = this->nearest[_neighbor];
+          if (obstacle < 0 || this->distanceRaise[_neighbor])
+            return;
+          open.emplace(this->DistanceSquared(_neighbor, obstacle),
+                       _neighbor);
+          if (!this->distanceOccupied[obstacle])
+          {
+            this->Nearest(_neighbor, -1);
+            this->distanceRaise[_neighbor] = 1u;
+          }
+        });
+        this->distanceRaise[cell] = 0u;
+      }
+      else if (this->nearest[cell] >= 0 &&
+               this->distanceOccupied[this->nearest[cell]])
+      {
+        const int32_t obstacle = this->nearest[cell];
+        forEachNeighbor(cell, [&](int32_t _neighbor)
+        {
+          if (this->distanceRaise[_neighbor])
+            return;
+          const int64_t distance =
+            this->DistanceSquared(_neighbor, obstacle);
+          const int32_t current = this->nearest[_neighbor];
+          if (current < 0 ||
+              distance < this->DistanceSquared(_neighbor, current))
+          {
+            this->Nearest(_neighbor, obstacle);
+            open.emplace(distance, _neighbor);
+          }
+        });
+      }
+    }
   }
 
   // Constructor for Impl
@@ -54,7 +1019,9 @@ public:
         heightCells(_heightCells),
         originX(_originX),
         originY(_originY),
-        gridData(_widthCells * _heightCells, OccupancyCellState::Unknown)
+        tilesX((std::max(_widthCells, 0) + kTileMask) >> kTileShift),
+        tilesY((std::max(_heightCells, 0) + kTileMask) >> kTileShift),
+        tileIndex(static_cast<std::size_t>(tilesX) * tilesY, kNoTile)
   {
   }
 };
@@ -102,7 +1069,7 @@ OccupancyCellState OccupancyGrid::CellState(int gridX, int gridY) const
 {
   if (this->IsValidGridCoordinate(gridX, gridY))
   {
-    return this->dataPtr->gridData[this->dataPtr->GetIndex(gridX, gridY)];
+    return Implementation::Decode(this->dataPtr->Code(gridX, gridY));
   }
   return OccupancyCellState::Unknown;
 }
@@ -112,7 +1079,7 @@ void OccupancyGrid::CellState(int gridX, int gridY, OccupancyCellState state)
 {
   if (this->IsValidGridCoordinate(gridX, gridY))
   {
-    this->dataPtr->gridData[this->dataPtr->GetIndex(gridX, gridY)] = state;
+    this->dataPtr->Code(gridX, gridY, Implementation::Encode(state));
   }
 }
 
@@ -120,6 +1087,29 @@ void OccupancyGrid::CellState(int gridX, int gridY, OccupancyCellState state)
 void OccupancyGrid::MarkLine(int x0, int y0, int x1, int y1,
                              OccupancyCellState state)
 {
+  if (this->dataPtr->logOdds)
+  {
+    Implementation::ForEachLineCell(x0, y0, x1, y1, [&](int _x, int _y)
+    {
+      if (!this->IsValidGridCoordinate(_x, _y))
+        return;
+      switch (state)
+      {
+        case OccupancyCellState::Occupied:
+          this->dataPtr->Observe(_x, _y, this->dataPtr->hitQ);
+          break;
+        case OccupancyCellState::Free:
+          this->dataPtr->Observe(_x, _y, this->dataPtr->missQ);
+          break;
+        case OccupancyCellState::Unknown:
+        default:
+          this->dataPtr->LogOddsValue(_x, _y, 0);
+          break;
+      }
+    });
+    return;
+  }
+
   bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
 
   if (steep)
@@ -237,7 +1227,10 @@ bool OccupancyGrid::MarkOccupied(double worldX, double worldY)
   int gridX, gridY;
   if (WorldToGrid(worldX, worldY, gridX, gridY))
   {
-    this->CellState(gridX, gridY, OccupancyCellState::Occupied);
+    if (this->dataPtr->logOdds)
+      this->dataPtr->Observe(gridX, gridY, this->dataPtr->hitQ);
+    else
+      this->CellState(gridX, gridY, OccupancyCellState::Occupied);
     return true;
   }
   return false;
@@ -258,83 +1251,529 @@ bool OccupancyGrid::MarkFree(double worldX0, double worldY0, double worldX1,
 }
 
 /////////////////////////////////////////////////
-void OccupancyGrid::ExportToRGBImage(std::vector<uint8_t> &_pixels) const
+bool OccupancyGrid::InsertScan(double _originX, double _originY,
+                               const std::vector<Vector2d> &_endpoints,
+                               unsigned int _threads)
 {
-  _pixels.assign(this->dataPtr->widthCells * this->dataPtr->heightCells * 3, 0);
+  int originX, originY;
+  if (!this->WorldToGrid(_originX, _originY, originX, originY))
+  {
+    return false;
+  }
 
-  for (int gridY = 0; gridY < this->dataPtr->heightCells; ++gridY)
+  // Endpoints in grid coordinates, and the bounding box of the scan.
+  std::vector<std::pair<int, int>> ends(_endpoints.size());
+  int minX = originX, maxX = originX, minY = originY, maxY = originY;
+  for (std::size_t i = 0; i < _endpoints.size(); ++i)
   {
-    for (int gridX = 0; gridX < this->dataPtr->widthCells; ++gridX)
+    this->WorldToGrid(_endpoints[i].X(), _endpoints[i].Y(),
+                      ends[i].first, ends[i].second);
+    minX = std::min(minX, ends[i].first);
+    maxX = std::max(maxX, ends[i].first);
+    minY = std::min(minY, ends[i].second);
+    maxY = std::max(maxY, ends[i].second);
+  }
+  minX = std::max(minX, 0);
+  minY = std::max(minY, 0);
+  maxX = std::min(maxX, this->dataPtr->widthCells - 1);
+  maxY = std::min(maxY, this->dataPtr->heightCells - 1);
+  this->dataPtr->MarkDirty(minX, minY, maxX, maxY);
+
+  // Trace the rays into bitmasks covering the bounding box. Setting a bit
+  // twice is harmless, which removes duplicated cells for free. The box
+  // starts on a tile boundary so that every 16 bits of the mask match one
+  // row of a tile.
+  minX &= ~Implementation::kTileMask;
+  const int boxWidth = maxX - minX + 1;
+  const int boxHeight = maxY - minY + 1;
+  const std::size_t wordsPerRow =
+    (static_cast<std::size_t>(boxWidth) + 63) / 64;
+  // Each ray walks many cells.
+  const unsigned int threads = detail::ThreadCount(_threads, ends.size(), 64);
+  std::vector<std::vector<uint64_t>> masks(threads);
+
+  detail::ParallelFor(ends.size(), threads,
+      [&](std::size_t _begin, std::size_t _end, unsigned int _t)
+      {
+        auto &mask = masks[_t];
+        mask.assign(wordsPerRow * boxHeight, 0u);
+        for (auto i = _begin; i < _end; ++i)
+        {
+          Implementation::ForEachLineCell(originX, originY,
+              ends[i].first, ends[i].second,
+              [&](int _x, int _y)
+              {
+                if (_x < minX || _x > maxX || _y < minY || _y > maxY)
+                  return;
+                const int bit = _x - minX;
+                mask[(_y - minY) * wordsPerRow + (bit >> 6)] |=
+                  uint64_t{1} << (bit & 63);
+              });
+        }
+      });
+
+  auto &freeMask = masks[0];
+  for (unsigned int t = 1; t < threads; ++t)
+  {
+    for (std::size_t w = 0; w < freeMask.size(); ++w)
+      freeMask[w] |= masks[t][w];
+  }
+
+  if (this->dataPtr->logOdds)
+  {
+    // Each cell receives at most one update per scan: the hit increment if
+    // it is an endpoint, the miss increment otherwise.
+    std::vector<uint64_t> hitMask(freeMask.size(), 0u);
+    for (const auto &end : ends)
+    {
+      if (!this->IsValidGridCoordinate(end.first, end.second))
+        continue;
+      const int bit = end.first - minX;
+      hitMask[(end.second - minY) * wordsPerRow + (bit >> 6)] |=
+        uint64_t{1} << (bit & 63);
+    }
+
+    Implementation::WithLogOddsTiles(*this->dataPtr, [&](auto &_tiles)
     {
-      uint8_t r = 0, g = 0, b = 0;
-      auto res = this->CellState(gridX, gridY);
-      switch (res)
+      for (int row = 0; row < boxHeight; ++row)
       {
-        case OccupancyCellState::Occupied:
-          r = 0;
-          g = 0;
-          b = 0;
-          break;
-        case OccupancyCellState::Free:
-          r = 255;
-          g = 255;
-          b = 255;
-          break;
-        case OccupancyCellState::Unknown:
-          r = 128;
-          g = 128;
-          b = 128;
-          break;
-        default:
-          // Should never reach here
-          r = 128;
-          g = 128;
-          b = 128;
-          break;
+        const int gridY = minY + row;
+        for (std::size_t w = 0; w < wordsPerRow; ++w)
+        {
+          const uint64_t hits = hitMask[row * wordsPerRow + w];
+          const uint64_t misses = freeMask[row * wordsPerRow + w] & ~hits;
+          for (int part = 0; part < 4; ++part)
+          {
+            const auto hitBits =
+              static_cast<uint32_t>(hits >> (part * 16)) & 0xFFFFu;
+            const auto missBits =
+              static_cast<uint32_t>(misses >> (part * 16)) & 0xFFFFu;
+            if ((hitBits | missBits) == 0u)
+              continue;
+            const int tileX = (minX >> Implementation::kTileShift) +
+              static_cast<int>(w * 4) + part;
+            this->dataPtr->UpdateLogOddsRow(
+                this->dataPtr->LogOddsTileRow(_tiles, tileX, gridY),
+                missBits, hitBits);
+          }
+        }
       }
+    });
+    return true;
+  }
 
-      int pixelIdx = (gridY * this->dataPtr->widthCells + gridX) * 3;
+  // Apply the free cells one tile row (16 cells) at a time.
+  static_assert(Implementation::kFreeCode == 1u &&
+                Implementation::kOccupiedCode == 2u,
+                "The bit tricks below depend on the cell codes");
+  constexpr uint32_t kLowBits = 0x55555555u;
+  for (int row = 0; row < boxHeight; ++row)
+  {
+    const int gridY = minY + row;
+    for (std::size_t w = 0; w < wordsPerRow; ++w)
+    {
+      const uint64_t word = freeMask[row * wordsPerRow + w];
+      for (int part = 0; part < 4; ++part)
+      {
+        uint32_t cells = static_cast<uint32_t>(word >> (part * 16)) & 0xFFFFu;
+        if (cells == 0u)
+          continue;
 
-      _pixels[pixelIdx + 0] = r;
-      _pixels[pixelIdx + 1] = g;
-      _pixels[pixelIdx + 2] = b;
+        // Spread the 16 cell bits into the low bit of each 2 bit code.
+        cells = (cells | (cells << 8)) & 0x00FF00FFu;
+        cells = (cells | (cells << 4)) & 0x0F0F0F0Fu;
+        cells = (cells | (cells << 2)) & 0x33333333u;
+        cells = (cells | (cells << 1)) & kLowBits;
+
+        const int tileX = (minX >> Implementation::kTileShift) +
+          static_cast<int>(w * 4) + part;
+        uint32_t &tileRow = this->dataPtr->TileRow(tileX, gridY);
+
+        // Occupied codes (0b10) are left untouched.
+        const uint32_t occupied = (tileRow >> 1) & ~tileRow & kLowBits;
+        const uint32_t update = (cells & ~occupied) * 3u;
+        tileRow = (tileRow & ~update) | (update & kLowBits);
+      }
     }
   }
+
+  for (const auto &end : ends)
+  {
+    if (this->IsValidGridCoordinate(end.first, end.second))
+    {
+      this->dataPtr->Code(end.first, end.second,
+                          Implementation::kOccupiedCode);
+    }
+  }
+  return true;
 }
 
 /////////////////////////////////////////////////
-void OccupancyGrid::RawOccupancy(std::vector<int8_t> &_data) const
+bool OccupancyGrid::EnableLogOdds(const OccupancyLogOddsParams &_params)
 {
-  _data.assign(this->dataPtr->widthCells * this->dataPtr->heightCells, 0);
+  if (!(_params.hit > 0.0 && _params.miss < 0.0 &&
+        _params.min < 0.0 && _params.max > 0.0 &&
+        _params.min <= _params.freeThreshold &&
+        _params.freeThreshold <= _params.occupiedThreshold &&
+        _params.occupiedThreshold <= _params.max))
+  {
+    detail::LogErrorMessage(
+        "OccupancyGrid::EnableLogOdds() error: inconsistent parameters. The "
+        "hit increment and the upper bound must be positive, the miss "
+        "increment and the lower bound must be negative and the thresholds "
+        "must be ordered between the bounds.");
+    return false;
+  }
+
+  auto &impl = *this->dataPtr;
+  const int limit =
+    (_params.precision == OccupancyLogOddsPrecision::Int8) ? 127 : 32767;
+  const double scale =
+    limit / std::max(std::abs(_params.min), std::abs(_params.max));
+  auto quantize = [&](double _value)
+  {
+    return static_cast<int>(std::lround(_value * scale));
+  };
 
-  for (int gridY = 0; gridY < this->dataPtr->heightCells; ++gridY)
+  const int minQ = std::max(quantize(_params.min), -limit);
+  const int maxQ = std::min(quantize(_params.max), limit);
+
+  // Log-odds of every cell of an allocated tile, before the change.
+  auto oldValue = [&](std::size_t _tile, int _cell) -> double
   {
-    for (int gridX = 0; gridX < this->dataPtr->widthCells; ++gridX)
+    if (impl.logOdds)
     {
-      int8_t val = -1;
-      auto res = this->CellState(gridX, gridY);
-      switch (res)
+      return Implementation::WithLogOddsTiles(impl, [&](const auto &_tiles)
       {
-        case OccupancyCellState::Occupied:
-          val = 100;
-          break;
-        case OccupancyCellState::Free:
-          val = 0;
-          break;
-        case OccupancyCellState::Unknown:
-          val = -1;
-          break;
-        default:
-          val = -1;
-          break;
+        return _tiles[_tile].cells[_cell] / impl.logOddsScale;
+      });
+    }
+    const int x = _cell & Implementation::kTileMask;
+    const int y = _cell >> Implementation::kTileShift;
+    const uint32_t code = (impl.tiles[_tile].rows[y] >> (x * 2)) & 3u;
+    if (code == Implementation::kOccupiedCode)
+      return _params.hit;
+    if (code == Implementation::kFreeCode)
+      return _params.miss;
+    return 0.0;
+  };
+  const std::size_t count = impl.logOdds ?
+    Implementation::WithLogOddsTiles(impl, [](const auto &_tiles)
+    {
+      return _tiles.size();
+    }) : impl.tiles.size();
+
+  // Convert the allocated tiles in place of the old ones, so tileIndex
+  // remains valid.
+  std::vector<Implementation::LogOddsTile<int8_t>> tiles8;
+  std::vector<Implementation::LogOddsTile<int16_t>> tiles16;
+  auto convert = [&](auto &_newTiles)
+  {
+    using T = typename std::remove_reference_t<
+      decltype(_newTiles[0].cells[0])>;
+    _newTiles.resize(count);
+    for (std::size_t t = 0; t < count; ++t)
+    {
+      for (int c = 0; c < Implementation::kTileSize *
+                          Implementation::kTileSize; ++c)
+      {
+        _newTiles[t].cells[c] = static_cast<T>(
+            std::clamp(quantize(oldValue(t, c)), minQ, maxQ));
       }
+    }
+  };
+  if (_params.precision == OccupancyLogOddsPrecision::Int8)
+    convert(tiles8);
+  else
+    convert(tiles16);
+
+  impl.logOddsTiles8 = std::move(tiles8);
+  impl.logOddsTiles16 = std::move(tiles16);
+  impl.tiles.clear();
+  impl.tiles.shrink_to_fit();
+
+  impl.logOdds = true;
+  impl.logOddsParams = _params;
+  impl.logOddsScale = scale;
+  impl.minQ = minQ;
+  impl.maxQ = maxQ;
+  impl.hitQ = std::max(quantize(_params.hit), 1);
+  impl.missQ = std::min(quantize(_params.miss), -1);
+  impl.occupiedQ = quantize(_params.occupiedThreshold);
+  impl.freeQ = quantize(_params.freeThreshold);
+
+  // The thresholds may have changed the state of any cell.
+  impl.MarkDirty(0, 0, impl.widthCells - 1, impl.heightCells - 1);
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool OccupancyGrid::LogOddsEnabled() const
+{
+  return this->dataPtr->logOdds;
+}
+
+/////////////////////////////////////////////////
+OccupancyLogOddsParams OccupancyGrid::LogOddsParams() const
+{
+  return this->dataPtr->logOddsParams;
+}
 
-      int pixelIdx = (gridY * this->dataPtr->widthCells + gridX);
-      _data[pixelIdx] = val;
+/////////////////////////////////////////////////
+double OccupancyGrid::LogOdds(int _gridX, int _gridY) const
+{
+  if (!this->dataPtr->logOdds || !this->IsValidGridCoordinate(_gridX, _gridY))
+    return 0.0;
+  return this->dataPtr->LogOddsValue(_gridX, _gridY) /
+    this->dataPtr->logOddsScale;
+}
+
+/////////////////////////////////////////////////
+void OccupancyGrid::Frontiers(std::vector<Vector2i> &_cells) const
+{
+  _cells.clear();
+  const int width = this->dataPtr->widthCells;
+  const int height = this->dataPtr->heightCells;
+  if (width <= 0 || height <= 0)
+    return;
+
+  // One bit per cell, so that the neighbors of 64 cells are tested at once.
+  const std::size_t words = (static_cast<std::size_t>(width) + 63) / 64;
+  std::vector<uint64_t> freeBits(words * height, 0u);
+  std::vector<uint64_t> unknownBits(words * height, 0u);
+  this->dataPtr->ForEachCell([&](int _x, int _y, uint32_t _code)
+  {
+    const std::size_t word = _y * words + (_x >> 6);
+    const uint64_t bit = uint64_t{1} << (_x & 63);
+    if (_code == Implementation::kFreeCode)
+      freeBits[word] |= bit;
+    else if (_code == Implementation::kUnknownCode)
+      unknownBits[word] |= bit;
+  });
+
+  for (int y = 0; y < height; ++y)
+  {
+    const uint64_t *unknown = unknownBits.data() + y * words;
+    for (std::size_t w = 0; w < words; ++w)
+    {
+      const uint64_t cells = freeBits[y * words + w];
+      if (cells == 0u)
+        continue;
+
+      // Bit x of each mask is set when the neighbor of cell x is unknown.
+      uint64_t neighbors = (unknown[w] << 1) | (unknown[w] >> 1);
+      if (w > 0)
+        neighbors |= unknown[w - 1] >> 63;
+      if (w + 1 < words)
+        neighbors |= unknown[w + 1] << 63;
+      if (y > 0)
+        neighbors |= unknown[w - words];
+      if (y + 1 < height)
+        neighbors |= unknown[w + words];
+
+      uint64_t frontier = cells & neighbors;
+      for (int bit = 0; frontier != 0u; ++bit, frontier >>= 1)
+      {
+        if (frontier & 1u)
+          _cells.emplace_back(static_cast<int>(w * 64) + bit, y);
+      }
     }
   }
 }
 
+/////////////////////////////////////////////////
+bool OccupancyGrid::EnableInformationGainMap(int _radiusCells,
+                                             unsigned int _threads)
+{
+  if (_radiusCells < 0)
+  {
+    detail::LogErrorMessage(
+        "OccupancyGrid::EnableInformationGainMap() error: the radius must "
+        "not be negative.");
+    return false;
+  }
+
+  auto &impl = *this->dataPtr;
+  impl.gainRadius = _radiusCells;
+  if (_radiusCells == 0)
+  {
+    impl.gainNodeEnds.clear();
+    impl.gainTargetStarts.clear();
+    impl.gainTargets.clear();
+    impl.gainCellNodeStarts.clear();
+    impl.gainCellNodes.clear();
+    impl.gains.clear();
+    impl.gainDirty.clear();
+    impl.gainAnyDirty = false;
+    return true;
+  }
+
+  impl.BuildGainTree(_radiusCells);
+  impl.gains.assign(static_cast<std::size_t>(std::max(impl.widthCells, 0)) *
+                    std::max(impl.heightCells, 0), 0);
+  impl.gainDirty.assign(impl.tileIndex.size(), 0u);
+  impl.MarkDirty(0, 0, impl.widthCells - 1, impl.heightCells - 1);
+  impl.UpdateGains(_threads);
+  return true;
+}
+
+/////////////////////////////////////////////////
+int OccupancyGrid::InformationGainRadius() const
+{
+  return this->dataPtr->gainRadius;
+}
+
+/////////////////////////////////////////////////
+void OccupancyGrid::UpdateInformationGainMap(unsigned int _threads)
+{
+  this->dataPtr->UpdateGains(_threads);
+}
+
+/////////////////////////////////////////////////
+int OccupancyGrid::InformationGain(int _gridX, int _gridY) const
+{
+  if (this->dataPtr->gainRadius == 0 ||
+      !this->IsValidGridCoordinate(_gridX, _gridY))
+  {
+    return 0;
+  }
+  return this->dataPtr->gains[
+    static_cast<std::size_t>(_gridY) * this->dataPtr->widthCells + _gridX];
+}
+
+/////////////////////////////////////////////////
+void OccupancyGrid::ComputeDistanceField(unsigned int _threads)
+{
+  this->dataPtr->ComputeDistances(_threads);
+}
+
+/////////////////////////////////////////////////
+void OccupancyGrid::UpdateDistanceField()
+{
+  if (this->dataPtr->distanceEnabled)
+    this->dataPtr->UpdateDistances();
+  else
+    this->dataPtr->ComputeDistances(1);
+}
+
+/////////////////////////////////////////////////
+void OccupancyGrid::DistanceField(std::vector<float> &_distances) const
+{
+  _distances = this->dataPtr->distances;
+}
+
+/////////////////////////////////////////////////
+double OccupancyGrid::Distance(int _gridX, int _gridY) const
+{
+  if (!this->dataPtr->distanceEnabled ||
+      !this->IsValidGridCoordinate(_gridX, _gridY))
+  {
+    return -1.0;
+  }
+  return this->dataPtr->distances[
+    static_cast<std::size_t>(_gridY) * this->dataPtr->widthCells + _gridX];
+}
+
+/////////////////////////////////////////////////
+bool OccupancyGrid::InflationCosts(double _inscribedRadius,
+                                   double _inflationRadius,
+                                   double _costScalingFactor,
+                                   std::vector<uint8_t> &_costs) const
+{
+  if (!this->dataPtr->distanceEnabled)
+  {
+    detail::LogErrorMessage(
+        "OccupancyGrid::InflationCosts() error: the distance field has not "
+        "been computed.");
+    return false;
+  }
+  if (_inscribedRadius < 0.0 || _inflationRadius < _inscribedRadius ||
+      _costScalingFactor < 0.0)
+  {
+    detail::LogErrorMessage(
+        "OccupancyGrid::InflationCosts() error: the radii must satisfy "
+        "0 <= inscribed <= inflation and the scaling factor must not be "
+        "negative.");
+    return false;
+  }
+
+  const auto &distances = this->dataPtr->distances;
+  _costs.resize(distances.size());
+  for (std::size_t i = 0; i < distances.size(); ++i)
+  {
+    const double distance = distances[i];
+    if (distance <= 0.0)
+      _costs[i] = kLethalCost;
+    else if (distance <= _inscribedRadius)
+      _costs[i] = kInscribedCost;
+    else if (distance <= _inflationRadius)
+    {
+      _costs[i] = static_cast<uint8_t>((kInscribedCost - 1) * std::exp(
+            -_costScalingFactor * (distance - _inscribedRadius)));
+    }
+    else
+      _costs[i] = 0u;
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+void OccupancyGrid::ExportToRGBImage(std::vector<uint8_t> &_pixels) const
+{
+  _pixels.assign(this->dataPtr->widthCells * this->dataPtr->heightCells * 3, 0);
+
+  this->dataPtr->ForEachCell([&](int gridX, int gridY, uint32_t code)
+  {
+    uint8_t value = 128;
+    switch (code)
+    {
+      case Implementation::kOccupiedCode:
+        value = 0;
+        break;
+      case Implementation::kFreeCode:
+        value = 255;
+        break;
+      case Implementation::kUnknownCode:
+      default:
+        value = 128;
+        break;
+    }
+
+    int pixelIdx = (gridY * this->dataPtr->widthCells + gridX) * 3;
+
+    _pixels[pixelIdx + 0] = value;
+    _pixels[pixelIdx + 1] = value;
+    _pixels[pixelIdx + 2] = value;
+  });
+}
+
+/////////////////////////////////////////////////
+void OccupancyGrid::RawOccupancy(std::vector<int8_t> &_data) const
+{
+  _data.assign(this->dataPtr->widthCells * this->dataPtr->heightCells, 0);
+
+  this->dataPtr->ForEachCell([&](int gridX, int gridY, uint32_t code)
+  {
+    int8_t val = -1;
+    switch (code)
+    {
+      case Implementation::kOccupiedCode:
+        val = 100;
+        break;
+      case Implementation::kFreeCode:
+        val = 0;
+        break;
+      case Implementation::kUnknownCode:
+      default:
+        val = -1;
+        break;
+    }
+
+    int pixelIdx = (gridY * this->dataPtr->widthCells + gridX);
+    _data[pixelIdx] = val;
+  });
+}
+
 /////////////////////////////////////////////////
 double OccupancyGrid::Resolution() const
 {
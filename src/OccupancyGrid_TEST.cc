@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <utility>
 #include <vector>
 
@@ -186,6 +189,332 @@ TEST(OccupancyGridTest, IGain)
   EXPECT_EQ(grid.CalculateIGain(0, 0, 15, 0), 2);
 }
 
+/////////////////////////////////////////////////
+TEST(OccupancyGridTest, Frontiers)
+{
+  // Wider than 64 cells to cross the words of the bit masks.
+  OccupancyGrid grid(1.0, 150, 40);
+  std::vector<Vector2i> frontiers;
+  grid.Frontiers(frontiers);
+  EXPECT_TRUE(frontiers.empty());
+
+  unsigned int seed = 7;
+  for (int i = 0; i < 3000; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    const int x = static_cast<int>((seed >> 8) % 150);
+    const int y = static_cast<int>((seed >> 20) % 40);
+    grid.CellState(x, y, (i % 5 == 0) ? OccupancyCellState::Occupied :
+                                        OccupancyCellState::Free);
+  }
+
+  std::vector<Vector2i> expected;
+  for (int y = 0; y < 40; ++y)
+  {
+    for (int x = 0; x < 150; ++x)
+    {
+      auto unknown = [&](int _x, int _y)
+      {
+        return grid.IsValidGridCoordinate(_x, _y) &&
+          grid.CellState(_x, _y) == OccupancyCellState::Unknown;
+      };
+      if (grid.CellState(x, y) == OccupancyCellState::Free &&
+          (unknown(x - 1, y) || unknown(x + 1, y) ||
+           unknown(x, y - 1) || unknown(x, y + 1)))
+      {
+        expected.emplace_back(x, y);
+      }
+    }
+  }
+  grid.Frontiers(frontiers);
+  EXPECT_FALSE(expected.empty());
+  EXPECT_EQ(expected, frontiers);
+}
+
+/////////////////////////////////////////////////
+TEST(OccupancyGridTest, InformationGainMap)
+{
+  OccupancyGrid grid(1.0, 10, 10);
+  EXPECT_EQ(0, grid.InformationGainRadius());
+  EXPECT_EQ(0, grid.InformationGain(5, 5));
+  EXPECT_FALSE(grid.EnableInformationGainMap(-1));
+
+  // On an unknown grid, every cell within the radius counts.
+  EXPECT_TRUE(grid.EnableInformationGainMap(2));
+  EXPECT_EQ(2, grid.InformationGainRadius());
+  EXPECT_EQ(13, grid.InformationGain(5, 5));
+  EXPECT_EQ(6, grid.InformationGain(0, 0));
+  EXPECT_EQ(0, grid.InformationGain(-1, 0));
+  EXPECT_EQ(0, grid.InformationGain(0, 10));
+
+  // Known cells are not counted.
+  grid.CellState(5, 5, OccupancyCellState::Free);
+  grid.CellState(6, 5, OccupancyCellState::Free);
+  // The map only reflects the changes once it is updated.
+  EXPECT_EQ(13, grid.InformationGain(5, 5));
+  grid.UpdateInformationGainMap();
+  EXPECT_EQ(11, grid.InformationGain(5, 5));
+
+  // An obstacle hides the cells behind it.
+  grid.CellState(4, 5, OccupancyCellState::Occupied);
+  grid.UpdateInformationGainMap();
+  EXPECT_EQ(9, grid.InformationGain(5, 5));
+
+  // An occupied viewpoint sees nothing.
+  EXPECT_EQ(0, grid.InformationGain(4, 5));
+
+  // Far away viewpoints are not affected.
+  EXPECT_EQ(6, grid.InformationGain(9, 0));
+
+  EXPECT_TRUE(grid.EnableInformationGainMap(0));
+  EXPECT_EQ(0, grid.InformationGainRadius());
+  EXPECT_EQ(0, grid.InformationGain(5, 5));
+}
+
+/////////////////////////////////////////////////
+TEST(OccupancyGridTest, InformationGainMapMatchesLines)
+{
+  const int width = 40;
+  const int height = 24;
+  const int radius = 7;
+  OccupancyGrid grid(1.0, width, height);
+  // Same obstacles, all other cells unknown.
+  OccupancyGrid obstacles(1.0, width, height);
+  // Cells are only known in the left half, so that the right half has
+  // viewpoints whose disk is free of obstacles.
+  unsigned int seed = 11;
+  for (int i = 0; i < 200; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    const int x = static_cast<int>((seed >> 8) % (width / 2));
+    const int y = static_cast<int>((seed >> 20) % height);
+    const bool occupied = (i % 4 == 0);
+    grid.CellState(x, y, occupied ? OccupancyCellState::Occupied :
+                                    OccupancyCellState::Free);
+    obstacles.CellState(x, y, occupied ? OccupancyCellState::Occupied :
+                                         OccupancyCellState::Unknown);
+  }
+  ASSERT_TRUE(grid.EnableInformationGainMap(radius));
+
+  // A cell is visible if the line of CalculateIGain reaches it, which is
+  // when no cell of the line is occupied in the obstacles grid, whichever
+  // end the line is traced from.
+  for (int y = 0; y < height; ++y)
+  {
+    for (int x = 0; x < width; ++x)
+    {
+      int expected = 0;
+      for (int ty = y - radius; ty <= y + radius; ++ty)
+      {
+        for (int tx = x - radius; tx <= x + radius; ++tx)
+        {
+          const int dx = tx - x;
+          const int dy = ty - y;
+          if (dx * dx + dy * dy > radius * radius ||
+              !grid.IsValidGridCoordinate(tx, ty) ||
+              grid.CellState(tx, ty) != OccupancyCellState::Unknown)
+          {
+            continue;
+          }
+          const int length = std::max(std::abs(dx), std::abs(dy)) + 1;
+          if (obstacles.CalculateIGain(x, y, tx, ty) == length)
+            ++expected;
+        }
+      }
+      EXPECT_EQ(expected, grid.InformationGain(x, y)) << x << " " << y;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(OccupancyGridTest, InformationGainMapIncremental)
+{
+  OccupancyGrid grid(0.1, 90, 70);
+  ASSERT_TRUE(grid.EnableInformationGainMap(12));
+
+  auto check = [&](OccupancyGrid &_grid)
+  {
+    // A map computed from scratch must match the incremental one.
+    OccupancyGrid reference = _grid;
+    ASSERT_TRUE(reference.EnableInformationGainMap(12, 3));
+    _grid.UpdateInformationGainMap(2);
+    for (int y = 0; y < 70; ++y)
+    {
+      for (int x = 0; x < 90; ++x)
+      {
+        ASSERT_EQ(reference.InformationGain(x, y),
+                  _grid.InformationGain(x, y)) << x << " " << y;
+      }
+    }
+  };
+
+  grid.MarkFree(1.0, 1.0, 3.0, 2.5);
+  grid.MarkOccupied(3.0, 2.5);
+  check(grid);
+
+  std::vector<Vector2d> endpoints;
+  for (int i = 0; i < 90; ++i)
+  {
+    const double angle = i * 4.0 * GZ_PI / 180.0;
+    endpoints.emplace_back(6.0 + 2.0 * std::cos(angle),
+                           3.5 + 1.5 * std::sin(angle));
+  }
+  EXPECT_TRUE(grid.InsertScan(6.0, 3.5, endpoints));
+  check(grid);
+
+  grid.CellState(80, 60, OccupancyCellState::Occupied);
+  grid.CellState(6, 4, OccupancyCellState::Unknown);
+  check(grid);
+
+  ASSERT_TRUE(grid.EnableLogOdds());
+  grid.MarkFree(0.5, 6.5, 8.5, 0.5);
+  EXPECT_TRUE(grid.InsertScan(2.0, 5.0, endpoints));
+  check(grid);
+}
+
+/////////////////////////////////////////////////
+TEST(OccupancyGridTest, DistanceField)
+{
+  OccupancyGrid grid(0.5, 70, 30);
+  std::vector<float> distances;
+  grid.DistanceField(distances);
+  EXPECT_TRUE(distances.empty());
+  EXPECT_DOUBLE_EQ(-1.0, grid.Distance(0, 0));
+  std::vector<uint8_t> costs;
+  EXPECT_FALSE(grid.InflationCosts(0.5, 2.0, 1.0, costs));
+
+  // Without obstacles every cell is infinitely far.
+  grid.ComputeDistanceField();
+  EXPECT_TRUE(std::isinf(grid.Distance(3, 3)));
+  EXPECT_DOUBLE_EQ(-1.0, grid.Distance(70, 3));
+
+  unsigned int seed = 3;
+  for (int i = 0; i < 40; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    grid.CellState(static_cast<int>((seed >> 8) % 70),
+                   static_cast<int>((seed >> 20) % 30),
+                   OccupancyCellState::Occupied);
+  }
+  grid.CellState(1, 1, OccupancyCellState::Free);
+
+  auto bruteForce = [](const OccupancyGrid &_grid, int _x, int _y)
+  {
+    double best = std::numeric_limits<double>::infinity();
+    for (int y = 0; y < _grid.Height(); ++y)
+    {
+      for (int x = 0; x < _grid.Width(); ++x)
+      {
+        if (_grid.CellState(x, y) == OccupancyCellState::Occupied)
+          best = std::min(best, std::hypot(x - _x, y - _y));
+      }
+    }
+    return best * _grid.Resolution();
+  };
+
+  for (unsigned int threads : {1u, 3u})
+  {
+    grid.ComputeDistanceField(threads);
+    grid.DistanceField(distances);
+    ASSERT_EQ(70u * 30u, distances.size());
+    for (int y = 0; y < 30; ++y)
+    {
+      for (int x = 0; x < 70; ++x)
+      {
+        const double expected = bruteForce(grid, x, y);
+        EXPECT_NEAR(expected, grid.Distance(x, y), 1e-5) << x << " " << y;
+        EXPECT_FLOAT_EQ(static_cast<float>(expected), distances[y * 70 + x]);
+      }
+    }
+  }
+
+  // Inflation
+  ASSERT_TRUE(grid.InflationCosts(0.5, 2.0, 1.0, costs));
+  ASSERT_EQ(distances.size(), costs.size());
+  EXPECT_FALSE(grid.InflationCosts(1.0, 0.5, 1.0, costs));
+  ASSERT_TRUE(grid.InflationCosts(0.5, 2.0, 1.0, costs));
+  for (std::size_t i = 0; i < costs.size(); ++i)
+  {
+    if (distances[i] <= 0.0f)
+      EXPECT_EQ(OccupancyGrid::kLethalCost, costs[i]);
+    else if (distances[i] <= 0.5f)
+      EXPECT_EQ(OccupancyGrid::kInscribedCost, costs[i]);
+    else if (distances[i] > 2.0f)
+      EXPECT_EQ(0, costs[i]);
+    else
+    {
+      EXPECT_LT(costs[i], OccupancyGrid::kInscribedCost);
+      EXPECT_GT(costs[i], 0);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(OccupancyGridTest, DistanceFieldIncremental)
+{
+  OccupancyGrid grid(0.1, 90, 60);
+
+  // Computes the field on first use.
+  grid.UpdateDistanceField();
+  EXPECT_TRUE(std::isinf(grid.Distance(0, 0)));
+
+  auto check = [](OccupancyGrid &_grid)
+  {
+    _grid.UpdateDistanceField();
+    OccupancyGrid reference = _grid;
+    reference.ComputeDistanceField();
+    std::vector<float> expected, actual;
+    reference.DistanceField(expected);
+    _grid.DistanceField(actual);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+      if (std::isinf(expected[i]))
+        EXPECT_TRUE(std::isinf(actual[i])) << i;
+      else
+        EXPECT_NEAR(expected[i], actual[i], 1e-5) << i;
+    }
+  };
+
+  // Adding obstacles
+  grid.CellState(45, 30, OccupancyCellState::Occupied);
+  check(grid);
+  std::vector<Vector2d> endpoints;
+  for (int i = 0; i < 60; ++i)
+  {
+    const double angle = i * 6.0 * GZ_PI / 180.0;
+    endpoints.emplace_back(4.5 + 2.0 * std::cos(angle),
+                           3.0 + 1.5 * std::sin(angle));
+  }
+  EXPECT_TRUE(grid.InsertScan(4.5, 3.0, endpoints));
+  check(grid);
+
+  // Removing and moving obstacles
+  unsigned int seed = 11;
+  for (int round = 0; round < 5; ++round)
+  {
+    for (int i = 0; i < 15; ++i)
+    {
+      seed = seed * 1103515245u + 12345u;
+      const int x = static_cast<int>((seed >> 8) % 90);
+      const int y = static_cast<int>((seed >> 20) % 60);
+      grid.CellState(x, y, (i % 3 == 0) ? OccupancyCellState::Occupied :
+                                          OccupancyCellState::Free);
+    }
+    for (int i = 0; i < 10; ++i)
+      grid.CellState(6 + round * 3, 1 + i, OccupancyCellState::Unknown);
+    check(grid);
+  }
+
+  // Clearing every obstacle
+  for (int y = 0; y < 60; ++y)
+  {
+    for (int x = 0; x < 90; ++x)
+      grid.CellState(x, y, OccupancyCellState::Free);
+  }
+  check(grid);
+}
+
 /////////////////////////////////////////////////
 TEST(OccupancyGridTest, ExportToRGBImage)
 {
@@ -298,3 +627,292 @@ TEST(OccupancyGridTest, MarkLineOverOccupied)
   EXPECT_EQ(grid.CellState(6, 6), OccupancyCellState::Unknown);
   EXPECT_EQ(grid.CellState(7, 7), OccupancyCellState::Unknown);
 }
+
+/////////////////////////////////////////////////
+TEST(OccupancyGridTest, PackedStorage)
+{
+  // Dimensions that are not a multiple of the internal tile size.
+  const int width = 37;
+  const int height = 21;
+  OccupancyGrid grid(0.1, width, height);
+
+  auto expected = [](int _x, int _y)
+  {
+    switch ((_x * 7 + _y * 3) % 3)
+    {
+      case 0:
+        return OccupancyCellState::Free;
+      case 1:
+        return OccupancyCellState::Occupied;
+      default:
+        return OccupancyCellState::Unknown;
+    }
+  };
+
+  for (int y = 0; y < height; ++y)
+  {
+    for (int x = 0; x < width; ++x)
+      grid.CellState(x, y, expected(x, y));
+  }
+
+  OccupancyGrid copy = grid;
+  std::vector<int8_t> raw;
+  copy.RawOccupancy(raw);
+  ASSERT_EQ(raw.size(), static_cast<size_t>(width * height));
+  for (int y = 0; y < height; ++y)
+  {
+    for (int x = 0; x < width; ++x)
+    {
+      EXPECT_EQ(grid.CellState(x, y), expected(x, y));
+      EXPECT_EQ(copy.CellState(x, y), expected(x, y));
+      const int8_t value = raw[y * width + x];
+      switch (expected(x, y))
+      {
+        case OccupancyCellState::Free:
+          EXPECT_EQ(0, value);
+          break;
+        case OccupancyCellState::Occupied:
+          EXPECT_EQ(100, value);
+          break;
+        default:
+          EXPECT_EQ(-1, value);
+          break;
+      }
+    }
+  }
+
+  // Overwriting a cell does not affect its neighbors.
+  copy.CellState(16, 16, OccupancyCellState::Unknown);
+  EXPECT_EQ(copy.CellState(16, 16), OccupancyCellState::Unknown);
+  EXPECT_EQ(copy.CellState(15, 16), expected(15, 16));
+  EXPECT_EQ(copy.CellState(17, 16), expected(17, 16));
+  EXPECT_EQ(grid.CellState(16, 16), expected(16, 16));
+}
+
+/////////////////////////////////////////////////
+TEST(OccupancyGridTest, LargeSparseGrid)
+{
+  // Unknown areas are not allocated, so a large mostly unexplored map is
+  // cheap to create and to update locally.
+  const int size = 10000;
+  OccupancyGrid grid(0.05, size, size);
+  EXPECT_EQ(grid.CellState(size - 1, size - 1), OccupancyCellState::Unknown);
+
+  EXPECT_TRUE(grid.MarkFree(1.0, 1.0, 5.0, 1.0));
+  EXPECT_TRUE(grid.MarkOccupied(5.05, 1.0));
+  EXPECT_EQ(grid.CellState(20, 20), OccupancyCellState::Free);
+  EXPECT_EQ(grid.CellState(100, 20), OccupancyCellState::Free);
+  EXPECT_EQ(grid.CellState(101, 20), OccupancyCellState::Occupied);
+  EXPECT_EQ(grid.CellState(102, 20), OccupancyCellState::Unknown);
+  EXPECT_EQ(grid.CellState(100, 21), OccupancyCellState::Unknown);
+
+  grid.CellState(size - 1, size - 1, OccupancyCellState::Occupied);
+  EXPECT_EQ(grid.CellState(size - 1, size - 1),
+            OccupancyCellState::Occupied);
+  EXPECT_EQ(grid.CellState(size - 2, size - 1),
+            OccupancyCellState::Unknown);
+}
+
+/////////////////////////////////////////////////
+TEST(OccupancyGridTest, InsertScan)
+{
+  const double resolution = 0.1;
+  OccupancyGrid perCall(resolution, 60, 50, -3.0, -2.5);
+  OccupancyGrid batch = perCall;
+  OccupancyGrid parallel = perCall;
+
+  // Pre-existing obstacles are not cleared by the scan.
+  perCall.CellState(40, 25, OccupancyCellState::Occupied);
+  batch.CellState(40, 25, OccupancyCellState::Occupied);
+  parallel.CellState(40, 25, OccupancyCellState::Occupied);
+
+  // A 360 degree scan with some rays ending outside the grid.
+  const double originX = 0.05;
+  const double originY = 0.05;
+  std::vector<Vector2d> endpoints;
+  for (int i = 0; i < 720; ++i)
+  {
+    const double angle = 2.0 * GZ_PI * i / 720.0;
+    const double range = (i % 5 == 0) ? 4.0 : 1.0 + 0.5 * std::sin(angle * 3);
+    endpoints.emplace_back(originX + range * std::cos(angle),
+                           originY + range * std::sin(angle));
+  }
+
+  EXPECT_TRUE(batch.InsertScan(originX, originY, endpoints));
+  EXPECT_TRUE(parallel.InsertScan(originX, originY, endpoints, 4));
+
+  // Reference: free rays first, then the endpoints.
+  for (const auto &end : endpoints)
+    perCall.MarkFree(originX, originY, end.X(), end.Y());
+  for (const auto &end : endpoints)
+    perCall.MarkOccupied(end.X(), end.Y());
+
+  int differences = 0;
+  for (int y = 0; y < batch.Height(); ++y)
+  {
+    for (int x = 0; x < batch.Width(); ++x)
+    {
+      EXPECT_EQ(batch.CellState(x, y), parallel.CellState(x, y));
+      if (batch.CellState(x, y) != perCall.CellState(x, y))
+        ++differences;
+    }
+  }
+  EXPECT_EQ(OccupancyCellState::Occupied, batch.CellState(40, 25));
+
+  // Only the few cells shadowed by the pre-existing obstacle may differ.
+  EXPECT_LT(differences, 5);
+
+  int gridX, gridY;
+  ASSERT_TRUE(batch.WorldToGrid(originX, originY, gridX, gridY));
+  EXPECT_EQ(OccupancyCellState::Free, batch.CellState(gridX, gridY));
+  ASSERT_TRUE(batch.WorldToGrid(endpoints[1].X(), endpoints[1].Y(),
+                                gridX, gridY));
+  EXPECT_EQ(OccupancyCellState::Occupied, batch.CellState(gridX, gridY));
+
+  // The origin must be inside the grid.
+  EXPECT_FALSE(batch.InsertScan(10.0, 10.0, endpoints));
+
+  // An empty scan does not change the grid.
+  OccupancyGrid empty(resolution, 10, 10);
+  EXPECT_TRUE(empty.InsertScan(0.5, 0.5, {}));
+  EXPECT_EQ(OccupancyCellState::Unknown, empty.CellState(5, 5));
+}
+
+/////////////////////////////////////////////////
+TEST(OccupancyGridTest, LogOddsParams)
+{
+  OccupancyGrid grid(0.1, 10, 10);
+  EXPECT_FALSE(grid.LogOddsEnabled());
+  EXPECT_DOUBLE_EQ(0.0, grid.LogOdds(1, 1));
+
+  OccupancyLogOddsParams params;
+  params.hit = -1.0;
+  EXPECT_FALSE(grid.EnableLogOdds(params));
+  params = OccupancyLogOddsParams();
+  params.occupiedThreshold = params.freeThreshold - 0.1;
+  EXPECT_FALSE(grid.EnableLogOdds(params));
+  EXPECT_FALSE(grid.LogOddsEnabled());
+
+  // Known cells become one observation.
+  grid.CellState(1, 1, OccupancyCellState::Occupied);
+  grid.CellState(2, 2, OccupancyCellState::Free);
+  EXPECT_TRUE(grid.EnableLogOdds());
+  EXPECT_TRUE(grid.LogOddsEnabled());
+  EXPECT_NEAR(0.85, grid.LogOdds(1, 1), 1e-3);
+  EXPECT_NEAR(-0.4, grid.LogOdds(2, 2), 1e-3);
+  EXPECT_DOUBLE_EQ(0.0, grid.LogOdds(3, 3));
+  EXPECT_DOUBLE_EQ(0.0, grid.LogOdds(-1, 3));
+  EXPECT_EQ(OccupancyCellState::Occupied, grid.CellState(1, 1));
+  EXPECT_EQ(OccupancyCellState::Free, grid.CellState(2, 2));
+  EXPECT_EQ(OccupancyCellState::Unknown, grid.CellState(3, 3));
+
+  // Setting a state forces the clamping bounds.
+  grid.CellState(3, 3, OccupancyCellState::Occupied);
+  EXPECT_NEAR(3.5, grid.LogOdds(3, 3), 1e-3);
+  grid.CellState(3, 3, OccupancyCellState::Free);
+  EXPECT_NEAR(-2.0, grid.LogOdds(3, 3), 1e-3);
+  grid.CellState(3, 3, OccupancyCellState::Unknown);
+  EXPECT_DOUBLE_EQ(0.0, grid.LogOdds(3, 3));
+
+  // Changing the precision keeps the values up to quantization.
+  params = OccupancyLogOddsParams();
+  params.precision = OccupancyLogOddsPrecision::Int8;
+  EXPECT_TRUE(grid.EnableLogOdds(params));
+  EXPECT_EQ(OccupancyLogOddsPrecision::Int8, grid.LogOddsParams().precision);
+  EXPECT_NEAR(0.85, grid.LogOdds(1, 1), 0.02);
+  EXPECT_NEAR(-0.4, grid.LogOdds(2, 2), 0.02);
+}
+
+/////////////////////////////////////////////////
+TEST(OccupancyGridTest, LogOddsUpdates)
+{
+  for (auto precision : {OccupancyLogOddsPrecision::Int8,
+                         OccupancyLogOddsPrecision::Int16})
+  {
+    OccupancyGrid grid(1.0, 20, 20);
+    OccupancyLogOddsParams params;
+    params.precision = precision;
+    ASSERT_TRUE(grid.EnableLogOdds(params));
+
+    // Repeated hits saturate at the upper bound.
+    for (int i = 0; i < 10; ++i)
+      EXPECT_TRUE(grid.MarkOccupied(5.0, 5.0));
+    EXPECT_NEAR(params.max, grid.LogOdds(5, 5), 0.03);
+    EXPECT_EQ(OccupancyCellState::Occupied, grid.CellState(5, 5));
+
+    // Unlike the tri-state mode, rays through an occupied cell lower its
+    // log-odds, so an obstacle that moved away is eventually cleared.
+    for (int i = 0; i < 20; ++i)
+      EXPECT_TRUE(grid.MarkFree(0.0, 5.0, 10.0, 5.0));
+    EXPECT_NEAR(params.min, grid.LogOdds(5, 5), 0.03);
+    EXPECT_EQ(OccupancyCellState::Free, grid.CellState(5, 5));
+
+    // One miss after one hit leaves the cell uncertain.
+    grid.MarkOccupied(8.0, 8.0);
+    grid.MarkLine(8, 8, 8, 8, OccupancyCellState::Free);
+    EXPECT_EQ(OccupancyCellState::Unknown, grid.CellState(8, 8));
+    grid.MarkLine(8, 8, 8, 8, OccupancyCellState::Unknown);
+    EXPECT_DOUBLE_EQ(0.0, grid.LogOdds(8, 8));
+
+    // Thresholded export.
+    std::vector<int8_t> raw;
+    grid.RawOccupancy(raw);
+    ASSERT_EQ(400u, raw.size());
+    EXPECT_EQ(0, raw[5 * 20 + 5]);
+    EXPECT_EQ(-1, raw[15 * 20 + 15]);
+    grid.MarkOccupied(15.0, 15.0);
+    grid.RawOccupancy(raw);
+    EXPECT_EQ(100, raw[15 * 20 + 15]);
+
+    std::vector<uint8_t> pixels;
+    grid.ExportToRGBImage(pixels);
+    ASSERT_EQ(1200u, pixels.size());
+    EXPECT_EQ(255, pixels[(5 * 20 + 5) * 3]);
+    EXPECT_EQ(0, pixels[(15 * 20 + 15) * 3]);
+    EXPECT_EQ(128, pixels[(18 * 20 + 1) * 3]);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(OccupancyGridTest, LogOddsInsertScan)
+{
+  OccupancyGrid grid(0.1, 40, 40);
+  ASSERT_TRUE(grid.EnableLogOdds());
+  OccupancyGrid perCall = grid;
+
+  // Several rays towards the same wall, some sharing cells.
+  std::vector<Vector2d> endpoints;
+  for (int i = 0; i < 20; ++i)
+    endpoints.emplace_back(3.0, 0.5 + 0.1 * i);
+  endpoints.push_back(endpoints.front());
+
+  EXPECT_TRUE(grid.InsertScan(0.5, 1.5, endpoints));
+  EXPECT_FALSE(grid.InsertScan(-10.0, 1.5, endpoints));
+
+  const OccupancyLogOddsParams params = grid.LogOddsParams();
+  int gridX, gridY;
+  for (const auto &end : endpoints)
+  {
+    ASSERT_TRUE(grid.WorldToGrid(end.X(), end.Y(), gridX, gridY));
+    // One hit per scan, even for duplicated endpoints.
+    EXPECT_NEAR(params.hit, grid.LogOdds(gridX, gridY), 1e-3);
+  }
+
+  // Cells shared by many rays only receive one miss.
+  ASSERT_TRUE(grid.WorldToGrid(0.5, 1.5, gridX, gridY));
+  EXPECT_NEAR(params.miss, grid.LogOdds(gridX, gridY), 1e-3);
+  EXPECT_EQ(OccupancyCellState::Free, grid.CellState(gridX, gridY));
+
+  // Multi-threaded insertion gives the same result.
+  OccupancyGrid parallel = perCall;
+  std::vector<Vector2d> many;
+  for (int i = 0; i < 400; ++i)
+    many.emplace_back(3.0, 0.5 + 0.005 * i);
+  EXPECT_TRUE(parallel.InsertScan(0.5, 1.5, many, 4));
+  EXPECT_TRUE(perCall.InsertScan(0.5, 1.5, many, 1));
+  for (int y = 0; y < 40; ++y)
+  {
+    for (int x = 0; x < 40; ++x)
+      EXPECT_DOUBLE_EQ(perCall.LogOdds(x, y), parallel.LogOdds(x, y));
+  }
+}
@@ -18,10 +18,13 @@
 
 #include <cmath>
 #include <functional>
+#include <limits>
+#include <vector>
 
 #include "gz/math/AdditivelySeparableScalarField3.hh"
 #include "gz/math/PiecewiseScalarField3.hh"
 #include "gz/math/Polynomial3.hh"
+#include "gz/math/Rand.hh"
 #include "gz/math/Vector3.hh"
 
 using namespace gz;
@@ -183,3 +186,103 @@ TEST(PiecewiseScalarField3Test, Stream)
     EXPECT_EQ(output.str(), expected.str());
   }
 }
+
+/////////////////////////////////////////////////
+TEST(PiecewiseScalarField3Test, ManyPieces)
+{
+  using ScalarField3dT = std::function<double(const math::Vector3d&)>;
+  using PiecewiseScalarField3dT = math::PiecewiseScalarField3d<ScalarField3dT>;
+
+  // A 20 x 20 x 5 tiling of unit cells with half open regions, so that
+  // every point belongs to exactly one of them.
+  std::vector<PiecewiseScalarField3dT::Piece> tiles;
+  for (int z = 0; z < 5; ++z)
+  {
+    for (int y = 0; y < 20; ++y)
+    {
+      for (int x = 0; x < 20; ++x)
+      {
+        const double value = x + 100. * y + 10000. * z;
+        tiles.push_back({
+          math::Region3d(
+            math::Intervald::LeftClosed(x, x + 1.),
+            math::Intervald::LeftClosed(y, y + 1.),
+            math::Intervald::LeftClosed(z, z + 1.)),
+          [value](const math::Vector3d&) { return value; }});
+      }
+    }
+  }
+  // Overlapping pieces follow the precedence of their order, whatever
+  // their size.
+  std::vector<PiecewiseScalarField3dT::Piece> overlapping = tiles;
+  overlapping.insert(overlapping.begin() + 10, {
+    math::Region3d::Closed(2.5, 2.5, 0.5, 7.5, 7.5, 1.5),
+    [](const math::Vector3d&) { return -1.; }});
+  overlapping.push_back({
+    math::Region3d(
+      math::Intervald::Unbounded, math::Intervald::Unbounded,
+      math::Intervald::Open(-1., 0.)),
+    [](const math::Vector3d&) { return -2.; }});
+  overlapping.push_back({
+    math::Region3d::Open(1., 1., 1., 0., 0., 0.),
+    [](const math::Vector3d&) { return -3.; }});
+
+  math::Rand::Seed(7);
+  std::vector<math::Vector3d> points;
+  for (int i = 0; i < 5000; ++i)
+  {
+    // Random points, and runs of nearby points.
+    if (i % 10 == 0)
+    {
+      points.push_back(math::Vector3d(math::Rand::DblUniform(-1, 21),
+        math::Rand::DblUniform(-1, 21), math::Rand::DblUniform(-1.5, 5.5)));
+    }
+    else
+    {
+      points.push_back(points.back() + math::Vector3d(0.1, 0.05, 0.01));
+    }
+  }
+  // Points on the boundaries of the regions.
+  for (int i = 0; i < 200; ++i)
+  {
+    points.push_back(math::Vector3d(i % 21, (i / 3) % 21, i % 6));
+  }
+  points.push_back(math::Vector3d::NaN);
+
+  for (const auto &pieces : {tiles, overlapping})
+  {
+    const PiecewiseScalarField3dT scalarField(pieces);
+    std::vector<double> values;
+    scalarField.Evaluate(points, values);
+    ASSERT_EQ(points.size(), values.size());
+    std::vector<double> threadedValues;
+    scalarField.Evaluate(points, threadedValues, 3);
+    ASSERT_EQ(points.size(), threadedValues.size());
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+      const auto &p = points[i];
+      double expected = std::numeric_limits<double>::quiet_NaN();
+      for (const auto &piece : pieces)
+      {
+        if (piece.region.Contains(p))
+        {
+          expected = piece.field(p);
+          break;
+        }
+      }
+      if (std::isnan(expected))
+      {
+        EXPECT_TRUE(std::isnan(scalarField(p))) << p;
+        EXPECT_TRUE(std::isnan(values[i])) << p;
+        EXPECT_TRUE(std::isnan(threadedValues[i])) << p;
+      }
+      else
+      {
+        EXPECT_DOUBLE_EQ(expected, scalarField(p)) << p;
+        EXPECT_DOUBLE_EQ(expected, values[i]) << p;
+        EXPECT_DOUBLE_EQ(expected, threadedValues[i]) << p;
+      }
+    }
+  }
+}
@@ -15,7 +15,9 @@
  *
 */
 #include <gtest/gtest.h>
+#include <cmath>
 #include <ostream>
+#include <vector>
 
 #include "gz/math/Polynomial3.hh"
 
@@ -64,6 +66,64 @@ TEST(Polynomial3Test, Evaluate)
   }
 }
 
+/////////////////////////////////////////////////
+TEST(Polynomial3Test, BatchEvaluate)
+{
+  // Not a multiple of the block size, with non-finite arguments both
+  // inside blocks and in the remainder.
+  std::vector<double> x;
+  for (int i = 0; i < 37; ++i)
+    x.push_back(-3. + 0.17 * i);
+  x[3] = math::INF_D;
+  x[12] = -math::INF_D;
+  x[20] = math::NAN_D;
+  x[35] = math::INF_D;
+
+  for (const math::Vector4d &coeffs : {
+         math::Vector4d(1., -2., 0.5, 3.),
+         math::Vector4d(0., 2., -1., 1.),
+         math::Vector4d(0., 0., -1., 1.),
+         math::Vector4d(0., 0., 0., 2.)})
+  {
+    const math::Polynomial3d poly(coeffs);
+    std::vector<double> y;
+    poly.Evaluate(x, y);
+    ASSERT_EQ(x.size(), y.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+      const double expected = poly.Evaluate(x[i]);
+      if (std::isnan(expected))
+      {
+        EXPECT_TRUE(std::isnan(y[i])) << i;
+      }
+      else
+      {
+        EXPECT_EQ(expected, y[i]) << i;
+      }
+    }
+
+    // In place
+    std::vector<double> z = x;
+    poly.Evaluate(z.data(), z.data(), z.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+      if (std::isnan(y[i]))
+      {
+        EXPECT_TRUE(std::isnan(z[i])) << i;
+      }
+      else
+      {
+        EXPECT_EQ(y[i], z[i]) << i;
+      }
+    }
+  }
+
+  const math::Polynomial3d poly(math::Vector4d::One);
+  std::vector<double> y(3, 1.);
+  poly.Evaluate(std::vector<double>(), y);
+  EXPECT_TRUE(y.empty());
+}
+
 /////////////////////////////////////////////////
 TEST(Polynomial3Test, Minimum)
 {
@@ -25,24 +25,318 @@
   #include <unistd.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <mutex>
 
 #include "gz/math/Rand.hh"
+#include "gz/math/detail/ParallelFor.hh"
+#include "gz/math/detail/Philox.hh"
 
 using namespace gz;
 using namespace math;
 
+namespace
+{
+/// \brief Mutex guarding the generator shared by the static functions.
+std::mutex &RandMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+/// \brief Incremented whenever the seed is set, so that thread streams
+/// know when to reseed.
+std::atomic<uint64_t> g_seedGeneration{0};
+
+/// \brief Index of the next thread stream.
+std::atomic<uint64_t> g_nextThreadStream{0};
+
+/// \brief Number of Philox counters generated together.
+constexpr std::size_t kPhiloxBatch = 16;
+
+/// \brief 2^-53, to scale 53 random bits to [0, 1).
+constexpr double kDoubleScale = 1.0 / 9007199254740992.0;
+
+/// \brief 2^-24, to scale 24 random bits to [0, 1).
+constexpr float kFloatScale = 1.0f / 16777216.0f;
+
+/// \brief Random lanes of a batch of Philox counters.
+using PhiloxLanes = uint32_t[4][kPhiloxBatch];
+
+/// \brief Get 53 random bits from two words.
+/// \param[in] _high First word.
+/// \param[in] _low Second word.
+/// \return Random integer in [0, 2^53).
+inline uint64_t Bits53(uint32_t _high, uint32_t _low)
+{
+  return ((static_cast<uint64_t>(_high) << 32) | _low) >> 11;
+}
+
+/// \brief Fill a buffer from consecutive Philox counters.
+/// \param[in] _key Key of the generator.
+/// \param[in] _stream Stream index, stored in the upper counter words.
+/// \param[in] _firstBlock First counter.
+/// \param[out] _values Buffer to fill.
+/// \param[in] _count Number of values.
+/// \param[in] _threads Number of threads to use, 0 for one per core.
+/// \param[in] _transform Function that turns a batch of random lanes into
+/// PerBlock values per counter, void(const PhiloxLanes &, T *).
+/// \return Number of counters used.
+template<typename T, std::size_t PerBlock, typename Transform>
+uint64_t FillBlocks(const detail::PhiloxKey &_key, uint64_t _stream,
+                    uint64_t _firstBlock, T *_values, std::size_t _count,
+                    unsigned int _threads, Transform _transform)
+{
+  const std::size_t blocks = (_count + PerBlock - 1) / PerBlock;
+  if (blocks == 0)
+    return 0;
+
+  // A block is a single Philox round of a few values.
+  const unsigned int threads = detail::ThreadCount(_threads, blocks, 4096);
+  detail::ParallelFor(blocks, threads,
+    [&](std::size_t _begin, std::size_t _end, unsigned int)
+    {
+      PhiloxLanes lanes;
+      T batch[kPhiloxBatch * PerBlock];
+      for (std::size_t b = _begin; b < _end; b += kPhiloxBatch)
+      {
+        for (std::size_t j = 0; j < kPhiloxBatch; ++j)
+        {
+          const uint64_t counter = _firstBlock + b + j;
+          lanes[0][j] = static_cast<uint32_t>(counter);
+          lanes[1][j] = static_cast<uint32_t>(counter >> 32);
+          lanes[2][j] = static_cast<uint32_t>(_stream);
+          lanes[3][j] = static_cast<uint32_t>(_stream >> 32);
+        }
+        detail::Philox4x32(lanes, _key);
+        _transform(lanes, batch);
+
+        const std::size_t first = b * PerBlock;
+        const std::size_t last = std::min(
+            _count, std::min(_end, b + kPhiloxBatch) * PerBlock);
+        std::copy(batch, batch + (last - first), _values + first);
+      }
+    });
+  return blocks;
+}
+}  // namespace
+
+/// \brief Private data for the RandStream class.
+class gz::math::RandStream::Implementation
+{
+  /// \brief Seed shared by all streams.
+  public: unsigned int seed = 0;
+
+  /// \brief Stream index.
+  public: uint64_t stream = 0;
+
+  /// \brief Random generator.
+  public: GeneratorType generator;
+
+  /// \brief Uniform distribution, reused between calls.
+  public: UniformRealDist uniform;
+
+  /// \brief Normal distribution, reused between calls so that both
+  /// values of each Box-Muller pair are used.
+  public: NormalRealDist normal;
+
+  /// \brief Next Philox counter for bulk fills.
+  public: uint64_t bulkBlock = 0;
+
+  /// \brief Fill a buffer from the bulk sequence of the stream.
+  /// \sa FillBlocks
+  public: template<typename T, std::size_t PerBlock, typename Transform>
+  void Fill(T *_values, std::size_t _count, unsigned int _threads,
+            Transform _transform)
+  {
+    this->bulkBlock += FillBlocks<T, PerBlock>({this->seed, 0},
+        this->stream, this->bulkBlock, _values, _count, _threads,
+        _transform);
+  }
+};
+
+//////////////////////////////////////////////////
+RandStream::RandStream(uint64_t _stream)
+  : RandStream(Rand::Seed(), _stream)
+{
+}
+
+//////////////////////////////////////////////////
+RandStream::RandStream(unsigned int _seed, uint64_t _stream)
+  : dataPtr(gz::utils::MakeImpl<Implementation>())
+{
+  this->Seed(_seed, _stream);
+}
+
+//////////////////////////////////////////////////
+void RandStream::Seed(unsigned int _seed, uint64_t _stream)
+{
+  // The seed sequence mixes the stream index into the whole generator
+  // state, so that streams do not start from correlated states.
+  std::seed_seq seq{static_cast<uint32_t>(_seed),
+                    static_cast<uint32_t>(_stream & 0xFFFFFFFFu),
+                    static_cast<uint32_t>(_stream >> 32)};
+  this->dataPtr->seed = _seed;
+  this->dataPtr->stream = _stream;
+  this->dataPtr->generator.seed(seq);
+  this->dataPtr->uniform.reset();
+  this->dataPtr->normal.reset();
+  this->dataPtr->bulkBlock = 0;
+}
+
+//////////////////////////////////////////////////
+unsigned int RandStream::Seed() const
+{
+  return this->dataPtr->seed;
+}
+
+//////////////////////////////////////////////////
+uint64_t RandStream::Stream() const
+{
+  return this->dataPtr->stream;
+}
+
+//////////////////////////////////////////////////
+double RandStream::DblUniform(double _min, double _max)
+{
+  return this->dataPtr->uniform(this->dataPtr->generator,
+      UniformRealDist::param_type(_min, _max));
+}
+
+//////////////////////////////////////////////////
+double RandStream::DblNormal(double _mean, double _sigma)
+{
+  if (equal(_sigma, 0.0, std::numeric_limits<double>::epsilon()))
+    return _mean;
+
+  return this->dataPtr->normal(this->dataPtr->generator,
+      NormalRealDist::param_type(_mean, _sigma));
+}
+
+//////////////////////////////////////////////////
+int32_t RandStream::IntUniform(int _min, int _max)
+{
+  UniformIntDist d(_min, _max);
+  return d(this->dataPtr->generator);
+}
+
+//////////////////////////////////////////////////
+int32_t RandStream::IntNormal(int _mean, int _sigma)
+{
+  if (_sigma == 0)
+    return _mean;
+
+  return static_cast<int32_t>(this->dataPtr->normal(
+      this->dataPtr->generator, NormalRealDist::param_type(_mean, _sigma)));
+}
+
+//////////////////////////////////////////////////
+GeneratorType &RandStream::Generator()
+{
+  return this->dataPtr->generator;
+}
+
+//////////////////////////////////////////////////
+void RandStream::FillUniform(double *_values, std::size_t _count,
+                             double _min, double _max, unsigned int _threads)
+{
+  const double scale = (_max - _min) * kDoubleScale;
+  this->dataPtr->Fill<double, 2>(_values, _count, _threads,
+    [&](const PhiloxLanes &_lanes, double *_out)
+    {
+      for (std::size_t j = 0; j < kPhiloxBatch; ++j)
+      {
+        _out[2 * j] = _min + scale *
+          static_cast<double>(Bits53(_lanes[0][j], _lanes[1][j]));
+        _out[2 * j + 1] = _min + scale *
+          static_cast<double>(Bits53(_lanes[2][j], _lanes[3][j]));
+      }
+    });
+}
+
+//////////////////////////////////////////////////
+void RandStream::FillUniform(float *_values, std::size_t _count,
+                             float _min, float _max, unsigned int _threads)
+{
+  const float scale = (_max - _min) * kFloatScale;
+  this->dataPtr->Fill<float, 4>(_values, _count, _threads,
+    [&](const PhiloxLanes &_lanes, float *_out)
+    {
+      for (std::size_t j = 0; j < kPhiloxBatch; ++j)
+      {
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+          _out[4 * j + i] = _min + scale *
+            static_cast<float>(_lanes[i][j] >> 8);
+        }
+      }
+    });
+}
+
+//////////////////////////////////////////////////
+void RandStream::FillNormal(double *_values, std::size_t _count,
+                            double _mean, double _sigma,
+                            unsigned int _threads)
+{
+  this->dataPtr->Fill<double, 2>(_values, _count, _threads,
+    [&](const PhiloxLanes &_lanes, double *_out)
+    {
+      for (std::size_t j = 0; j < kPhiloxBatch; ++j)
+      {
+        // Box-Muller, with the first uniform in (0, 1) so that its
+        // logarithm is finite.
+        const double u1 = (static_cast<double>(
+              Bits53(_lanes[0][j], _lanes[1][j])) + 0.5) * kDoubleScale;
+        const double u2 = static_cast<double>(
+            Bits53(_lanes[2][j], _lanes[3][j])) * kDoubleScale;
+        const double radius = _sigma * std::sqrt(-2.0 * std::log(u1));
+        const double angle = 2.0 * GZ_PI * u2;
+        _out[2 * j] = _mean + radius * std::cos(angle);
+        _out[2 * j + 1] = _mean + radius * std::sin(angle);
+      }
+    });
+}
+
+//////////////////////////////////////////////////
+void RandStream::FillNormal(float *_values, std::size_t _count,
+                            float _mean, float _sigma, unsigned int _threads)
+{
+  this->dataPtr->Fill<float, 4>(_values, _count, _threads,
+    [&](const PhiloxLanes &_lanes, float *_out)
+    {
+      for (std::size_t j = 0; j < kPhiloxBatch; ++j)
+      {
+        for (std::size_t i = 0; i < 4; i += 2)
+        {
+          const float u1 = (static_cast<float>(_lanes[i][j] >> 8) + 0.5f) *
+            kFloatScale;
+          const float u2 = static_cast<float>(_lanes[i + 1][j] >> 8) *
+            kFloatScale;
+          const float radius = _sigma * std::sqrt(-2.0f * std::log(u1));
+          const float angle = 2.0f * static_cast<float>(GZ_PI) * u2;
+          _out[4 * j + i] = _mean + radius * std::cos(angle);
+          _out[4 * j + i + 1] = _mean + radius * std::sin(angle);
+        }
+      }
+    });
+}
+
 //////////////////////////////////////////////////
 void Rand::Seed(unsigned int _seed)
 {
   std::seed_seq seq{_seed};
+  std::lock_guard<std::mutex> lock(RandMutex());
   SeedMutable() = _seed;
   RandGenerator().seed(seq);
+  ++g_seedGeneration;
 }
 
 //////////////////////////////////////////////////
 unsigned int Rand::Seed()
 {
+  std::lock_guard<std::mutex> lock(RandMutex());
   return SeedMutable();
 }
 
@@ -50,6 +344,7 @@ unsigned int Rand::Seed()
 double Rand::DblUniform(double _min, double _max)
 {
   UniformRealDist d(_min, _max);
+  std::lock_guard<std::mutex> lock(RandMutex());
   return d(RandGenerator());
 }
 
@@ -61,6 +356,7 @@ double Rand::DblNormal(double _mean, double _sigma)
     return _mean;
 
   NormalRealDist d(_mean, _sigma);
+  std::lock_guard<std::mutex> lock(RandMutex());
   return d(RandGenerator());
 }
 
@@ -69,6 +365,7 @@ int32_t Rand::IntUniform(int _min, int _max)
 {
   UniformIntDist d(_min, _max);
 
+  std::lock_guard<std::mutex> lock(RandMutex());
   return d(RandGenerator());
 }
 
@@ -80,9 +377,26 @@ int32_t Rand::IntNormal(int _mean, int _sigma)
 
   NormalRealDist d(_mean, _sigma);
 
+  std::lock_guard<std::mutex> lock(RandMutex());
   return static_cast<int32_t>(d(RandGenerator()));
 }
 
+//////////////////////////////////////////////////
+RandStream &Rand::ThreadStream()
+{
+  thread_local const uint64_t index = g_nextThreadStream++;
+  thread_local uint64_t generation = g_seedGeneration.load();
+  thread_local RandStream stream(index);
+
+  const uint64_t current = g_seedGeneration.load(std::memory_order_relaxed);
+  if (current != generation)
+  {
+    generation = current;
+    stream.Seed(Seed(), index);
+  }
+  return stream;
+}
+
 //////////////////////////////////////////////////
 uint32_t &Rand::SeedMutable()
 {
@@ -96,6 +410,6 @@ uint32_t &Rand::SeedMutable()
 //////////////////////////////////////////////////
 GeneratorType &Rand::RandGenerator()
 {
-  static GeneratorType randGenerator(Seed());
+  static GeneratorType randGenerator(SeedMutable());
   return randGenerator;
 }
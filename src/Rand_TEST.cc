@@ -17,8 +17,13 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <thread>
+#include <vector>
+
 #include "gz/math/Helpers.hh"
 #include "gz/math/Rand.hh"
+#include "gz/math/detail/Philox.hh"
 
 using namespace gz;
 
@@ -84,3 +89,226 @@ TEST(RandTest, SetSeed)
     EXPECT_EQ(second[i], math::Rand::IntUniform(-10, 10));
   }
 }
+
+//////////////////////////////////////////////////
+TEST(RandTest, Stream)
+{
+  math::RandStream a(42, 0);
+  math::RandStream b(42, 0);
+  math::RandStream c(42, 1);
+  EXPECT_EQ(42u, a.Seed());
+  EXPECT_EQ(1u, c.Stream());
+
+  std::vector<double> valuesA;
+  std::vector<double> valuesC;
+  for (int i = 0; i < 100; ++i)
+  {
+    const double value = a.DblUniform(1, 2);
+    EXPECT_GE(value, 1);
+    EXPECT_LE(value, 2);
+    EXPECT_DOUBLE_EQ(value, b.DblUniform(1, 2));
+    valuesA.push_back(value);
+    valuesC.push_back(c.DblUniform(1, 2));
+
+    const int32_t integer = a.IntUniform(-3, 3);
+    EXPECT_GE(integer, -3);
+    EXPECT_LE(integer, 3);
+    EXPECT_EQ(integer, b.IntUniform(-3, 3));
+
+    EXPECT_DOUBLE_EQ(a.DblNormal(2, 3), b.DblNormal(2, 3));
+    EXPECT_EQ(a.IntNormal(10, 5), b.IntNormal(10, 5));
+  }
+  // Different streams of the same seed differ
+  EXPECT_NE(valuesA, valuesC);
+
+  // Zero sigma
+  EXPECT_DOUBLE_EQ(2.0, a.DblNormal(2.0, 0.0));
+  EXPECT_EQ(10, a.IntNormal(10, 0));
+
+  // Copies continue the same sequence
+  math::RandStream copy(a);
+  EXPECT_DOUBLE_EQ(a.DblNormal(), copy.DblNormal());
+  EXPECT_EQ(a.Generator()(), copy.Generator()());
+
+  // Reseeding restarts the sequence
+  a.Seed(42, 1);
+  for (double value : valuesC)
+    EXPECT_DOUBLE_EQ(value, a.DblUniform(1, 2));
+
+  // The default seed is the one of Rand
+  math::Rand::Seed(7);
+  math::RandStream d(3);
+  math::RandStream e(7, 3);
+  EXPECT_EQ(7u, d.Seed());
+  EXPECT_EQ(d.Generator()(), e.Generator()());
+
+  // Normal samples have the requested moments
+  math::RandStream normal(1, 0);
+  double sum = 0;
+  double sum2 = 0;
+  const int n = 100000;
+  for (int i = 0; i < n; ++i)
+  {
+    const double value = normal.DblNormal(5, 2);
+    sum += value;
+    sum2 += value * value;
+  }
+  const double mean = sum / n;
+  EXPECT_NEAR(5.0, mean, 0.05);
+  EXPECT_NEAR(4.0, sum2 / n - mean * mean, 0.1);
+}
+
+//////////////////////////////////////////////////
+TEST(RandTest, ThreadStream)
+{
+  math::Rand::Seed(11);
+  math::RandStream &main = math::Rand::ThreadStream();
+  EXPECT_EQ(&main, &math::Rand::ThreadStream());
+  EXPECT_EQ(11u, main.Seed());
+
+  // Each thread gets its own stream
+  const int threads = 4;
+  std::vector<uint64_t> streams(threads);
+  std::vector<unsigned int> seeds(threads);
+  std::vector<math::RandStream *> addresses(threads);
+  std::vector<std::thread> workers;
+  for (int i = 0; i < threads; ++i)
+  {
+    workers.emplace_back([&, i]()
+      {
+        math::RandStream &stream = math::Rand::ThreadStream();
+        for (int j = 0; j < 1000; ++j)
+          stream.DblNormal();
+        streams[i] = stream.Stream();
+        seeds[i] = stream.Seed();
+        addresses[i] = &stream;
+      });
+  }
+  for (auto &worker : workers)
+    worker.join();
+
+  for (int i = 0; i < threads; ++i)
+  {
+    EXPECT_EQ(11u, seeds[i]);
+    EXPECT_NE(main.Stream(), streams[i]);
+    EXPECT_NE(&main, addresses[i]);
+    for (int j = i + 1; j < threads; ++j)
+      EXPECT_NE(streams[i], streams[j]);
+  }
+
+  // Setting the seed reseeds the stream of the thread, keeping its index
+  const uint64_t index = main.Stream();
+  main.DblUniform();
+  math::Rand::Seed(12);
+  math::RandStream &reseeded = math::Rand::ThreadStream();
+  EXPECT_EQ(&main, &reseeded);
+  EXPECT_EQ(12u, reseeded.Seed());
+  EXPECT_EQ(index, reseeded.Stream());
+  math::RandStream expected(12, index);
+  EXPECT_DOUBLE_EQ(expected.DblUniform(), reseeded.DblUniform());
+}
+
+//////////////////////////////////////////////////
+TEST(RandTest, Philox)
+{
+  // Known answers from the Random123 library
+  constexpr auto zero = math::detail::Philox4x32({0, 0, 0, 0}, {0, 0});
+  static_assert(zero[0] == 0x6627e8d5u);
+  EXPECT_EQ(math::detail::PhiloxCounter(
+        {0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}), zero);
+
+  EXPECT_EQ(math::detail::PhiloxCounter(
+        {0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}),
+      math::detail::Philox4x32(
+        {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+        {0xffffffffu, 0xffffffffu}));
+
+  EXPECT_EQ(math::detail::PhiloxCounter(
+        {0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}),
+      math::detail::Philox4x32(
+        {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+        {0xa4093822u, 0x299f31d0u}));
+}
+
+//////////////////////////////////////////////////
+TEST(RandTest, Fill)
+{
+  const std::size_t n = 100001;
+  math::RandStream stream(5, 2);
+
+  // Uniform values within bounds
+  std::vector<double> uniform(n);
+  stream.FillUniform(uniform.data(), n, -2.0, 3.0);
+  double sum = 0;
+  for (double value : uniform)
+  {
+    EXPECT_GE(value, -2.0);
+    EXPECT_LT(value, 3.0);
+    sum += value;
+  }
+  EXPECT_NEAR(0.5, sum / n, 0.02);
+
+  std::vector<float> uniformFloat(n);
+  stream.FillUniform(uniformFloat.data(), n, 1.0f, 2.0f);
+  for (float value : uniformFloat)
+  {
+    EXPECT_GE(value, 1.0f);
+    EXPECT_LE(value, 2.0f);
+  }
+
+  // Normal values have the requested moments
+  std::vector<double> normal(n);
+  stream.FillNormal(normal.data(), n, 5.0, 2.0);
+  double sum2 = 0;
+  sum = 0;
+  for (double value : normal)
+  {
+    sum += value;
+    sum2 += value * value;
+  }
+  double mean = sum / n;
+  EXPECT_NEAR(5.0, mean, 0.05);
+  EXPECT_NEAR(4.0, sum2 / n - mean * mean, 0.1);
+
+  std::vector<float> normalFloat(n);
+  stream.FillNormal(normalFloat.data(), n, -1.0f, 0.5f);
+  sum = 0;
+  sum2 = 0;
+  for (float value : normalFloat)
+  {
+    ASSERT_TRUE(std::isfinite(value));
+    sum += value;
+    sum2 += value * value;
+  }
+  mean = sum / n;
+  EXPECT_NEAR(-1.0, mean, 0.01);
+  EXPECT_NEAR(0.25, sum2 / n - mean * mean, 0.01);
+
+  // The same seed and stream give the same values, whatever the number of
+  // threads
+  math::RandStream again(5, 2);
+  std::vector<double> values(n);
+  again.FillUniform(values.data(), n, -2.0, 3.0, 4);
+  EXPECT_EQ(uniform, values);
+  std::vector<float> valuesFloat(n);
+  again.FillUniform(valuesFloat.data(), n, 1.0f, 2.0f, 3);
+  EXPECT_EQ(uniformFloat, valuesFloat);
+  again.FillNormal(values.data(), n, 5.0, 2.0, 0);
+  EXPECT_EQ(normal, values);
+  again.FillNormal(valuesFloat.data(), n, -1.0f, 0.5f, 4);
+  EXPECT_EQ(normalFloat, valuesFloat);
+
+  // Consecutive fills continue the sequence
+  again.Seed(5, 2);
+  again.FillUniform(values.data(), 60000, -2.0, 3.0);
+  again.FillUniform(values.data() + 60000, n - 60000, -2.0, 3.0);
+  EXPECT_EQ(uniform, values);
+
+  // Other streams differ
+  math::RandStream other(5, 3);
+  other.FillUniform(values.data(), n, -2.0, 3.0);
+  EXPECT_NE(uniform, values);
+
+  // Empty fills do nothing
+  other.FillNormal(static_cast<double *>(nullptr), 0);
+}
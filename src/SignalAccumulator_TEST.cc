@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "gz/math/Rand.hh"
+#include "gz/math/SignalAccumulator.hh"
+#include "gz/math/SignalStats.hh"
+
+using namespace gz;
+using namespace math;
+
+using AllStats = SignalAccumulator<stats::Mean, stats::Variance,
+  stats::RootMeanSquare, stats::Minimum, stats::Maximum,
+  stats::MaxAbsoluteValue>;
+
+/////////////////////////////////////////////////
+TEST(SignalAccumulatorTest, Empty)
+{
+  AllStats acc;
+  EXPECT_EQ(0u, acc.Count());
+  const std::map<std::string, double> map = acc.Map();
+  ASSERT_EQ(6u, map.size());
+  for (const auto &[name, value] : map)
+    EXPECT_DOUBLE_EQ(0.0, value) << name;
+
+  // An empty batch changes nothing
+  acc.InsertData(nullptr, 0);
+  EXPECT_EQ(0u, acc.Count());
+
+  // A single sample
+  acc.InsertData(-2.0);
+  EXPECT_EQ(1u, acc.Count());
+  EXPECT_DOUBLE_EQ(-2.0, acc.Value<stats::Mean>());
+  EXPECT_DOUBLE_EQ(0.0, acc.Value<stats::Variance>());
+  EXPECT_DOUBLE_EQ(2.0, acc.Value<stats::RootMeanSquare>());
+  EXPECT_DOUBLE_EQ(-2.0, acc.Value<stats::Minimum>());
+  EXPECT_DOUBLE_EQ(-2.0, acc.Value<stats::Maximum>());
+  EXPECT_DOUBLE_EQ(2.0, acc.Value<stats::MaxAbsoluteValue>());
+
+  acc.Reset();
+  EXPECT_EQ(0u, acc.Count());
+  EXPECT_DOUBLE_EQ(0.0, acc.Value<stats::Minimum>());
+}
+
+/////////////////////////////////////////////////
+TEST(SignalAccumulatorTest, MatchesSignalStats)
+{
+  SignalStats reference;
+  EXPECT_TRUE(reference.InsertStatistics("max,mean,min,rms,maxAbs,var"));
+
+  // Sizes around the block size exercise partial and full blocks
+  std::vector<double> data;
+  Rand::Seed(42);
+  for (std::size_t i = 0; i < 3 * AllStats::kBlockSize + 17; ++i)
+    data.push_back(Rand::DblNormal(100.0, 3.0));
+
+  for (const std::size_t size : {std::size_t(1), std::size_t(2),
+       AllStats::kBlockSize - 1, AllStats::kBlockSize,
+       AllStats::kBlockSize + 1, data.size()})
+  {
+    reference.Reset();
+    AllStats single;
+    AllStats batch;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      reference.InsertData(data[i]);
+      single.InsertData(data[i]);
+    }
+    batch.InsertData(data.data(), size);
+    EXPECT_EQ(size, single.Count());
+    EXPECT_EQ(size, batch.Count());
+
+    const std::map<std::string, double> expected = reference.Map();
+    const std::map<std::string, double> singleMap = single.Map();
+    const std::map<std::string, double> batchMap = batch.Map();
+    ASSERT_EQ(expected.size(), singleMap.size());
+    ASSERT_EQ(expected.size(), batchMap.size());
+    for (const auto &[name, value] : expected)
+    {
+      const double tolerance = 1e-9 * std::max(1.0, std::abs(value));
+      EXPECT_NEAR(value, singleMap.at(name), tolerance) << name << size;
+      EXPECT_NEAR(value, batchMap.at(name), tolerance) << name << size;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(SignalAccumulatorTest, MixedInsertion)
+{
+  // Batches and single samples can be interleaved
+  std::vector<double> data;
+  for (int i = 0; i < 1000; ++i)
+    data.push_back(1e6 + 0.001 * (i % 13) - 0.5 * (i % 2));
+
+  SignalAccumulator<stats::Variance, stats::Mean> reference;
+  SignalAccumulator<stats::Variance, stats::Mean> mixed;
+  for (double value : data)
+    reference.InsertData(value);
+  mixed.InsertData(data.data(), 300);
+  for (std::size_t i = 300; i < 310; ++i)
+    mixed.InsertData(data[i]);
+  mixed.InsertData(std::vector<double>(data.begin() + 310, data.end()));
+
+  EXPECT_EQ(reference.Count(), mixed.Count());
+  EXPECT_NEAR(reference.Value<stats::Mean>(), mixed.Value<stats::Mean>(),
+              1e-6);
+  // The variance stays accurate with a large offset
+  EXPECT_NEAR(reference.Value<stats::Variance>(),
+              mixed.Value<stats::Variance>(),
+              1e-9 * reference.Value<stats::Variance>());
+
+  // Only the selected statistics are reported
+  const std::map<std::string, double> map = mixed.Map();
+  ASSERT_EQ(2u, map.size());
+  EXPECT_NE(map.end(), map.find("var"));
+  EXPECT_NE(map.end(), map.find("mean"));
+}
@@ -14,8 +14,12 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
+#include <cctype>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <map>
 #include <memory>
 #include <sstream>
@@ -23,11 +27,302 @@
 #include <vector>
 #include <gz/math/SignalStats.hh>
 #include <gz/math/detail/Error.hh>
+#include <gz/math/detail/ParallelFor.hh>
 #include <gz/utils/ImplPtr.hh>
 
 using namespace gz;
 using namespace math;
 
+namespace
+{
+/// \brief Maximum number of buckets of each sign of a LogHistogram.
+constexpr int kMaxBuckets = 2048;
+
+/// \brief Minimum number of buckets added when a BucketStore grows.
+constexpr int kBucketGrowth = 64;
+
+/// \brief Largest magnitude of a bucket index. Finite samples only reach
+/// it with a relative accuracy below about 1e-5.
+constexpr double kMaxBucketIndex = 1 << 24;
+
+/// \brief Counts of samples of one sign in logarithmically spaced
+/// buckets. Indices of non-empty buckets span at most kMaxBuckets, the
+/// lowest buckets are collapsed beyond that.
+class BucketStore
+{
+  /// \brief Add samples to a bucket.
+  /// \param[in] _index Index of the bucket.
+  /// \param[in] _count Number of samples.
+  public: void Add(int _index, uint64_t _count)
+  {
+    if (this->total == 0)
+    {
+      this->minIndex = _index;
+      this->maxIndex = _index;
+    }
+    const int low = std::min(this->minIndex, _index);
+    const int high = std::max(this->maxIndex, _index);
+    const int floor = std::max(low, high - kMaxBuckets + 1);
+
+    // Collapse the buckets below the floor into it
+    uint64_t folded = 0;
+    if (this->total > 0)
+    {
+      for (int i = this->minIndex; i < floor && i <= this->maxIndex; ++i)
+      {
+        folded += this->counts[i - this->offset];
+        this->counts[i - this->offset] = 0;
+      }
+    }
+    this->collapsed = this->collapsed || floor > low;
+
+    this->Reserve(floor, high);
+    this->minIndex = floor;
+    this->maxIndex = high;
+    this->counts[floor - this->offset] += folded;
+    this->counts[std::max(_index, floor) - this->offset] += _count;
+    this->total += _count;
+  }
+
+  /// \brief Add the samples of another store.
+  /// \param[in] _other Store to add.
+  public: void Merge(const BucketStore &_other)
+  {
+    if (_other.total == 0)
+      return;
+    for (int i = _other.minIndex; i <= _other.maxIndex; ++i)
+    {
+      const uint64_t count = _other.Count(i);
+      if (count > 0)
+        this->Add(i, count);
+    }
+    this->collapsed = this->collapsed || _other.collapsed;
+  }
+
+  /// \brief Get the number of samples in a bucket.
+  /// \param[in] _index Index of the bucket, in [minIndex, maxIndex].
+  /// \return Number of samples.
+  public: uint64_t Count(int _index) const
+  {
+    return this->counts[_index - this->offset];
+  }
+
+  /// \brief Remove all samples.
+  public: void Clear()
+  {
+    this->counts.clear();
+    this->offset = 0;
+    this->total = 0;
+    this->collapsed = false;
+  }
+
+  /// \brief Make room for buckets [_low, _high], with some slack on the
+  /// sides that grow so that reallocations are amortized.
+  /// \param[in] _low Lowest bucket index.
+  /// \param[in] _high Highest bucket index.
+  private: void Reserve(int _low, int _high)
+  {
+    const int end = this->offset + static_cast<int>(this->counts.size());
+    if (!this->counts.empty() && _low >= this->offset && _high < end)
+      return;
+
+    const int margin = std::max(kBucketGrowth, (_high - _low + 1) / 2);
+    const int newLow = _low < this->offset || this->counts.empty() ?
+      _low - margin : _low;
+    const int newHigh = _high >= end ? _high + margin : end - 1;
+    std::vector<uint64_t> newCounts(newHigh - newLow + 1, 0);
+    if (this->total > 0)
+    {
+      // Buckets below _low have been collapsed, so they are all empty
+      for (int i = std::max(this->minIndex, newLow); i <= this->maxIndex; ++i)
+        newCounts[i - newLow] = this->counts[i - this->offset];
+    }
+    this->counts.swap(newCounts);
+    this->offset = newLow;
+  }
+
+  /// \brief Bucket counts, counts[i] is the count of bucket offset + i.
+  public: std::vector<uint64_t> counts;
+
+  /// \brief Index of the first element of counts.
+  public: int offset = 0;
+
+  /// \brief Lower bound of the indices of non-empty buckets.
+  public: int minIndex = 0;
+
+  /// \brief Upper bound of the indices of non-empty buckets.
+  public: int maxIndex = 0;
+
+  /// \brief Total number of samples.
+  public: uint64_t total = 0;
+
+  /// \brief Whether the lowest buckets have been collapsed.
+  public: bool collapsed = false;
+};
+
+/// \brief Histogram of samples of any sign, with buckets whose bounds are
+/// consecutive powers of gamma. Bucket i of each sign holds magnitudes in
+/// (gamma^(i-1), gamma^i].
+class LogHistogram
+{
+  /// \brief Constructor
+  /// \param[in] _relativeAccuracy Relative accuracy of the bucket
+  /// centers, in (0, 1).
+  public: explicit LogHistogram(double _relativeAccuracy = 0.01)
+    : gamma((1.0 + _relativeAccuracy) / (1.0 - _relativeAccuracy)),
+      logGamma(std::log(gamma))
+  {
+  }
+
+  /// \brief Add a sample. NaN and infinite samples are ignored, since a
+  /// single one would otherwise collapse every finite sample into the
+  /// lowest bucket.
+  /// \param[in] _value Sample.
+  public: void Insert(double _value)
+  {
+    if (!std::isfinite(_value))
+      return;
+
+    const double magnitude = std::abs(_value);
+    if (!(magnitude > 0))
+      ++this->zeroCount;
+    else if (_value > 0)
+      this->positive.Add(this->Index(magnitude), 1);
+    else
+      this->negative.Add(this->Index(magnitude), 1);
+  }
+
+  /// \brief Check whether another histogram has the same buckets.
+  /// \param[in] _other Other histogram.
+  /// \return True if the buckets are the same.
+  public: bool SameBuckets(const LogHistogram &_other) const
+  {
+    return std::abs(this->gamma - _other.gamma) <= 0;
+  }
+
+  /// \brief Add the samples of another histogram.
+  /// \param[in] _other Histogram with the same buckets.
+  /// \return False if the buckets differ.
+  public: bool Merge(const LogHistogram &_other)
+  {
+    if (!this->SameBuckets(_other))
+      return false;
+    this->positive.Merge(_other.positive);
+    this->negative.Merge(_other.negative);
+    this->zeroCount += _other.zeroCount;
+    return true;
+  }
+
+  /// \brief Get the number of samples.
+  /// \return Number of samples.
+  public: uint64_t Count() const
+  {
+    return this->positive.total + this->negative.total + this->zeroCount;
+  }
+
+  /// \brief Call a function on each non-empty bucket, in increasing order
+  /// of value.
+  /// \param[in] _func Function called with the bucket sign (-1, 0 or 1),
+  /// index and count. It returns false to stop the iteration.
+  public: template<typename Func>
+  void ForEach(const Func &_func) const
+  {
+    if (this->negative.total > 0)
+    {
+      for (int i = this->negative.maxIndex; i >= this->negative.minIndex; --i)
+      {
+        const uint64_t count = this->negative.Count(i);
+        if (count > 0 && !_func(-1, i, count))
+          return;
+      }
+    }
+    if (this->zeroCount > 0 && !_func(0, 0, this->zeroCount))
+      return;
+    if (this->positive.total > 0)
+    {
+      for (int i = this->positive.minIndex; i <= this->positive.maxIndex; ++i)
+      {
+        const uint64_t count = this->positive.Count(i);
+        if (count > 0 && !_func(1, i, count))
+          return;
+      }
+    }
+  }
+
+  /// \brief Get the value that represents a bucket, within the relative
+  /// accuracy of all the samples it holds.
+  /// \param[in] _sign Sign of the bucket.
+  /// \param[in] _index Index of the bucket.
+  /// \return Value of the bucket.
+  public: double Value(int _sign, int _index) const
+  {
+    return _sign * 2.0 * this->Bound(_index) / (1.0 + this->gamma);
+  }
+
+  /// \brief Get the upper bound of the magnitudes of a bucket.
+  /// \param[in] _index Index of the bucket.
+  /// \return gamma^_index.
+  public: double Bound(int _index) const
+  {
+    return std::exp(_index * this->logGamma);
+  }
+
+  /// \brief Estimate a quantile.
+  /// \param[in] _quantile Quantile, in [0, 1].
+  /// \return Estimated quantile, 0 without samples.
+  public: double Quantile(double _quantile) const
+  {
+    const uint64_t count = this->Count();
+    if (count == 0)
+      return 0.0;
+
+    const double rank = _quantile * static_cast<double>(count - 1);
+    double result = 0.0;
+    uint64_t cumulative = 0;
+    this->ForEach([&](int _sign, int _index, uint64_t _count)
+      {
+        cumulative += _count;
+        result = this->Value(_sign, _index);
+        return !(static_cast<double>(cumulative) > rank);
+      });
+    return result;
+  }
+
+  /// \brief Remove all samples.
+  public: void Clear()
+  {
+    this->positive.Clear();
+    this->negative.Clear();
+    this->zeroCount = 0;
+  }
+
+  /// \brief Get the index of the bucket of a positive magnitude.
+  /// \param[in] _magnitude Magnitude of a sample.
+  /// \return Bucket index.
+  private: int Index(double _magnitude) const
+  {
+    const double index = std::ceil(std::log(_magnitude) / this->logGamma);
+    return static_cast<int>(
+        std::clamp(index, -kMaxBucketIndex, kMaxBucketIndex));
+  }
+
+  /// \brief Ratio of consecutive bucket bounds.
+  public: double gamma;
+
+  /// \brief Natural logarithm of gamma.
+  public: double logGamma;
+
+  /// \brief Buckets of positive samples.
+  public: BucketStore positive;
+
+  /// \brief Buckets of negative samples, indexed by magnitude.
+  public: BucketStore negative;
+
+  /// \brief Number of samples equal to zero.
+  public: uint64_t zeroCount = 0;
+};
+}  // namespace
+
 /// \brief Private data class for the SignalStatistic class.
 class SignalStatistic::Implementation
 {
@@ -42,6 +337,20 @@ class SignalStatistic::Implementation
   public: unsigned int count;
 };
 
+/// \brief Private data class for the SignalQuantile class.
+class SignalQuantile::HistogramData
+{
+  /// \brief Histogram of signal data.
+  public: LogHistogram histogram;
+};
+
+/// \brief Private data class for the SignalHistogram class.
+class SignalHistogram::HistogramData
+{
+  /// \brief Histogram of signal data.
+  public: LogHistogram histogram;
+};
+
 /// \def SignalStatisticPtr
 /// \brief Shared pointer to SignalStatistic object
 typedef std::shared_ptr<SignalStatistic> SignalStatisticPtr;
@@ -78,6 +387,52 @@ void SignalStatistic::Reset()
   this->dataPtr->count = 0;
 }
 
+//////////////////////////////////////////////////
+bool SignalStatistic::Merge(const SignalStatistic &_other)
+{
+  if (this->ShortName() != _other.ShortName())
+  {
+    std::ostringstream errStream;
+    errStream << "Unable to Merge statistic [" << _other.ShortName()
+              << "] into statistic [" << this->ShortName() << "].";
+    detail::LogErrorMessage(errStream.str());
+    return false;
+  }
+
+  // Read the other count first in case a statistic is merged with itself
+  const unsigned int otherCount = _other.dataPtr->count;
+  if (!this->MergeStatistic(_other))
+  {
+    std::ostringstream errStream;
+    errStream << "Unable to Merge statistic [" << this->ShortName()
+              << "] since its data is not compatible.";
+    detail::LogErrorMessage(errStream.str());
+    return false;
+  }
+  this->dataPtr->count += otherCount;
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool SignalStatistic::CanMerge(const SignalStatistic &_other) const
+{
+  return this->ShortName() == _other.ShortName();
+}
+
+//////////////////////////////////////////////////
+bool SignalStatistic::MergeData(const Implementation &)
+{
+  return false;
+}
+
+//////////////////////////////////////////////////
+bool SignalStatistic::MergeStatistic(const SignalStatistic &_other)
+{
+  // Copy the other data in case a statistic is merged with itself
+  const Implementation other = *_other.dataPtr;
+  return this->MergeData(other);
+}
+
 //////////////////////////////////////////////////
 double SignalMaximum::Value() const
 {
@@ -100,6 +455,17 @@ void SignalMaximum::InsertData(const double _data)
   this->dataPtr->count++;
 }
 
+//////////////////////////////////////////////////
+bool SignalMaximum::MergeData(const Implementation &_other)
+{
+  if (_other.count > 0 &&
+      (this->dataPtr->count == 0 || _other.data > this->dataPtr->data))
+  {
+    this->dataPtr->data = _other.data;
+  }
+  return true;
+}
+
 //////////////////////////////////////////////////
 double SignalMean::Value() const
 {
@@ -123,6 +489,13 @@ void SignalMean::InsertData(const double _data)
   this->dataPtr->count++;
 }
 
+//////////////////////////////////////////////////
+bool SignalMean::MergeData(const Implementation &_other)
+{
+  this->dataPtr->data += _other.data;
+  return true;
+}
+
 //////////////////////////////////////////////////
 double SignalMinimum::Value() const
 {
@@ -145,6 +518,17 @@ void SignalMinimum::InsertData(const double _data)
   this->dataPtr->count++;
 }
 
+//////////////////////////////////////////////////
+bool SignalMinimum::MergeData(const Implementation &_other)
+{
+  if (_other.count > 0 &&
+      (this->dataPtr->count == 0 || _other.data < this->dataPtr->data))
+  {
+    this->dataPtr->data = _other.data;
+  }
+  return true;
+}
+
 //////////////////////////////////////////////////
 double SignalRootMeanSquare::Value() const
 {
@@ -168,6 +552,13 @@ void SignalRootMeanSquare::InsertData(const double _data)
   this->dataPtr->count++;
 }
 
+//////////////////////////////////////////////////
+bool SignalRootMeanSquare::MergeData(const Implementation &_other)
+{
+  this->dataPtr->data += _other.data;
+  return true;
+}
+
 //////////////////////////////////////////////////
 double SignalMaxAbsoluteValue::Value() const
 {
@@ -191,6 +582,13 @@ void SignalMaxAbsoluteValue::InsertData(const double _data)
   this->dataPtr->count++;
 }
 
+//////////////////////////////////////////////////
+bool SignalMaxAbsoluteValue::MergeData(const Implementation &_other)
+{
+  this->dataPtr->data = std::max(this->dataPtr->data, _other.data);
+  return true;
+}
+
 //////////////////////////////////////////////////
 // wikipedia.org/wiki/Algorithms_for_calculating_variance#Online_algorithm
 // based on Knuth's algorithm
@@ -227,6 +625,184 @@ void SignalVariance::InsertData(const double _data)
   this->dataPtr->data += delta * (_data - this->dataPtr->extraData);
 }
 
+//////////////////////////////////////////////////
+// wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+// based on Chan et al.'s algorithm
+bool SignalVariance::MergeData(const Implementation &_other)
+{
+  if (_other.count == 0)
+    return true;
+
+  // n = na + nb
+  const double countA = this->dataPtr->count;
+  const double countB = _other.count;
+  const double count = countA + countB;
+
+  // delta = mean_b - mean_a
+  const double delta = _other.extraData - this->dataPtr->extraData;
+
+  // mean = mean_a + delta * nb / n
+  this->dataPtr->extraData += delta * countB / count;
+
+  // M2 = M2_a + M2_b + delta^2 * na * nb / n
+  this->dataPtr->data += _other.data + delta * delta * countA * countB / count;
+  return true;
+}
+
+//////////////////////////////////////////////////
+SignalQuantile::SignalQuantile(double _quantile, double _relativeAccuracy)
+  : histogramPtr(gz::utils::MakeImpl<HistogramData>())
+{
+  this->dataPtr->extraData = std::clamp(_quantile, 0.0, 1.0);
+  this->histogramPtr->histogram =
+    LogHistogram(std::clamp(_relativeAccuracy, 1e-4, 0.5));
+}
+
+//////////////////////////////////////////////////
+double SignalQuantile::Value() const
+{
+  return this->histogramPtr->histogram.Quantile(this->dataPtr->extraData);
+}
+
+//////////////////////////////////////////////////
+std::string SignalQuantile::ShortName() const
+{
+  std::ostringstream name;
+  name << "p" << this->dataPtr->extraData * 100.0;
+  return name.str();
+}
+
+//////////////////////////////////////////////////
+void SignalQuantile::InsertData(const double _data)
+{
+  this->histogramPtr->histogram.Insert(_data);
+  this->dataPtr->count++;
+}
+
+//////////////////////////////////////////////////
+double SignalQuantile::Quantile() const
+{
+  return this->dataPtr->extraData;
+}
+
+//////////////////////////////////////////////////
+void SignalQuantile::Reset()
+{
+  SignalStatistic::Reset();
+  this->histogramPtr->histogram.Clear();
+}
+
+//////////////////////////////////////////////////
+bool SignalQuantile::CanMerge(const SignalStatistic &_other) const
+{
+  const auto *other = dynamic_cast<const SignalQuantile *>(&_other);
+  return other && this->ShortName() == other->ShortName() &&
+    this->histogramPtr->histogram.SameBuckets(other->histogramPtr->histogram);
+}
+
+//////////////////////////////////////////////////
+bool SignalQuantile::MergeStatistic(const SignalStatistic &_other)
+{
+  const auto *other = dynamic_cast<const SignalQuantile *>(&_other);
+  if (!other)
+    return false;
+
+  // Copy the other histogram in case a statistic is merged with itself
+  const LogHistogram histogram = other->histogramPtr->histogram;
+  return this->histogramPtr->histogram.Merge(histogram);
+}
+
+//////////////////////////////////////////////////
+SignalHistogram::SignalHistogram(double _relativeAccuracy)
+  : histogramPtr(gz::utils::MakeImpl<HistogramData>())
+{
+  this->histogramPtr->histogram =
+    LogHistogram(std::clamp(_relativeAccuracy, 1e-4, 0.5));
+}
+
+//////////////////////////////////////////////////
+double SignalHistogram::Value() const
+{
+  double mode = 0.0;
+  uint64_t modeCount = 0;
+  const LogHistogram &histogram = this->histogramPtr->histogram;
+  histogram.ForEach([&](int _sign, int _index, uint64_t _count)
+    {
+      if (_count > modeCount)
+      {
+        mode = histogram.Value(_sign, _index);
+        modeCount = _count;
+      }
+      return true;
+    });
+  return mode;
+}
+
+//////////////////////////////////////////////////
+std::string SignalHistogram::ShortName() const
+{
+  return "hist";
+}
+
+//////////////////////////////////////////////////
+void SignalHistogram::InsertData(const double _data)
+{
+  this->histogramPtr->histogram.Insert(_data);
+  this->dataPtr->count++;
+}
+
+//////////////////////////////////////////////////
+std::vector<SignalHistogram::Bucket> SignalHistogram::Buckets() const
+{
+  std::vector<Bucket> buckets;
+  const LogHistogram &histogram = this->histogramPtr->histogram;
+  histogram.ForEach([&](int _sign, int _index, uint64_t _count)
+    {
+      double low = _sign == 0 ? 0.0 : histogram.Bound(_index - 1);
+      const double high = _sign == 0 ? 0.0 : histogram.Bound(_index);
+
+      // Collapsed buckets hold all the samples closer to zero
+      const BucketStore &store =
+        _sign < 0 ? histogram.negative : histogram.positive;
+      if (_sign != 0 && store.collapsed && _index == store.minIndex)
+        low = 0.0;
+
+      if (_sign < 0)
+        buckets.push_back({-high, -low, _count});
+      else
+        buckets.push_back({low, high, _count});
+      return true;
+    });
+  return buckets;
+}
+
+//////////////////////////////////////////////////
+void SignalHistogram::Reset()
+{
+  SignalStatistic::Reset();
+  this->histogramPtr->histogram.Clear();
+}
+
+//////////////////////////////////////////////////
+bool SignalHistogram::CanMerge(const SignalStatistic &_other) const
+{
+  const auto *other = dynamic_cast<const SignalHistogram *>(&_other);
+  return other && this->ShortName() == other->ShortName() &&
+    this->histogramPtr->histogram.SameBuckets(other->histogramPtr->histogram);
+}
+
+//////////////////////////////////////////////////
+bool SignalHistogram::MergeStatistic(const SignalStatistic &_other)
+{
+  const auto *other = dynamic_cast<const SignalHistogram *>(&_other);
+  if (!other)
+    return false;
+
+  // Copy the other histogram in case a statistic is merged with itself
+  const LogHistogram histogram = other->histogramPtr->histogram;
+  return this->histogramPtr->histogram.Merge(histogram);
+}
+
 //////////////////////////////////////////////////
 SignalStats::SignalStats()
   : dataPtr(gz::utils::MakeImpl<Implementation>())
@@ -263,22 +839,89 @@ void SignalStats::InsertData(const double _data)
 }
 
 //////////////////////////////////////////////////
-bool SignalStats::InsertStatistic(const std::string &_name)
+void SignalStats::InsertData(const double *_data, std::size_t _count,
+    unsigned int _threads)
 {
-  // Check if the statistic is already inserted
+  // A sample costs a few nanoseconds per statistic.
+  const unsigned int threads = detail::ThreadCount(_threads, _count, 1 << 16);
+  if (threads <= 1)
+  {
+    for (std::size_t i = 0; i < _count; ++i)
+      this->InsertData(_data[i]);
+    return;
+  }
+
+  // The first chunk is inserted here, the others in empty statistics of
+  // the same types that are merged afterwards in order.
+  std::vector<SignalStats> partial(threads - 1);
+  for (auto &stats : partial)
   {
-    auto map = this->Map();
-    if (map.find(_name) != map.end())
+    for (auto const &statistic : this->dataPtr->stats)
+      stats.InsertStatistic(statistic->ShortName());
+  }
+
+  detail::ParallelFor(_count, threads,
+    [&](std::size_t _begin, std::size_t _end, unsigned int _thread)
+    {
+      SignalStats &target = _thread == 0 ? *this : partial[_thread - 1];
+      for (std::size_t i = _begin; i < _end; ++i)
+        target.InsertData(_data[i]);
+    });
+
+  for (auto const &stats : partial)
+    this->Merge(stats);
+}
+
+//////////////////////////////////////////////////
+bool SignalStats::Merge(const SignalStats &_other)
+{
+  // Check that all statistics have a match that they can merge before
+  // changing any of them
+  std::vector<const SignalStatistic *> matches;
+  for (auto const &statistic : this->dataPtr->stats)
+  {
+    const std::string name = statistic->ShortName();
+    auto match = std::find_if(_other.dataPtr->stats.begin(),
+        _other.dataPtr->stats.end(),
+        [&name](const SignalStatisticPtr &_statistic)
+        {
+          return _statistic->ShortName() == name;
+        });
+    if (match == _other.dataPtr->stats.end())
+    {
+      std::ostringstream errStream;
+      errStream << "Unable to Merge SignalStats since statistic ["
+                << name << "] is missing from the other SignalStats.";
+      detail::LogErrorMessage(errStream.str());
+      return false;
+    }
+    if (!statistic->CanMerge(**match))
     {
       std::ostringstream errStream;
-      errStream << "Unable to InsertStatistic ["
-                << _name
-                << "] since it has already been inserted.";
+      errStream << "Unable to Merge SignalStats since statistic ["
+                << name << "] is not compatible with the other one.";
       detail::LogErrorMessage(errStream.str());
       return false;
     }
+    matches.push_back(match->get());
   }
+  if (matches.size() != _other.dataPtr->stats.size())
+  {
+    detail::LogErrorMessage(
+        "Unable to Merge SignalStats since the other SignalStats has "
+        "more statistics.");
+    return false;
+  }
+
+  bool result = true;
+  for (std::size_t i = 0; i < matches.size(); ++i)
+    result = this->dataPtr->stats[i]->Merge(*matches[i]) && result;
+  return result;
+}
 
+//////////////////////////////////////////////////
+bool SignalStats::InsertStatistic(const std::string &_name)
+{
   SignalStatisticPtr stat;
   if (_name == "max")
   {
@@ -304,7 +947,21 @@ bool SignalStats::InsertStatistic(const std::string &_name)
   {
     stat.reset(new SignalVariance());
   }
-  else
+  else if (_name == "hist")
+  {
+    stat.reset(new SignalHistogram());
+  }
+  else if (_name.size() > 1 && _name[0] == 'p' &&
+           std::isdigit(static_cast<unsigned char>(_name[1])))
+  {
+    // Percentile, such as p99
+    char *end = nullptr;
+    const double percentile = std::strtod(_name.c_str() + 1, &end);
+    if (*end == '\0' && percentile <= 100.0)
+      stat.reset(new SignalQuantile(percentile / 100.0));
+  }
+
+  if (!stat)
   {
     // Unrecognized name string
     std::ostringstream errStream;
@@ -314,10 +971,34 @@ bool SignalStats::InsertStatistic(const std::string &_name)
     detail::LogErrorMessage(errStream.str());
     return false;
   }
+
+  // Check if the statistic is already inserted, possibly under another
+  // name such as p99.0 for p99
+  if (this->Statistic(stat->ShortName()) != nullptr)
+  {
+    std::ostringstream errStream;
+    errStream << "Unable to InsertStatistic ["
+              << _name
+              << "] since it has already been inserted.";
+    detail::LogErrorMessage(errStream.str());
+    return false;
+  }
+
   this->dataPtr->stats.push_back(stat);
   return true;
 }
 
+//////////////////////////////////////////////////
+const SignalStatistic *SignalStats::Statistic(const std::string &_name) const
+{
+  for (auto const &statistic : this->dataPtr->stats)
+  {
+    if (statistic->ShortName() == _name)
+      return statistic.get();
+  }
+  return nullptr;
+}
+
 //////////////////////////////////////////////////
 bool SignalStats::InsertStatistics(const std::string &_names)
 {
@@ -17,6 +17,11 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 #include <gz/math/Rand.hh>
 #include <gz/math/SignalStats.hh>
 
@@ -639,3 +644,407 @@ TEST(SignalStatsTest, SignalStats)
   }
 }
 
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalStatisticMerge)
+{
+  // Merging two halves matches inserting all values in one statistic
+  math::SignalMaximum max, maxA, maxB;
+  math::SignalMinimum min, minA, minB;
+  math::SignalMean mean, meanA, meanB;
+  math::SignalRootMeanSquare rms, rmsA, rmsB;
+  math::SignalMaxAbsoluteValue maxAbs, maxAbsA, maxAbsB;
+  math::SignalVariance var, varA, varB;
+  std::vector<math::SignalStatistic *> all =
+    {&max, &min, &mean, &rms, &maxAbs, &var};
+  std::vector<math::SignalStatistic *> first =
+    {&maxA, &minA, &meanA, &rmsA, &maxAbsA, &varA};
+  std::vector<math::SignalStatistic *> second =
+    {&maxB, &minB, &meanB, &rmsB, &maxAbsB, &varB};
+
+  for (int i = 0; i < 100; ++i)
+  {
+    const double value = math::Rand::DblNormal(10.0, 2.0 + (i > 30));
+    for (auto *statistic : all)
+      statistic->InsertData(value);
+    for (auto *statistic : (i < 30 ? first : second))
+      statistic->InsertData(value);
+  }
+
+  for (std::size_t i = 0; i < all.size(); ++i)
+  {
+    EXPECT_TRUE(first[i]->Merge(*second[i]));
+    EXPECT_EQ(all[i]->Count(), first[i]->Count());
+    EXPECT_NEAR(all[i]->Value(), first[i]->Value(), 1e-12)
+      << all[i]->ShortName();
+  }
+
+  // Merging with an empty statistic, in both directions
+  for (std::size_t i = 0; i < all.size(); ++i)
+  {
+    second[i]->Reset();
+    EXPECT_TRUE(first[i]->Merge(*second[i]));
+    EXPECT_NEAR(all[i]->Value(), first[i]->Value(), 1e-12);
+    EXPECT_TRUE(second[i]->Merge(*first[i]));
+    EXPECT_EQ(all[i]->Count(), second[i]->Count());
+    EXPECT_NEAR(all[i]->Value(), second[i]->Value(), 1e-12);
+  }
+
+  // Merging with itself counts values twice
+  var.Reset();
+  var.InsertData(1.0);
+  var.InsertData(3.0);
+  EXPECT_TRUE(var.Merge(var));
+  EXPECT_EQ(4u, var.Count());
+  EXPECT_DOUBLE_EQ(4.0 / 3.0, var.Value());
+
+  // Different statistics cannot be merged
+  EXPECT_TRUE(max.CanMerge(maxA));
+  EXPECT_FALSE(max.CanMerge(min));
+  EXPECT_FALSE(max.Merge(min));
+  EXPECT_EQ(100u, max.Count());
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalStatsMerge)
+{
+  math::SignalStats stats, statsA, statsB;
+  EXPECT_TRUE(stats.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+  EXPECT_TRUE(statsA.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+  // Order of the statistics does not matter
+  EXPECT_TRUE(statsB.InsertStatistics("var,rms,min,mean,maxAbs,max"));
+
+  for (int i = 0; i < 100; ++i)
+  {
+    const double value = math::Rand::DblUniform(-5.0, 20.0);
+    stats.InsertData(value);
+    (i % 3 ? statsA : statsB).InsertData(value);
+  }
+  EXPECT_TRUE(statsA.Merge(statsB));
+  EXPECT_EQ(stats.Count(), statsA.Count());
+  auto expected = stats.Map();
+  for (const auto &[name, value] : statsA.Map())
+    EXPECT_NEAR(expected[name], value, 1e-12) << name;
+
+  // Different sets of statistics leave the stats unchanged
+  math::SignalStats fewer;
+  EXPECT_TRUE(fewer.InsertStatistics("max,mean"));
+  fewer.InsertData(100.0);
+  EXPECT_FALSE(statsA.Merge(fewer));
+  EXPECT_FALSE(fewer.Merge(statsA));
+  EXPECT_EQ(stats.Count(), statsA.Count());
+  EXPECT_EQ(1u, fewer.Count());
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalStatsInsertBatch)
+{
+  std::vector<double> data(300000);
+  for (std::size_t i = 0; i < data.size(); ++i)
+    data[i] = 1000.0 + std::sin(0.001 * i) + 0.01 * (i % 7);
+
+  math::SignalStats sequential, batch, parallel;
+  for (auto *stats : {&sequential, &batch, &parallel})
+    EXPECT_TRUE(stats->InsertStatistics("max,maxAbs,mean,min,rms,var"));
+
+  // Previous data is kept
+  for (auto *stats : {&sequential, &batch, &parallel})
+    stats->InsertData(-3.0);
+  for (double value : data)
+    sequential.InsertData(value);
+  batch.InsertData(data.data(), data.size());
+  parallel.InsertData(data.data(), data.size(), 4);
+
+  EXPECT_EQ(sequential.Count(), batch.Count());
+  EXPECT_EQ(sequential.Count(), parallel.Count());
+  auto expected = sequential.Map();
+  EXPECT_EQ(expected, batch.Map());
+  for (const auto &[name, value] : parallel.Map())
+    EXPECT_NEAR(expected[name], value, 1e-9 * std::abs(value)) << name;
+
+  // Nothing to insert
+  parallel.InsertData(nullptr, 0, 4);
+  EXPECT_EQ(sequential.Count(), parallel.Count());
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalQuantile)
+{
+  math::SignalQuantile median;
+  math::SignalQuantile p99(0.99);
+  math::SignalQuantile p999(0.999, 0.001);
+  EXPECT_EQ("p50", median.ShortName());
+  EXPECT_EQ("p99", p99.ShortName());
+  EXPECT_EQ("p99.9", p999.ShortName());
+  EXPECT_DOUBLE_EQ(0.99, p99.Quantile());
+  EXPECT_DOUBLE_EQ(0.0, median.Value());
+
+  // Values 1 to 10000 in a scrambled order
+  for (int i = 0; i < 10000; ++i)
+  {
+    const double value = 1 + (i * 7919) % 10000;
+    for (auto *statistic : {&median, &p99, &p999})
+      statistic->InsertData(value);
+  }
+  EXPECT_EQ(10000u, median.Count());
+  EXPECT_NEAR(5000.5, median.Value(), 0.01 * 5000.5);
+  EXPECT_NEAR(9900.01, p99.Value(), 0.01 * 9900.01);
+  EXPECT_NEAR(9990.001, p999.Value(), 0.001 * 9990.001);
+
+  // Signed values and zeros
+  math::SignalQuantile signedMedian;
+  math::SignalQuantile p10(0.1);
+  for (int i = -100; i <= 100; ++i)
+  {
+    signedMedian.InsertData(i);
+    p10.InsertData(i);
+  }
+  EXPECT_DOUBLE_EQ(0.0, signedMedian.Value());
+  EXPECT_NEAR(-80.0, p10.Value(), 0.8);
+
+  // Reset
+  median.Reset();
+  EXPECT_EQ(0u, median.Count());
+  EXPECT_DOUBLE_EQ(0.0, median.Value());
+  median.InsertData(-3.0);
+  EXPECT_NEAR(-3.0, median.Value(), 0.03);
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalQuantileBoundedMemory)
+{
+  // Values spanning many orders of magnitude collapse the lowest buckets
+  math::SignalQuantile p99(0.99);
+  math::SignalQuantile p1(0.01);
+  math::SignalHistogram histogram(0.01);
+  const int n = 100000;
+  for (int i = 0; i < n; ++i)
+  {
+    const double value = std::pow(10.0, -200.0 + 400.0 * i / (n - 1));
+    p99.InsertData(value);
+    p1.InsertData(value);
+    histogram.InsertData(value);
+  }
+  EXPECT_NEAR(1.0, p99.Value() / std::pow(10.0, 196.0), 0.01);
+
+  // The lowest quantiles lose their accuracy
+  EXPECT_GT(p1.Value(), std::pow(10.0, -196.0) * 1.01);
+
+  const auto buckets = histogram.Buckets();
+  EXPECT_LE(buckets.size(), 2048u);
+  EXPECT_DOUBLE_EQ(0.0, buckets.front().min);
+  uint64_t count = 0;
+  for (const auto &bucket : buckets)
+    count += bucket.count;
+  EXPECT_EQ(static_cast<uint64_t>(n), count);
+
+  // Infinite values are counted, but left out of the buckets
+  histogram.InsertData(std::numeric_limits<double>::infinity());
+  histogram.InsertData(-std::numeric_limits<double>::infinity());
+  EXPECT_EQ(static_cast<std::size_t>(n + 2), histogram.Count());
+  EXPECT_EQ(buckets.size(), histogram.Buckets().size());
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalQuantileOutliers)
+{
+  const double inf = std::numeric_limits<double>::infinity();
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+
+  // NaN and infinite samples do not disturb the estimates
+  math::SignalQuantile median;
+  math::SignalQuantile p99(0.99);
+  math::SignalHistogram histogram;
+  math::SignalStatistic *statistics[] = {&median, &p99, &histogram};
+  for (int i = 1; i <= 1000; ++i)
+  {
+    for (math::SignalStatistic *statistic : statistics)
+    {
+      statistic->InsertData(i);
+      if (i % 100 == 0)
+      {
+        statistic->InsertData(inf);
+        statistic->InsertData(-inf);
+        statistic->InsertData(nan);
+      }
+    }
+  }
+  EXPECT_EQ(1030u, median.Count());
+  EXPECT_NEAR(500.5, median.Value(), 0.01 * 500.5);
+  EXPECT_NEAR(990.01, p99.Value(), 0.01 * 990.01);
+  uint64_t count = 0;
+  for (const auto &bucket : histogram.Buckets())
+  {
+    EXPECT_TRUE(std::isfinite(bucket.min));
+    EXPECT_TRUE(std::isfinite(bucket.max));
+    EXPECT_GT(bucket.min, 0.0);
+    count += bucket.count;
+  }
+  EXPECT_EQ(1000u, count);
+
+  // Only NaN and infinite samples
+  math::SignalQuantile empty;
+  empty.InsertData(nan);
+  empty.InsertData(inf);
+  EXPECT_DOUBLE_EQ(0.0, empty.Value());
+
+  // A large but finite outlier is kept in its own bucket
+  median.InsertData(1e15);
+  p99.InsertData(1e15);
+  math::SignalQuantile p100(1.0);
+  p100.InsertData(1.0);
+  p100.InsertData(1e15);
+  EXPECT_NEAR(500.5, median.Value(), 0.01 * 500.5);
+  EXPECT_NEAR(990.01, p99.Value(), 0.01 * 990.01);
+  EXPECT_NEAR(1e15, p100.Value(), 0.01 * 1e15);
+
+  // An outlier beyond the range of the buckets collapses the others, and
+  // the median is overestimated by orders of magnitude
+  median.InsertData(1e300);
+  EXPECT_GT(median.Value(), 1e280);
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalHistogram)
+{
+  math::SignalHistogram histogram;
+  EXPECT_EQ("hist", histogram.ShortName());
+  EXPECT_TRUE(histogram.Buckets().empty());
+  EXPECT_DOUBLE_EQ(0.0, histogram.Value());
+
+  const std::vector<double> values =
+    {-4.0, -0.5, 0.0, 0.0, 1e-3, 2.0, 2.1, 2.05, 100.0};
+  for (double value : values)
+    histogram.InsertData(value);
+
+  // Buckets are sorted, and each value falls in one of them
+  const auto buckets = histogram.Buckets();
+  ASSERT_EQ(6u, buckets.size());
+  for (std::size_t i = 0; i < buckets.size(); ++i)
+  {
+    EXPECT_LE(buckets[i].min, buckets[i].max);
+    if (i > 0)
+    {
+      EXPECT_LE(buckets[i - 1].max, buckets[i].min * (1 + 1e-12) + 1e-300);
+    }
+  }
+  EXPECT_DOUBLE_EQ(0.0, buckets[2].min);
+  EXPECT_DOUBLE_EQ(0.0, buckets[2].max);
+  EXPECT_EQ(2u, buckets[2].count);
+  for (double value : values)
+  {
+    int found = 0;
+    for (const auto &bucket : buckets)
+    {
+      if (value >= bucket.min * (1 - 1e-12) &&
+          value <= bucket.max * (1 + 1e-12))
+      {
+        ++found;
+      }
+    }
+    EXPECT_GE(found, 1) << value;
+  }
+
+  // The mode is in the bucket of 2.0, 2.05 and 2.1
+  EXPECT_NEAR(2.05, histogram.Value(), 0.1 * 2.05);
+  EXPECT_EQ(3u, buckets[4].count);
+
+  // Reset
+  histogram.Reset();
+  EXPECT_EQ(0u, histogram.Count());
+  EXPECT_TRUE(histogram.Buckets().empty());
+  EXPECT_DOUBLE_EQ(0.0, histogram.Value());
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalQuantileMerge)
+{
+  math::SignalQuantile all(0.95), first(0.95), second(0.95);
+  math::SignalHistogram allHist, firstHist, secondHist;
+  for (int i = 0; i < 5000; ++i)
+  {
+    const double value = math::Rand::DblNormal(0.0, 10.0);
+    all.InsertData(value);
+    allHist.InsertData(value);
+    (i % 2 ? first : second).InsertData(value);
+    (i % 2 ? firstHist : secondHist).InsertData(value);
+  }
+
+  // Bucket counts add up exactly
+  EXPECT_TRUE(first.Merge(second));
+  EXPECT_EQ(all.Count(), first.Count());
+  EXPECT_DOUBLE_EQ(all.Value(), first.Value());
+  EXPECT_TRUE(firstHist.Merge(secondHist));
+  const auto expected = allHist.Buckets();
+  const auto merged = firstHist.Buckets();
+  ASSERT_EQ(expected.size(), merged.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+  {
+    EXPECT_DOUBLE_EQ(expected[i].min, merged[i].min);
+    EXPECT_EQ(expected[i].count, merged[i].count);
+  }
+
+  // Merging with itself doubles the counts
+  math::SignalHistogram selfHist = allHist;
+  EXPECT_TRUE(selfHist.Merge(selfHist));
+  EXPECT_EQ(2 * all.Count(), selfHist.Count());
+  const auto doubled = selfHist.Buckets();
+  ASSERT_EQ(expected.size(), doubled.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(2 * expected[i].count, doubled[i].count);
+
+  // Other quantiles or bucket widths cannot be merged
+  math::SignalQuantile median;
+  EXPECT_TRUE(first.CanMerge(second));
+  EXPECT_FALSE(first.CanMerge(median));
+  EXPECT_FALSE(first.Merge(median));
+  math::SignalQuantile coarse(0.95, 0.1);
+  EXPECT_FALSE(first.CanMerge(coarse));
+  EXPECT_FALSE(first.Merge(coarse));
+  math::SignalHistogram coarseHist(0.2);
+  EXPECT_TRUE(firstHist.CanMerge(secondHist));
+  EXPECT_FALSE(firstHist.CanMerge(coarseHist));
+  EXPECT_FALSE(firstHist.CanMerge(first));
+  EXPECT_EQ(all.Count(), first.Count());
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalStatsQuantiles)
+{
+  math::SignalStats stats;
+  EXPECT_TRUE(stats.InsertStatistics("p50,p99,hist,mean"));
+  EXPECT_FALSE(stats.InsertStatistic("p99.0"));
+  EXPECT_FALSE(stats.InsertStatistic("p101"));
+  EXPECT_FALSE(stats.InsertStatistic("p"));
+  EXPECT_FALSE(stats.InsertStatistic("p5x"));
+  EXPECT_FALSE(stats.InsertStatistic("p-5"));
+  EXPECT_TRUE(stats.InsertStatistic("p99.9"));
+
+  for (int i = 1; i <= 1000; ++i)
+    stats.InsertData(i * 0.001);
+
+  auto map = stats.Map();
+  EXPECT_EQ(5u, map.size());
+  EXPECT_NEAR(0.5, map["p50"], 0.01 * 0.5);
+  EXPECT_NEAR(0.99, map["p99"], 0.01 * 0.99);
+  EXPECT_NEAR(0.999, map["p99.9"], 0.01 * 0.999);
+  EXPECT_EQ(1u, map.count("hist"));
+
+  EXPECT_EQ(nullptr, stats.Statistic("var"));
+  auto histogram =
+    dynamic_cast<const math::SignalHistogram *>(stats.Statistic("hist"));
+  ASSERT_NE(nullptr, histogram);
+  EXPECT_EQ(1000u, histogram->Count());
+  EXPECT_FALSE(histogram->Buckets().empty());
+
+  // Quantiles are merged by the parallel insertion
+  std::vector<double> data(200000);
+  for (std::size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<double>((i * 7919) % data.size());
+  math::SignalStats sequential, parallel;
+  EXPECT_TRUE(sequential.InsertStatistics("p50,p99,hist"));
+  EXPECT_TRUE(parallel.InsertStatistics("p50,p99,hist"));
+  sequential.InsertData(data.data(), data.size());
+  parallel.InsertData(data.data(), data.size(), 3);
+  EXPECT_EQ(sequential.Map(), parallel.Map());
+}
@@ -14,12 +14,18 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include "gz/math/Matrix3.hh"
 #include "gz/math/SphericalCoordinates.hh"
 #include "gz/math/detail/Error.hh"
+#include "gz/math/detail/ParallelFor.hh"
 
 using namespace gz;
 using namespace math;
@@ -55,6 +61,319 @@ const double g_MoonAxisPolar = 1736000.0;
 // Source : https://nssdc.gsfc.nasa.gov/planetary/factsheet/moonfact.html
 const double g_MoonFlattening = 0.0012;
 
+namespace
+{
+/// \brief Check that a coordinate type is one of the known values.
+/// \param[in] _type Coordinate type to check.
+/// \return True if valid, otherwise logs an error and returns false.
+bool ValidCoordinateType(SphericalCoordinates::CoordinateType _type)
+{
+  switch (_type)
+  {
+    case SphericalCoordinates::SPHERICAL:
+    case SphericalCoordinates::ECEF:
+    case SphericalCoordinates::GLOBAL:
+    case SphericalCoordinates::LOCAL:
+      return true;
+    default:
+      {
+        std::ostringstream errStream;
+        errStream << "Unknown coordinate type[" << _type << "]";
+        detail::LogErrorMessage(errStream.str());
+        return false;
+      }
+  }
+}
+
+/// \brief Largest radius of the local approximation, in meters.
+constexpr double kMaxApproximationRadius = 1e5;
+
+/// \brief Step used to fit the local approximation, in meters.
+constexpr double kApproximationStep = 100.0;
+
+/// \brief Second-order expansion of a map from R^3 to R^3 around the
+/// origin.
+class QuadraticMap
+{
+  /// \brief Value at the origin.
+  public: Vector3d value;
+
+  /// \brief First derivatives, jacobian(k, i) = d f_k / d x_i.
+  public: Matrix3d jacobian;
+
+  /// \brief Second derivatives of each component of the map.
+  public: std::array<Matrix3d, 3> hessian;
+
+  /// \brief Evaluate the expansion.
+  /// \param[in] _x Offset from the origin.
+  /// \return Approximate value of the map at _x.
+  public: Vector3d Evaluate(const Vector3d &_x) const
+  {
+    return this->value + this->jacobian * _x + 0.5 * Vector3d(
+        _x.Dot(this->hessian[0] * _x),
+        _x.Dot(this->hessian[1] * _x),
+        _x.Dot(this->hessian[2] * _x));
+  }
+
+  /// \brief Fit the expansion of a map with central differences.
+  /// \param[in] _f Map to expand, Vector3d(const Vector3d &).
+  /// \param[in] _step Finite difference step.
+  /// \return The fitted expansion.
+  public: template<typename F>
+  static QuadraticMap Fit(F _f, double _step)
+  {
+    QuadraticMap map;
+    map.value = _f(Vector3d::Zero);
+
+    std::array<Vector3d, 3> axes;
+    std::array<Vector3d, 3> plus;
+    std::array<Vector3d, 3> minus;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      axes[i] = Vector3d::Zero;
+      axes[i][i] = _step;
+      plus[i] = _f(axes[i]);
+      minus[i] = _f(-axes[i]);
+    }
+
+    const double step2 = _step * _step;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      const Vector3d first = (plus[i] - minus[i]) / (2.0 * _step);
+      const Vector3d second = (plus[i] - 2.0 * map.value + minus[i]) / step2;
+      for (std::size_t k = 0; k < 3; ++k)
+      {
+        map.jacobian(k, i) = first[k];
+        map.hessian[k](i, i) = second[k];
+      }
+
+      for (std::size_t j = i + 1; j < 3; ++j)
+      {
+        const Vector3d mixed = (_f(axes[i] + axes[j]) -
+            _f(axes[i] - axes[j]) - _f(axes[j] - axes[i]) +
+            _f(-axes[i] - axes[j])) / (4.0 * step2);
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+          map.hessian[k](i, j) = mixed[k];
+          map.hessian[k](j, i) = mixed[k];
+        }
+      }
+    }
+    return map;
+  }
+};
+
+/// \brief Trigonometric functions of a point at sea level, computed once
+/// per point for batch distances.
+class DistancePoint
+{
+  /// \brief Unit vector from the planet center to the point on a sphere.
+  public: Vector3d normal;
+
+  /// \brief Sine of the reduced latitude on the ellipsoid.
+  public: double sinU = 0;
+
+  /// \brief Cosine of the reduced latitude on the ellipsoid.
+  public: double cosU = 0;
+
+  /// \brief Longitude in radians.
+  public: double lon = 0;
+
+  /// \brief Constructor.
+  /// \param[in] _latLon Latitude and longitude in radians.
+  /// \param[in] _flattening Flattening of the ellipsoid.
+  public: DistancePoint(const Vector2d &_latLon, double _flattening)
+    : lon(_latLon.Y())
+  {
+    const double sinLat = sin(_latLon.X());
+    const double cosLat = cos(_latLon.X());
+    this->normal.Set(cosLat * cos(this->lon), cosLat * sin(this->lon),
+                     sinLat);
+
+    // tan(U) = (1 - f) tan(lat)
+    const double reducedSin = (1.0 - _flattening) * sinLat;
+    const double norm = sqrt(reducedSin * reducedSin + cosLat * cosLat);
+    this->sinU = reducedSin / norm;
+    this->cosU = cosLat / norm;
+  }
+
+  /// \brief Default constructor.
+  public: DistancePoint() = default;
+};
+
+/// \brief Get the great circle distance between two points.
+/// \param[in] _a First point.
+/// \param[in] _b Second point.
+/// \param[in] _radius Radius of the sphere.
+/// \return Distance in meters.
+double GreatCircleDistance(const DistancePoint &_a, const DistancePoint &_b,
+                           double _radius)
+{
+  // Half the chord between both points is the sine of half the central
+  // angle, which is as accurate as the haversine for close points and
+  // needs no trigonometric functions of the coordinates.
+  const double halfChord = 0.5 * (_a.normal - _b.normal).Length();
+  return 2.0 * _radius * asin(std::min(halfChord, 1.0));
+}
+
+/// \brief Get the geodesic distance between two points on an ellipsoid
+/// with Vincenty's inverse formula, see T. Vincenty, "Direct and inverse
+/// solutions of geodesics on the ellipsoid with application of nested
+/// equations", Survey Review (1975) 23: 88-93.
+/// \param[in] _a First point.
+/// \param[in] _b Second point.
+/// \param[in] _axisEquatorial Semi-major axis of the ellipsoid.
+/// \param[in] _axisPolar Semi-minor axis of the ellipsoid.
+/// \param[in] _radius Radius of the sphere used for nearly antipodal
+/// points, for which the iteration does not converge.
+/// \return Distance in meters.
+double VincentyDistance(const DistancePoint &_a, const DistancePoint &_b,
+                        double _axisEquatorial, double _axisPolar,
+                        double _radius)
+{
+  const double f = (_axisEquatorial - _axisPolar) / _axisEquatorial;
+  const double lonDiff = _b.lon - _a.lon;
+  double lambda = lonDiff;
+  double sinSigma = 0;
+  double cosSigma = 0;
+  double sigma = 0;
+  double cos2Alpha = 0;
+  double cos2SigmaM = 0;
+  bool converged = false;
+  for (int i = 0; i < 100 && !converged; ++i)
+  {
+    const double sinLambda = sin(lambda);
+    const double cosLambda = cos(lambda);
+    const double t0 = _b.cosU * sinLambda;
+    const double t1 = _a.cosU * _b.sinU - _a.sinU * _b.cosU * cosLambda;
+    sinSigma = sqrt(t0 * t0 + t1 * t1);
+    cosSigma = _a.sinU * _b.sinU + _a.cosU * _b.cosU * cosLambda;
+    if (!(sinSigma > 0))
+    {
+      // Coincident or exactly antipodal points
+      if (cosSigma > 0)
+        return 0.0;
+      break;
+    }
+    sigma = atan2(sinSigma, cosSigma);
+
+    const double sinAlpha = _a.cosU * _b.cosU * sinLambda / sinSigma;
+    cos2Alpha = 1.0 - sinAlpha * sinAlpha;
+    // Both points on the equator
+    cos2SigmaM = cos2Alpha > 0 ?
+      cosSigma - 2.0 * _a.sinU * _b.sinU / cos2Alpha : 0.0;
+
+    const double c = f / 16.0 * cos2Alpha * (4.0 + f * (4.0 - 3.0 * cos2Alpha));
+    const double previous = lambda;
+    lambda = lonDiff + (1.0 - c) * f * sinAlpha * (sigma + c * sinSigma *
+        (cos2SigmaM + c * cosSigma * (-1.0 + 2.0 * cos2SigmaM * cos2SigmaM)));
+    converged = std::abs(lambda - previous) < 1e-12;
+  }
+  if (!converged)
+    return GreatCircleDistance(_a, _b, _radius);
+
+  const double b2 = _axisPolar * _axisPolar;
+  const double u2 =
+    cos2Alpha * (_axisEquatorial * _axisEquatorial - b2) / b2;
+  const double a = 1.0 + u2 / 16384.0 *
+    (4096.0 + u2 * (-768.0 + u2 * (320.0 - 175.0 * u2)));
+  const double b = u2 / 1024.0 *
+    (256.0 + u2 * (-128.0 + u2 * (74.0 - 47.0 * u2)));
+  const double cos2SigmaM2 = cos2SigmaM * cos2SigmaM;
+  const double deltaSigma = b * sinSigma * (cos2SigmaM + b / 4.0 *
+      (cosSigma * (-1.0 + 2.0 * cos2SigmaM2) - b / 6.0 * cos2SigmaM *
+       (-3.0 + 4.0 * sinSigma * sinSigma) * (-3.0 + 4.0 * cos2SigmaM2)));
+  return _axisPolar * a * (sigma - deltaSigma);
+}
+
+/// \brief Compute the distances between all pairs of two sets of points.
+/// \param[in] _from First set of points, latitude and longitude.
+/// \param[in] _to Second set of points, latitude and longitude.
+/// \param[out] _distances Row major distances.
+/// \param[in] _method Distance method.
+/// \param[in] _radius Radius of the sphere for HAVERSINE.
+/// \param[in] _axisEquatorial Semi-major axis of the ellipsoid.
+/// \param[in] _axisPolar Semi-minor axis of the ellipsoid.
+/// \param[in] _threads Number of threads to use, 0 for one per core.
+/// \return False if _method is unknown.
+bool BatchDistances(const std::vector<Vector2d> &_from,
+                    const std::vector<Vector2d> &_to,
+                    std::vector<double> &_distances,
+                    SphericalCoordinates::DistanceMethod _method,
+                    double _radius, double _axisEquatorial,
+                    double _axisPolar, unsigned int _threads)
+{
+  if (_method != SphericalCoordinates::HAVERSINE &&
+      _method != SphericalCoordinates::VINCENTY)
+  {
+    std::ostringstream errStream;
+    errStream << "Unknown distance method[" << _method << "]";
+    detail::LogErrorMessage(errStream.str());
+    return false;
+  }
+
+  // Trigonometric functions are computed once per point rather than once
+  // per pair.
+  const double flattening = (_axisEquatorial - _axisPolar) / _axisEquatorial;
+  auto prepare = [&](const std::vector<Vector2d> &_points)
+  {
+    std::vector<DistancePoint> points(_points.size());
+    detail::ParallelFor(_points.size(), detail::ThreadCount(
+          _threads, _points.size()),
+      [&](std::size_t _begin, std::size_t _end, unsigned int)
+      {
+        for (std::size_t i = _begin; i < _end; ++i)
+          points[i] = DistancePoint(_points[i], flattening);
+      });
+    return points;
+  };
+  const std::vector<DistancePoint> from = prepare(_from);
+  const std::vector<DistancePoint> to = prepare(_to);
+
+  const std::size_t columns = to.size();
+  const std::size_t count = from.size() * columns;
+  _distances.resize(count);
+  if (count == 0)
+    return true;
+  const unsigned int threads =
+    detail::ThreadCount(_threads, count);
+  auto forEachPair = [&](auto _distance)
+  {
+    detail::ParallelFor(count, threads,
+      [&](std::size_t _begin, std::size_t _end, unsigned int)
+      {
+        // Walk the rows overlapping [_begin, _end)
+        std::size_t row = _begin / columns;
+        std::size_t col = _begin % columns;
+        for (std::size_t k = _begin; k < _end; ++row, col = 0)
+        {
+          const DistancePoint &a = from[row];
+          const std::size_t rowEnd = std::min(_end, k + columns - col);
+          for (; k < rowEnd; ++k, ++col)
+            _distances[k] = _distance(a, to[col]);
+        }
+      });
+  };
+
+  if (_method == SphericalCoordinates::VINCENTY)
+  {
+    forEachPair([&](const DistancePoint &_a, const DistancePoint &_b)
+      {
+        return VincentyDistance(_a, _b, _axisEquatorial, _axisPolar,
+                                _radius);
+      });
+  }
+  else
+  {
+    forEachPair([&](const DistancePoint &_a, const DistancePoint &_b)
+      {
+        return GreatCircleDistance(_a, _b, _radius);
+      });
+  }
+  return true;
+}
+}  // namespace
+
 // Private data for the SphericalCoordinates class.
 class gz::math::SphericalCoordinates::Implementation
 {
@@ -106,6 +425,491 @@ class gz::math::SphericalCoordinates::Implementation
 
   /// \brief Cache sine head transform
   public: double sinHea;
+
+  /// \brief Method used to convert ECEF positions to geodetic coordinates
+  public: SphericalCoordinates::GeodeticMethod geodeticMethod =
+    SphericalCoordinates::BOWRING;
+
+  /// \brief Maximum position error of the local approximation, 0 if it is
+  /// disabled.
+  public: double approximationTolerance = 0;
+
+  /// \brief Radius around the reference point within which the local
+  /// approximation is used, 0 if it is disabled.
+  public: double approximationRadius = 0;
+
+  /// \brief Local approximation of GLOBAL positions to spherical offsets.
+  /// \sa SphericalOffset
+  public: QuadraticMap globalToSpherical;
+
+  /// \brief Local approximation of spherical offsets to GLOBAL positions.
+  public: QuadraticMap sphericalToGlobal;
+
+  /// \brief Scale from latitude and longitude offsets in radians to
+  /// meters at the reference point.
+  public: Vector3d sphericalScale;
+
+  /// \brief Get the rotation and translation that take positions in a
+  /// Cartesian frame to ECEF, i.e. ecef = _rot * pos + _trans.
+  /// \param[in] _type Cartesian frame: ECEF, GLOBAL or LOCAL.
+  /// \param[out] _rot Rotation from the frame to ECEF.
+  /// \param[out] _trans ECEF position of the frame origin.
+  /// \return False if _type is not a Cartesian frame.
+  public: bool CartesianToECEF(SphericalCoordinates::CoordinateType _type,
+                               Matrix3d &_rot, Vector3d &_trans) const
+  {
+    switch (_type)
+    {
+      case SphericalCoordinates::LOCAL:
+        // Heading rotation from LOCAL to GLOBAL, see PositionTransform
+        _rot = this->rotGlobalToECEF * Matrix3d(
+            this->cosHea, this->sinHea, 0,
+            -this->sinHea, this->cosHea, 0,
+            0, 0, 1);
+        _trans = *this->origin.AsMetricVector();
+        return true;
+      case SphericalCoordinates::GLOBAL:
+        _rot = this->rotGlobalToECEF;
+        _trans = *this->origin.AsMetricVector();
+        return true;
+      case SphericalCoordinates::ECEF:
+        _rot = Matrix3d::Identity;
+        _trans = Vector3d::Zero;
+        return true;
+      case SphericalCoordinates::SPHERICAL:
+      default:
+        return false;
+    }
+  }
+
+  /// \brief Convert a geodetic position to ECEF.
+  /// \param[in] _lat Latitude in radians.
+  /// \param[in] _lon Longitude in radians.
+  /// \param[in] _ele Elevation in meters.
+  /// \return ECEF position.
+  public: Vector3d SphericalToECEF(double _lat, double _lon, double _ele) const
+  {
+    // Cache trig results
+    const double cosLat = cos(_lat);
+    const double sinLat = sin(_lat);
+    const double cosLon = cos(_lon);
+    const double sinLon = sin(_lon);
+
+    // Radius of planet curvature (meters)
+    double curvature = 1.0 - this->ellE * this->ellE * sinLat * sinLat;
+    curvature = this->ellA / sqrt(curvature);
+
+    return Vector3d(
+        (_ele + curvature) * cosLat * cosLon,
+        (_ele + curvature) * cosLat * sinLon,
+        ((this->ellB * this->ellB) / (this->ellA * this->ellA) *
+         curvature + _ele) * sinLat);
+  }
+
+  /// \brief Convert an ECEF position to geodetic coordinates with one
+  /// step of Bowring's method.
+  /// \param[in] _ecef ECEF position.
+  /// \return Latitude and longitude in radians, and elevation in meters.
+  public: Vector3d ECEFToSphericalBowring(const Vector3d &_ecef) const
+  {
+    double p = sqrt(_ecef.X() * _ecef.X() + _ecef.Y() * _ecef.Y());
+    double lon = atan2(_ecef.Y(), _ecef.X());
+
+    // On the polar axis the formulas below divide zero by zero.
+    if (!(p > 0))
+    {
+      return Vector3d(std::copysign(GZ_PI / 2, _ecef.Z()), lon,
+                      std::abs(_ecef.Z()) - this->ellB);
+    }
+
+    double theta = atan((_ecef.Z() * this->ellA) / (p * this->ellB));
+
+    // Calculate latitude and longitude
+    double lat = atan(
+        (_ecef.Z() + std::pow(this->ellP, 2) * this->ellB *
+         std::pow(sin(theta), 3)) /
+        (p - std::pow(this->ellE, 2) *
+         this->ellA * std::pow(cos(theta), 3)));
+
+    // Recalculate radius of planet curvature at the current latitude.
+    const double sinLat = sin(lat);
+    const double cosLat = cos(lat);
+    double nCurvature = 1.0 - std::pow(this->ellE, 2) * sinLat * sinLat;
+    nCurvature = this->ellA / sqrt(nCurvature);
+
+    // Close to the poles p / cos(lat) divides two tiny numbers, so the
+    // elevation is computed from z above 45 degrees of latitude.
+    if (cosLat >= std::abs(sinLat))
+      return Vector3d(lat, lon, p / cosLat - nCurvature);
+    return Vector3d(lat, lon, _ecef.Z() / sinLat -
+                    nCurvature * (1.0 - std::pow(this->ellE, 2)));
+  }
+
+  /// \brief Convert an ECEF position to geodetic coordinates with one
+  /// step of Bowring's method, with the trigonometric functions of the
+  /// intermediate angles computed from their tangents. The elevation uses
+  /// a formula that also holds at the poles.
+  /// \param[in] _ecef ECEF position.
+  /// \return Latitude and longitude in radians, and elevation in meters.
+  public: Vector3d ECEFToSphericalFastBowring(const Vector3d &_ecef) const
+  {
+    const double p = sqrt(_ecef.X() * _ecef.X() + _ecef.Y() * _ecef.Y());
+
+    // Parametric latitude theta, tan(theta) = z a / (p b)
+    const double thetaSin = _ecef.Z() * this->ellA;
+    const double thetaCos = p * this->ellB;
+    const double thetaNorm =
+      sqrt(thetaSin * thetaSin + thetaCos * thetaCos);
+    const double sinTheta = thetaSin / thetaNorm;
+    const double cosTheta = thetaCos / thetaNorm;
+
+    const double latSin = _ecef.Z() + this->ellP * this->ellP * this->ellB *
+      sinTheta * sinTheta * sinTheta;
+    const double latCos = p - this->ellE * this->ellE * this->ellA *
+      cosTheta * cosTheta * cosTheta;
+    const double latNorm = sqrt(latSin * latSin + latCos * latCos);
+    const double sinLat = latSin / latNorm;
+    const double cosLat = latCos / latNorm;
+
+    // h = p cos(lat) + z sin(lat) - a^2 / N
+    const double elevation = p * cosLat + _ecef.Z() * sinLat -
+      this->ellA * sqrt(1.0 - this->ellE * this->ellE * sinLat * sinLat);
+
+    return Vector3d(atan2(latSin, latCos), atan2(_ecef.Y(), _ecef.X()),
+                    elevation);
+  }
+
+  /// \brief Convert an ECEF position to geodetic coordinates with
+  /// Vermeille's closed form, see H. Vermeille, "Direct transformation from
+  /// geocentric coordinates to geodetic coordinates", Journal of Geodesy
+  /// (2002) 76: 451-454.
+  /// \param[in] _ecef ECEF position.
+  /// \return Latitude and longitude in radians, and elevation in meters.
+  public: Vector3d ECEFToSphericalVermeille(const Vector3d &_ecef) const
+  {
+    const double e2 = this->ellE * this->ellE;
+    const double e4 = e2 * e2;
+    const double w2 = _ecef.X() * _ecef.X() + _ecef.Y() * _ecef.Y();
+    const double p = w2 / (this->ellA * this->ellA);
+    const double q = (1.0 - e2) / (this->ellA * this->ellA) *
+      _ecef.Z() * _ecef.Z();
+    const double r = (p + q - e4) / 6.0;
+    // The closed form does not hold within about e^2 a of the center.
+    if (!(r > 0.0))
+      return this->ECEFToSphericalFastBowring(_ecef);
+
+    const double s = e4 * p * q / (4.0 * r * r * r);
+    const double t = std::cbrt(1.0 + s + sqrt(s * (2.0 + s)));
+    const double u = r * (1.0 + t + 1.0 / t);
+    const double v = sqrt(u * u + e4 * q);
+    const double w = e2 * (u + v - q) / (2.0 * v);
+    const double k = sqrt(u + v + w * w) - w;
+    const double d = k * sqrt(w2) / (k + e2);
+    const double dz = sqrt(d * d + _ecef.Z() * _ecef.Z());
+
+    return Vector3d(2.0 * atan2(_ecef.Z(), d + dz),
+                    atan2(_ecef.Y(), _ecef.X()),
+                    (k + e2 - 1.0) / k * dz);
+  }
+
+  /// \brief Convert an ECEF position to geodetic coordinates with the
+  /// selected method.
+  /// \param[in] _ecef ECEF position.
+  /// \return Latitude and longitude in radians, and elevation in meters.
+  public: Vector3d ECEFToSpherical(const Vector3d &_ecef) const
+  {
+    switch (this->geodeticMethod)
+    {
+      case SphericalCoordinates::FAST_BOWRING:
+        return this->ECEFToSphericalFastBowring(_ecef);
+      case SphericalCoordinates::VERMEILLE:
+        return this->ECEFToSphericalVermeille(_ecef);
+      case SphericalCoordinates::BOWRING:
+      default:
+        return this->ECEFToSphericalBowring(_ecef);
+    }
+  }
+
+  /// \brief Get the offset of a geodetic position from the reference
+  /// point, in meters along each geodetic coordinate at the reference.
+  /// \param[in] _latLonEle Latitude and longitude in radians, and
+  /// elevation in meters.
+  /// \return Latitude, longitude and elevation offsets in meters.
+  public: Vector3d SphericalOffset(const Vector3d &_latLonEle) const
+  {
+    double dLon = _latLonEle.Y() - this->longitudeReference.Radian();
+    if (dLon > GZ_PI)
+      dLon -= 2 * GZ_PI;
+    else if (dLon <= -GZ_PI)
+      dLon += 2 * GZ_PI;
+
+    return Vector3d(
+        (_latLonEle.X() - this->latitudeReference.Radian()) *
+          this->sphericalScale.X(),
+        dLon * this->sphericalScale.Y(),
+        _latLonEle.Z() - this->elevationReference);
+  }
+
+  /// \brief Inverse of SphericalOffset.
+  /// \param[in] _offset Latitude, longitude and elevation offsets in
+  /// meters.
+  /// \return Latitude and longitude in radians, with the longitude in
+  /// (-pi, pi], and elevation in meters.
+  public: Vector3d SphericalFromOffset(const Vector3d &_offset) const
+  {
+    double lon = this->longitudeReference.Radian() +
+      _offset.Y() / this->sphericalScale.Y();
+    if (lon > GZ_PI)
+      lon -= 2 * GZ_PI;
+    else if (lon <= -GZ_PI)
+      lon += 2 * GZ_PI;
+
+    return Vector3d(
+        this->latitudeReference.Radian() +
+          _offset.X() / this->sphericalScale.X(),
+        lon,
+        this->elevationReference + _offset.Z());
+  }
+
+  /// \brief Fit the local approximation around the current reference
+  /// point and estimate the radius within which it meets the tolerance.
+  public: void UpdateLocalApproximation()
+  {
+    if (!(this->approximationTolerance > 0))
+      return;
+
+    // Keep the longitude scale finite at the poles, where the fit
+    // degrades and the radius shrinks accordingly.
+    const double cosLat = std::max(
+        std::abs(cos(this->latitudeReference.Radian())), 1e-9);
+    this->sphericalScale.Set(this->ellA, this->ellA * cosLat, 1.0);
+
+    const Vector3d originECEF = *this->origin.AsMetricVector();
+    auto exactToSpherical = [&](const Vector3d &_global)
+    {
+      return this->SphericalOffset(this->ECEFToSphericalVermeille(
+          originECEF + this->rotGlobalToECEF * _global));
+    };
+    auto exactToGlobal = [&](const Vector3d &_offset)
+    {
+      const Vector3d latLonEle = this->SphericalFromOffset(_offset);
+      return this->rotECEFToGlobal * (this->SphericalToECEF(
+          latLonEle.X(), latLonEle.Y(), latLonEle.Z()) - originECEF);
+    };
+    this->globalToSpherical =
+      QuadraticMap::Fit(exactToSpherical, kApproximationStep);
+    this->sphericalToGlobal =
+      QuadraticMap::Fit(exactToGlobal, kApproximationStep);
+
+    // Largest error of both maps over the directions to the faces, edges
+    // and corners of a cube.
+    auto maxError = [&](double _radius)
+    {
+      double error = 0;
+      for (int x = -1; x <= 1; ++x)
+      {
+        for (int y = -1; y <= 1; ++y)
+        {
+          for (int z = -1; z <= 1; ++z)
+          {
+            if (x == 0 && y == 0 && z == 0)
+              continue;
+            const Vector3d global = Vector3d(x, y, z).Normalized() * _radius;
+            const Vector3d offset = exactToSpherical(global);
+            error = std::max(error, (this->globalToSpherical.Evaluate(
+                global) - offset).Length());
+            error = std::max(error, (this->sphericalToGlobal.Evaluate(
+                offset) - global).Length());
+          }
+        }
+      }
+      return error;
+    };
+
+    // The error of a quadratic expansion grows with the cube of the
+    // distance. Aim at half the tolerance to cover the directions that
+    // are not sampled.
+    const double target = 0.5 * this->approximationTolerance;
+    const double sampleRadius = 1000.0;
+    const double sampleError = maxError(sampleRadius);
+    double radius = kMaxApproximationRadius;
+    if (sampleError > 0)
+    {
+      radius = std::min(radius,
+          sampleRadius * std::cbrt(target / sampleError));
+    }
+    while (radius >= 1.0 && !(maxError(radius) <= target))
+      radius *= 0.8;
+    this->approximationRadius = radius >= 1.0 ? radius : 0.0;
+  }
+
+  /// \brief Transform a position with the local approximation.
+  /// \param[in] _pos Position in the frame defined by parameter _in.
+  /// SPHERICAL positions are (latitude, longitude, elevation), with angles
+  /// in radians.
+  /// \param[in] _in CoordinateType for input.
+  /// \param[in] _out CoordinateType for output.
+  /// \param[out] _result Transformed position. It may be the same vector
+  /// as _pos.
+  /// \return False if the approximation is disabled, does not apply to
+  /// these frames, or the position is out of its radius.
+  public: bool LocalApproximation(const Vector3d &_pos,
+                                  SphericalCoordinates::CoordinateType _in,
+                                  SphericalCoordinates::CoordinateType _out,
+                                  Vector3d &_result) const
+  {
+    const double radius2 = this->approximationRadius *
+      this->approximationRadius;
+    if (_in == SphericalCoordinates::SPHERICAL &&
+        (_out == SphericalCoordinates::LOCAL ||
+         _out == SphericalCoordinates::GLOBAL))
+    {
+      const Vector3d global =
+        this->sphericalToGlobal.Evaluate(this->SphericalOffset(_pos));
+      if (!(global.SquaredLength() <= radius2))
+        return false;
+
+      if (_out == SphericalCoordinates::LOCAL)
+      {
+        _result.Set(
+            global.X() * this->cosHea - global.Y() * this->sinHea,
+            global.X() * this->sinHea + global.Y() * this->cosHea,
+            global.Z());
+      }
+      else
+      {
+        _result = global;
+      }
+      return true;
+    }
+
+    if (_out == SphericalCoordinates::SPHERICAL &&
+        (_in == SphericalCoordinates::LOCAL ||
+         _in == SphericalCoordinates::GLOBAL))
+    {
+      // The heading rotation preserves the distance to the reference.
+      if (!(_pos.SquaredLength() <= radius2))
+        return false;
+
+      Vector3d global = _pos;
+      if (_in == SphericalCoordinates::LOCAL)
+      {
+        global.Set(
+            _pos.X() * this->cosHea + _pos.Y() * this->sinHea,
+            -_pos.X() * this->sinHea + _pos.Y() * this->cosHea,
+            _pos.Z());
+      }
+      _result = this->SphericalFromOffset(
+          this->globalToSpherical.Evaluate(global));
+      return true;
+    }
+    return false;
+  }
+
+  /// \brief Convert many positions between frames.
+  /// \see SphericalCoordinates::PositionTransform
+  /// \tparam T Scalar type of the positions, computations are done in
+  /// double precision in any case.
+  template<typename T>
+  bool PositionTransform(
+      const std::vector<Vector3<T>> &_pos, std::vector<Vector3<T>> &_result,
+      SphericalCoordinates::CoordinateType _in,
+      SphericalCoordinates::CoordinateType _out,
+      unsigned int _threads) const
+  {
+    if (!ValidCoordinateType(_in) || !ValidCoordinateType(_out))
+      return false;
+
+    // Spherical positions go through ECEF, everything else is related by
+    // a single affine map: out = rot * in + trans.
+    Matrix3d inRot, outRot;
+    Vector3d inTrans, outTrans;
+    this->CartesianToECEF(
+        _in == SphericalCoordinates::SPHERICAL ?
+          SphericalCoordinates::ECEF : _in, inRot, inTrans);
+    this->CartesianToECEF(
+        _out == SphericalCoordinates::SPHERICAL ?
+          SphericalCoordinates::ECEF : _out, outRot, outTrans);
+    outRot = outRot.Transposed();
+    const Matrix3d rot = outRot * inRot;
+    const Vector3d trans = outRot * (inTrans - outTrans);
+
+    _result.resize(_pos.size());
+    const unsigned int threads = detail::ThreadCount(
+        _threads, _pos.size());
+    const bool approximate = this->approximationRadius > 0;
+    // Instantiate the loop for each combination of spherical input and
+    // output method, so that it does not branch per point.
+    auto transform = [&](auto _fromSpherical, auto _toSpherical)
+    {
+      detail::ParallelFor(_pos.size(), threads,
+        [&](std::size_t _begin, std::size_t _end, unsigned int)
+        {
+          for (std::size_t i = _begin; i < _end; ++i)
+          {
+            Vector3d p(_pos[i].X(), _pos[i].Y(), _pos[i].Z());
+            if (approximate && this->LocalApproximation(p, _in, _out, p))
+            {
+              _result[i].Set(static_cast<T>(p.X()), static_cast<T>(p.Y()),
+                             static_cast<T>(p.Z()));
+              continue;
+            }
+            if constexpr (decltype(_fromSpherical)::value)
+              p = this->SphericalToECEF(p.X(), p.Y(), p.Z());
+            p = rot * p + trans;
+            if constexpr (!std::is_same_v<decltype(_toSpherical),
+                                          std::false_type>)
+            {
+              p = _toSpherical(p);
+            }
+            _result[i].Set(static_cast<T>(p.X()), static_cast<T>(p.Y()),
+                           static_cast<T>(p.Z()));
+          }
+        });
+    };
+    auto toSpherical = [&](auto _fromSpherical)
+    {
+      switch (this->geodeticMethod)
+      {
+        case SphericalCoordinates::FAST_BOWRING:
+          transform(_fromSpherical, [this](const Vector3d &_p)
+            {
+              return this->ECEFToSphericalFastBowring(_p);
+            });
+          break;
+        case SphericalCoordinates::VERMEILLE:
+          transform(_fromSpherical, [this](const Vector3d &_p)
+            {
+              return this->ECEFToSphericalVermeille(_p);
+            });
+          break;
+        case SphericalCoordinates::BOWRING:
+        default:
+          transform(_fromSpherical, [this](const Vector3d &_p)
+            {
+              return this->ECEFToSphericalBowring(_p);
+            });
+          break;
+      }
+    };
+
+    const bool fromSpherical = _in == SphericalCoordinates::SPHERICAL;
+    if (_out == SphericalCoordinates::SPHERICAL)
+    {
+      if (fromSpherical)
+        toSpherical(std::true_type());
+      else
+        toSpherical(std::false_type());
+    }
+    else
+    {
+      if (fromSpherical)
+        transform(std::true_type(), std::false_type());
+      else
+        transform(std::false_type(), std::false_type());
+    }
+    return true;
+  }
 };
 
 //////////////////////////////////////////////////
@@ -297,6 +1101,8 @@ void SphericalCoordinates::SetSurface(const SurfaceType &_type)
       break;
       }
   }
+
+  this->dataPtr->UpdateLocalApproximation();
 }
 
 //////////////////////////////////////////////////
@@ -345,6 +1151,8 @@ void SphericalCoordinates::SetSurface(
   this->dataPtr->ellP = sqrt(
       std::pow(this->dataPtr->ellA, 2) / std::pow(this->dataPtr->ellB, 2) -
       1.0);
+
+  this->dataPtr->UpdateLocalApproximation();
 }
 
 //////////////////////////////////////////////////
@@ -449,6 +1257,48 @@ double SphericalCoordinates::DistanceBetweenPoints(
   return d;
 }
 
+//////////////////////////////////////////////////
+bool SphericalCoordinates::DistanceWGS84(
+    const Vector2d &_from, const std::vector<Vector2d> &_to,
+    std::vector<double> &_distances, DistanceMethod _method,
+    unsigned int _threads)
+{
+  return BatchDistances({_from}, _to, _distances, _method, g_EarthRadius,
+      g_EarthWGS84AxisEquatorial, g_EarthWGS84AxisPolar, _threads);
+}
+
+//////////////////////////////////////////////////
+bool SphericalCoordinates::DistanceWGS84(
+    const std::vector<Vector2d> &_from, const std::vector<Vector2d> &_to,
+    std::vector<double> &_distances, DistanceMethod _method,
+    unsigned int _threads)
+{
+  return BatchDistances(_from, _to, _distances, _method, g_EarthRadius,
+      g_EarthWGS84AxisEquatorial, g_EarthWGS84AxisPolar, _threads);
+}
+
+//////////////////////////////////////////////////
+bool SphericalCoordinates::DistanceBetweenPoints(
+    const Vector2d &_from, const std::vector<Vector2d> &_to,
+    std::vector<double> &_distances, DistanceMethod _method,
+    unsigned int _threads) const
+{
+  return BatchDistances({_from}, _to, _distances, _method,
+      this->dataPtr->surfaceRadius, this->dataPtr->ellA, this->dataPtr->ellB,
+      _threads);
+}
+
+//////////////////////////////////////////////////
+bool SphericalCoordinates::DistanceBetweenPoints(
+    const std::vector<Vector2d> &_from, const std::vector<Vector2d> &_to,
+    std::vector<double> &_distances, DistanceMethod _method,
+    unsigned int _threads) const
+{
+  return BatchDistances(_from, _to, _distances, _method,
+      this->dataPtr->surfaceRadius, this->dataPtr->ellA, this->dataPtr->ellB,
+      _threads);
+}
+
 //////////////////////////////////////////////////
 double SphericalCoordinates::SurfaceRadius() const
 {
@@ -467,6 +1317,62 @@ double SphericalCoordinates::SurfaceAxisPolar() const
   return this->dataPtr->ellB;
 }
 
+//////////////////////////////////////////////////
+void SphericalCoordinates::SetGeodeticConversion(GeodeticMethod _method)
+{
+  switch (_method)
+  {
+    case BOWRING:
+    case FAST_BOWRING:
+    case VERMEILLE:
+      this->dataPtr->geodeticMethod = _method;
+      break;
+    default:
+      {
+        std::ostringstream errStream;
+        errStream << "Unknown geodetic method[" << _method << "]";
+        detail::LogErrorMessage(errStream.str());
+        break;
+      }
+  }
+}
+
+//////////////////////////////////////////////////
+SphericalCoordinates::GeodeticMethod
+SphericalCoordinates::GeodeticConversion() const
+{
+  return this->dataPtr->geodeticMethod;
+}
+
+//////////////////////////////////////////////////
+void SphericalCoordinates::EnableLocalApproximation(double _tolerance)
+{
+  if (!(_tolerance > 0))
+  {
+    std::ostringstream errStream;
+    errStream << "Invalid local approximation tolerance[" << _tolerance
+              << "], it must be positive";
+    detail::LogErrorMessage(errStream.str());
+    return;
+  }
+
+  this->dataPtr->approximationTolerance = _tolerance;
+  this->dataPtr->UpdateLocalApproximation();
+}
+
+//////////////////////////////////////////////////
+void SphericalCoordinates::DisableLocalApproximation()
+{
+  this->dataPtr->approximationTolerance = 0;
+  this->dataPtr->approximationRadius = 0;
+}
+
+//////////////////////////////////////////////////
+double SphericalCoordinates::LocalApproximationRadius() const
+{
+  return this->dataPtr->approximationRadius;
+}
+
 //////////////////////////////////////////////////
 double SphericalCoordinates::SurfaceFlattening() const
 {
@@ -513,6 +1419,8 @@ void SphericalCoordinates::UpdateTransformationMatrix()
     this->dataPtr->elevationReference);
   this->dataPtr->origin =
     *this->PositionTransform(this->dataPtr->origin, SPHERICAL, ECEF);
+
+  this->dataPtr->UpdateLocalApproximation();
 }
 
 /////////////////////////////////////////////////
@@ -529,6 +1437,24 @@ std::optional<CoordinateVector3> SphericalCoordinates::PositionTransform(
   }
   Vector3d tmp;
 
+  if (dataPtr->approximationRadius > 0)
+  {
+    if (_in == SphericalCoordinates::SPHERICAL)
+      tmp.Set(_pos.Lat()->Radian(), _pos.Lon()->Radian(), *_pos.Z());
+    else
+      tmp = *_pos.AsMetricVector();
+
+    if (dataPtr->LocalApproximation(tmp, _in, _out, tmp))
+    {
+      CoordinateVector3 res;
+      if (_out == SphericalCoordinates::SPHERICAL)
+        res = CoordinateVector3::Spherical(tmp.X(), tmp.Y(), tmp.Z());
+      else
+        res.SetMetric(tmp);
+      return res;
+    }
+  }
+
   // Convert whatever arrives to a more flexible ECEF coordinate
   switch (_in)
   {
@@ -553,24 +1479,8 @@ std::optional<CoordinateVector3> SphericalCoordinates::PositionTransform(
 
     case SphericalCoordinates::SPHERICAL:
       {
-        // Cache trig results
-        const auto latRad = _pos.Lat()->Radian();
-        const auto lonRad = _pos.Lon()->Radian();
-        double cosLat = cos(latRad);
-        double sinLat = sin(latRad);
-        double cosLon = cos(lonRad);
-        double sinLon = sin(lonRad);
-
-        // Radius of planet curvature (meters)
-        double curvature =
-          1.0 - dataPtr->ellE * dataPtr->ellE * sinLat * sinLat;
-        curvature = dataPtr->ellA / sqrt(curvature);
-
-        tmp.X((*_pos.Z() + curvature) * cosLat * cosLon);
-        tmp.Y((*_pos.Z() + curvature) * cosLat * sinLon);
-        tmp.Z(((dataPtr->ellB * dataPtr->ellB)/
-              (dataPtr->ellA * dataPtr->ellA) *
-              curvature + *_pos.Z()) * sinLat);
+        tmp = dataPtr->SphericalToECEF(
+            _pos.Lat()->Radian(), _pos.Lon()->Radian(), *_pos.Z());
         break;
       }
 
@@ -594,25 +1504,9 @@ std::optional<CoordinateVector3> SphericalCoordinates::PositionTransform(
     case SphericalCoordinates::SPHERICAL:
       {
         // Convert from ECEF to SPHERICAL
-        double p = sqrt(tmp.X() * tmp.X() + tmp.Y() * tmp.Y());
-        double theta = atan((tmp.Z() * dataPtr->ellA) /
-            (p * dataPtr->ellB));
-
-        // Calculate latitude and longitude
-        double lat = atan(
-            (tmp.Z() + std::pow(dataPtr->ellP, 2) * dataPtr->ellB *
-             std::pow(sin(theta), 3)) /
-            (p - std::pow(dataPtr->ellE, 2) *
-             dataPtr->ellA * std::pow(cos(theta), 3)));
-
-        double lon = atan2(tmp.Y(), tmp.X());
-
-        // Recalculate radius of planet curvature at the current latitude.
-        double nCurvature = 1.0 - std::pow(dataPtr->ellE, 2) *
-          std::pow(sin(lat), 2);
-        nCurvature = dataPtr->ellA / sqrt(nCurvature);
-
-        res = CoordinateVector3::Spherical(lat, lon, p/cos(lat) - nCurvature);
+        const Vector3d latLonEle = dataPtr->ECEFToSpherical(tmp);
+        res = CoordinateVector3::Spherical(
+            latLonEle.X(), latLonEle.Y(), latLonEle.Z());
         break;
       }
 
@@ -731,6 +1625,59 @@ std::optional<CoordinateVector3> SphericalCoordinates::VelocityTransform(
   return res;
 }
 
+//////////////////////////////////////////////////
+bool SphericalCoordinates::PositionTransform(
+    const std::vector<Vector3d> &_pos, std::vector<Vector3d> &_result,
+    const CoordinateType &_in, const CoordinateType &_out,
+    unsigned int _threads) const
+{
+  return this->dataPtr->PositionTransform(_pos, _result, _in, _out, _threads);
+}
+
+//////////////////////////////////////////////////
+bool SphericalCoordinates::PositionTransform(
+    const std::vector<Vector3f> &_pos, std::vector<Vector3f> &_result,
+    const CoordinateType &_in, const CoordinateType &_out,
+    unsigned int _threads) const
+{
+  return this->dataPtr->PositionTransform(_pos, _result, _in, _out, _threads);
+}
+
+//////////////////////////////////////////////////
+bool SphericalCoordinates::VelocityTransform(
+    const std::vector<Vector3d> &_vel, std::vector<Vector3d> &_result,
+    const CoordinateType &_in, const CoordinateType &_out,
+    unsigned int _threads) const
+{
+  // Sanity check -- velocity should not be expressed in spherical coordinates
+  if (_in == SphericalCoordinates::SPHERICAL ||
+      _out == SphericalCoordinates::SPHERICAL)
+  {
+    detail::LogErrorMessage(
+        "Velocity cannot be expressed in spherical coordinates.");
+    return false;
+  }
+  if (!ValidCoordinateType(_in) || !ValidCoordinateType(_out))
+    return false;
+
+  Matrix3d inRot, outRot;
+  Vector3d inTrans, outTrans;
+  this->dataPtr->CartesianToECEF(_in, inRot, inTrans);
+  this->dataPtr->CartesianToECEF(_out, outRot, outTrans);
+  const Matrix3d rot = outRot.Transposed() * inRot;
+
+  _result.resize(_vel.size());
+  const unsigned int threads = detail::ThreadCount(
+      _threads, _vel.size());
+  detail::ParallelFor(_vel.size(), threads,
+    [&](std::size_t _begin, std::size_t _end, unsigned int)
+    {
+      for (std::size_t i = _begin; i < _end; ++i)
+        _result[i] = rot * _vel[i];
+    });
+  return true;
+}
+
 //////////////////////////////////////////////////
 bool SphericalCoordinates::operator==(const SphericalCoordinates &_sc) const
 {
@@ -16,6 +16,9 @@
 */
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <vector>
+
 #include "gz/math/SphericalCoordinates.hh"
 
 using namespace gz;
@@ -877,3 +880,453 @@ TEST(SphericalCoordinatesTest, Inverse)
     EXPECT_EQ(in, *reverse);
   }
 }
+
+//////////////////////////////////////////////////
+TEST(SphericalCoordinatesTest, BatchTransforms)
+{
+  using SC = math::SphericalCoordinates;
+  const SC sc(SC::EARTH_WGS84, math::Angle(0.3), math::Angle(-1.2),
+              354.1, math::Angle(0.5));
+
+  // Local positions within a few kilometers, and far away ones
+  std::vector<math::Vector3d> local;
+  for (int i = 0; i < 2500; ++i)
+  {
+    local.emplace_back(1.3 * i - 1500.0, 1500.0 - 0.7 * i, 0.05 * i - 30.0);
+  }
+  local.emplace_back(4e6, -2e6, 1e5);
+  local.emplace_back(0, 0, 0);
+
+  const SC::CoordinateType types[] = {
+    SC::SPHERICAL, SC::ECEF, SC::GLOBAL, SC::LOCAL};
+  for (const SC::CoordinateType in : types)
+  {
+    // Inputs in each frame, from the scalar transform
+    std::vector<math::Vector3d> input;
+    for (const auto &p : local)
+    {
+      const auto v = sc.PositionTransform(
+          math::CoordinateVector3::Metric(p), SC::LOCAL, in);
+      ASSERT_TRUE(v.has_value());
+      input.push_back(in == SC::SPHERICAL ?
+          math::Vector3d(v->Lat()->Radian(), v->Lon()->Radian(), *v->Z()) :
+          *v->AsMetricVector());
+    }
+
+    for (const SC::CoordinateType out : types)
+    {
+      for (unsigned int threads : {1u, 3u})
+      {
+        std::vector<math::Vector3d> result;
+        ASSERT_TRUE(sc.PositionTransform(input, result, in, out, threads));
+        ASSERT_EQ(input.size(), result.size());
+        for (std::size_t i = 0; i < input.size(); ++i)
+        {
+          const auto pos = in == SC::SPHERICAL ?
+            math::CoordinateVector3::Spherical(
+                math::Angle(input[i].X()), math::Angle(input[i].Y()),
+                input[i].Z()) :
+            math::CoordinateVector3::Metric(input[i]);
+          const auto expected = sc.PositionTransform(pos, in, out);
+          ASSERT_TRUE(expected.has_value());
+          if (out == SC::SPHERICAL)
+          {
+            EXPECT_NEAR(expected->Lat()->Radian(), result[i].X(), 1e-12);
+            EXPECT_NEAR(expected->Lon()->Radian(), result[i].Y(), 1e-12);
+            // Elevations are computed with a formula less sensitive to
+            // the latitude approximation, which matters at high altitude
+            EXPECT_NEAR(*expected->Z(), result[i].Z(),
+                        1e-6 + 1e-9 * std::abs(*expected->Z()));
+          }
+          else
+          {
+            EXPECT_NEAR(0.0,
+                (*expected->AsMetricVector() - result[i]).Length(), 1e-6)
+              << in << " -> " << out << " " << input[i];
+          }
+        }
+
+        if (in != SC::SPHERICAL && out != SC::SPHERICAL)
+        {
+          ASSERT_TRUE(sc.VelocityTransform(input, result, in, out, threads));
+          ASSERT_EQ(input.size(), result.size());
+          for (std::size_t i = 0; i < input.size(); ++i)
+          {
+            const auto expected = sc.VelocityTransform(
+                math::CoordinateVector3::Metric(input[i]), in, out);
+            ASSERT_TRUE(expected.has_value());
+            EXPECT_NEAR(0.0,
+                (*expected->AsMetricVector() - result[i]).Length(),
+                1e-9 * input[i].Length());
+          }
+        }
+      }
+    }
+  }
+
+  // Single precision storage
+  std::vector<math::Vector3f> localf, resultf;
+  for (const auto &p : local)
+  {
+    localf.emplace_back(static_cast<float>(p.X()), static_cast<float>(p.Y()),
+                        static_cast<float>(p.Z()));
+  }
+  ASSERT_TRUE(sc.PositionTransform(localf, resultf, SC::LOCAL,
+                                   SC::SPHERICAL, 2));
+  std::vector<math::Vector3d> resultd;
+  ASSERT_TRUE(sc.PositionTransform(local, resultd, SC::LOCAL, SC::SPHERICAL));
+  ASSERT_EQ(local.size(), resultf.size());
+  for (std::size_t i = 0; i + 2 < local.size(); ++i)
+  {
+    EXPECT_NEAR(resultd[i].X(), resultf[i].X(), 1e-6);
+    EXPECT_NEAR(resultd[i].Y(), resultf[i].Y(), 1e-6);
+    EXPECT_NEAR(resultd[i].Z(), resultf[i].Z(), 1e-3);
+  }
+
+  // Invalid types
+  std::vector<math::Vector3d> result;
+  EXPECT_FALSE(sc.PositionTransform(local, result, SC::LOCAL,
+      static_cast<SC::CoordinateType>(7)));
+  EXPECT_FALSE(sc.PositionTransform(local, result,
+      static_cast<SC::CoordinateType>(7), SC::LOCAL));
+  EXPECT_FALSE(sc.VelocityTransform(local, result, SC::LOCAL,
+      SC::SPHERICAL));
+  EXPECT_FALSE(sc.VelocityTransform(local, result, SC::LOCAL,
+      static_cast<SC::CoordinateType>(7)));
+}
+
+//////////////////////////////////////////////////
+TEST(SphericalCoordinatesTest, GeodeticConversion)
+{
+  using SC = math::SphericalCoordinates;
+  SC sc(SC::EARTH_WGS84, math::Angle(0.3), math::Angle(-1.2),
+        354.1, math::Angle(0.5));
+  EXPECT_EQ(SC::BOWRING, sc.GeodeticConversion());
+  sc.SetGeodeticConversion(static_cast<SC::GeodeticMethod>(9));
+  EXPECT_EQ(SC::BOWRING, sc.GeodeticConversion());
+
+  // Geodetic positions at various elevations, and their ECEF coordinates
+  std::vector<math::Vector3d> spherical;
+  for (double elevation : {-1e4, 0.0, 1e3, 1e4, 1e5, 1e6})
+  {
+    for (int i = -89; i <= 89; ++i)
+      spherical.emplace_back(GZ_DTOR(i), GZ_DTOR(2 * i), elevation);
+  }
+  std::vector<math::Vector3d> ecef;
+  ASSERT_TRUE(sc.PositionTransform(spherical, ecef, SC::SPHERICAL, SC::ECEF));
+
+  for (const SC::GeodeticMethod method :
+       {SC::BOWRING, SC::FAST_BOWRING, SC::VERMEILLE})
+  {
+    sc.SetGeodeticConversion(method);
+    EXPECT_EQ(method, sc.GeodeticConversion());
+
+    std::vector<math::Vector3d> result;
+    ASSERT_TRUE(sc.PositionTransform(ecef, result, SC::ECEF, SC::SPHERICAL));
+    for (std::size_t i = 0; i < spherical.size(); ++i)
+    {
+      // Exact up to round-off for Vermeille, documented errors otherwise
+      const double elevation = spherical[i].Z();
+      const double tolerance = method == SC::VERMEILLE ? 1e-8 :
+        elevation > 1e5 ? 6e-3 : elevation > 1e4 ? 1e-4 : 1e-6;
+      EXPECT_NEAR(spherical[i].X(), result[i].X(),
+                  tolerance / sc.SurfaceAxisEquatorial()) << method;
+      EXPECT_NEAR(spherical[i].Y(), result[i].Y(), 1e-14) << method;
+      EXPECT_NEAR(elevation, result[i].Z(),
+                  method == SC::BOWRING ? 2 * tolerance : 1e-8) << method;
+
+      // The single point transform uses the same method
+      const auto single = sc.PositionTransform(
+          math::CoordinateVector3::Metric(ecef[i]), SC::ECEF, SC::SPHERICAL);
+      ASSERT_TRUE(single.has_value());
+      EXPECT_NEAR(single->Lat()->Radian(), result[i].X(), 1e-15);
+      EXPECT_NEAR(*single->Z(), result[i].Z(), 1e-8);
+    }
+  }
+
+  // Exact poles, and a millimeter away from them
+  for (const SC::GeodeticMethod method :
+       {SC::BOWRING, SC::FAST_BOWRING, SC::VERMEILLE})
+  {
+    sc.SetGeodeticConversion(method);
+    std::vector<math::Vector3d> poles{
+      {0, 0, sc.SurfaceAxisPolar() + 10.0},
+      {0, 0, -sc.SurfaceAxisPolar() - 20.0},
+      {1e-3, 0, sc.SurfaceAxisPolar() + 10.0}};
+    ASSERT_TRUE(sc.PositionTransform(poles, poles, SC::ECEF, SC::SPHERICAL));
+    EXPECT_DOUBLE_EQ(GZ_PI / 2, poles[0].X()) << method;
+    EXPECT_NEAR(10.0, poles[0].Z(), 1e-8) << method;
+    EXPECT_DOUBLE_EQ(-GZ_PI / 2, poles[1].X()) << method;
+    EXPECT_NEAR(20.0, poles[1].Z(), 1e-8) << method;
+    EXPECT_NEAR(GZ_PI / 2, poles[2].X(), 1e-9) << method;
+    EXPECT_LT(poles[2].X(), GZ_PI / 2) << method;
+    EXPECT_NEAR(10.0, poles[2].Z(), 1e-6) << method;
+  }
+
+  // Near the center, Vermeille's form falls back to Bowring's
+  sc.SetGeodeticConversion(SC::VERMEILLE);
+  const auto center = sc.PositionTransform(
+      math::CoordinateVector3::Metric(1000, 2000, 3000),
+      SC::ECEF, SC::SPHERICAL);
+  ASSERT_TRUE(center.has_value());
+  EXPECT_TRUE(std::isfinite(*center->Z()));
+
+  // Spherical surfaces
+  SC sphere(SC::CUSTOM_SURFACE, 1000.0, 1000.0);
+  sphere.SetGeodeticConversion(SC::VERMEILLE);
+  const auto onSphere = sphere.PositionTransform(
+      math::CoordinateVector3::Metric(600, 0, 800), SC::ECEF, SC::SPHERICAL);
+  ASSERT_TRUE(onSphere.has_value());
+  EXPECT_NEAR(atan2(800, 600), onSphere->Lat()->Radian(), 1e-15);
+  EXPECT_NEAR(0.0, *onSphere->Z(), 1e-12);
+}
+
+//////////////////////////////////////////////////
+// Test the local tangent-plane approximation
+TEST(SphericalCoordinatesTest, LocalApproximation)
+{
+  using SC = math::SphericalCoordinates;
+  SC sc(SC::EARTH_WGS84, GZ_DTOR(47.3667), GZ_DTOR(8.5500), 500.0,
+        GZ_DTOR(30.0));
+  SC exact(sc);
+  exact.SetGeodeticConversion(SC::VERMEILLE);
+  sc.SetGeodeticConversion(SC::VERMEILLE);
+
+  // Disabled by default
+  EXPECT_DOUBLE_EQ(0.0, sc.LocalApproximationRadius());
+
+  // Invalid tolerances are rejected
+  sc.EnableLocalApproximation(0.0);
+  EXPECT_DOUBLE_EQ(0.0, sc.LocalApproximationRadius());
+  sc.EnableLocalApproximation(-1.0);
+  EXPECT_DOUBLE_EQ(0.0, sc.LocalApproximationRadius());
+
+  const double tolerance = 1e-3;
+  sc.EnableLocalApproximation(tolerance);
+  const double radius = sc.LocalApproximationRadius();
+  EXPECT_GT(radius, 1000.0);
+  EXPECT_LE(radius, 1e5);
+
+  // Error of two geodetic positions in meters along each coordinate
+  auto error = [&](const math::Vector3d &_a, const math::Vector3d &_b)
+  {
+    const double a = sc.SurfaceAxisEquatorial();
+    return math::Vector3d((_a.X() - _b.X()) * a,
+        (_a.Y() - _b.Y()) * a * cos(_a.X()), _a.Z() - _b.Z()).Length();
+  };
+
+  // Points inside and outside the radius in many directions
+  std::vector<math::Vector3d> local;
+  for (int i = 0; i < 200; ++i)
+  {
+    const double theta = 0.7 * i;
+    const double phi = 0.31 * i;
+    const double distance = radius * (0.01 + 1.5 * (i % 20) / 19.0);
+    local.emplace_back(distance * cos(theta) * cos(phi),
+                       distance * sin(theta) * cos(phi),
+                       distance * sin(phi));
+  }
+
+  std::vector<math::Vector3d> approxBatch;
+  std::vector<math::Vector3d> exactBatch;
+  ASSERT_TRUE(sc.PositionTransform(local, approxBatch, SC::LOCAL,
+                                   SC::SPHERICAL));
+  ASSERT_TRUE(exact.PositionTransform(local, exactBatch, SC::LOCAL,
+                                      SC::SPHERICAL));
+  for (std::size_t i = 0; i < local.size(); ++i)
+  {
+    const auto approxPos = sc.PositionTransform(
+        math::CoordinateVector3::Metric(local[i]), SC::LOCAL, SC::SPHERICAL);
+    const auto exactPos = exact.PositionTransform(
+        math::CoordinateVector3::Metric(local[i]), SC::LOCAL, SC::SPHERICAL);
+    ASSERT_TRUE(approxPos.has_value());
+    ASSERT_TRUE(exactPos.has_value());
+    const math::Vector3d approxSingle(approxPos->Lat()->Radian(),
+        approxPos->Lon()->Radian(), *approxPos->Z());
+    const math::Vector3d exactSingle(exactPos->Lat()->Radian(),
+        exactPos->Lon()->Radian(), *exactPos->Z());
+
+    // The batch transform uses the approximation for the same points
+    EXPECT_EQ(approxSingle, approxBatch[i]);
+
+    if (local[i].Length() <= radius)
+    {
+      EXPECT_LT(error(approxSingle, exactSingle), tolerance) << i;
+      EXPECT_LT(error(approxBatch[i], exactBatch[i]), tolerance) << i;
+    }
+    else
+    {
+      // Outside the radius, the exact path is taken
+      EXPECT_EQ(exactSingle, approxSingle) << i;
+      EXPECT_EQ(exactBatch[i], approxBatch[i]) << i;
+    }
+
+    // And back to LOCAL
+    const auto approxLocal = sc.PositionTransform(
+        *exactPos, SC::SPHERICAL, SC::LOCAL);
+    const auto exactLocal = exact.PositionTransform(
+        *exactPos, SC::SPHERICAL, SC::LOCAL);
+    ASSERT_TRUE(approxLocal.has_value());
+    ASSERT_TRUE(exactLocal.has_value());
+    if (local[i].Length() <= 0.99 * radius)
+    {
+      EXPECT_LT((*approxLocal->AsMetricVector() -
+                 *exactLocal->AsMetricVector()).Length(), tolerance) << i;
+    }
+    else if (local[i].Length() > 1.01 * radius)
+    {
+      EXPECT_EQ(*exactLocal->AsMetricVector(),
+                *approxLocal->AsMetricVector()) << i;
+    }
+  }
+
+  // Transforms involving ECEF are exact
+  const auto ecef = sc.PositionTransform(
+      math::CoordinateVector3::Metric(10, 20, 30), SC::LOCAL, SC::ECEF);
+  ASSERT_TRUE(ecef.has_value());
+  EXPECT_EQ(*exact.PositionTransform(math::CoordinateVector3::Metric(
+      10, 20, 30), SC::LOCAL, SC::ECEF)->AsMetricVector(),
+      *ecef->AsMetricVector());
+
+  // Longitudes wrap around the antimeridian like the exact transform
+  sc.SetLongitudeReference(GZ_DTOR(179.99));
+  exact.SetLongitudeReference(GZ_DTOR(179.99));
+  const auto east = sc.PositionTransform(
+      math::CoordinateVector3::Metric(2000, 0, 0), SC::GLOBAL, SC::SPHERICAL);
+  const auto eastExact = exact.PositionTransform(
+      math::CoordinateVector3::Metric(2000, 0, 0), SC::GLOBAL, SC::SPHERICAL);
+  ASSERT_TRUE(east.has_value());
+  ASSERT_TRUE(eastExact.has_value());
+  EXPECT_LT(east->Lon()->Radian(), 0.0);
+  EXPECT_NEAR(eastExact->Lon()->Radian(), east->Lon()->Radian(), 1e-9);
+
+  // The radius follows the reference, it is smaller at high latitudes
+  sc.SetLatitudeReference(GZ_DTOR(89.9));
+  EXPECT_LT(sc.LocalApproximationRadius(), radius);
+  sc.SetLatitudeReference(GZ_DTOR(47.3667));
+  EXPECT_NEAR(radius, sc.LocalApproximationRadius(), 0.1 * radius);
+
+  // A larger tolerance gives a larger radius
+  sc.EnableLocalApproximation(1.0);
+  EXPECT_GT(sc.LocalApproximationRadius(), radius);
+
+  sc.DisableLocalApproximation();
+  EXPECT_DOUBLE_EQ(0.0, sc.LocalApproximationRadius());
+  sc.SetLatitudeReference(GZ_DTOR(10.0));
+  EXPECT_DOUBLE_EQ(0.0, sc.LocalApproximationRadius());
+}
+
+//////////////////////////////////////////////////
+// Test batch distances
+TEST(SphericalCoordinatesTest, BatchDistances)
+{
+  using SC = math::SphericalCoordinates;
+
+  std::vector<math::Vector2d> points;
+  for (int i = 0; i < 50; ++i)
+  {
+    points.emplace_back(GZ_DTOR(-89.0 + 3.6 * i),
+                        GZ_DTOR(-180.0 + 7.3 * ((i * 17) % 50)));
+  }
+  // Close points
+  points.emplace_back(GZ_DTOR(45.0), GZ_DTOR(10.0));
+  points.emplace_back(GZ_DTOR(45.00001), GZ_DTOR(10.00001));
+
+  // One to many matches the single pair distance
+  std::vector<double> distances;
+  ASSERT_TRUE(SC::DistanceWGS84(points[3], points, distances));
+  ASSERT_EQ(points.size(), distances.size());
+  for (std::size_t i = 0; i < points.size(); ++i)
+  {
+    const double expected = SC::DistanceWGS84(
+        math::Angle(points[3].X()), math::Angle(points[3].Y()),
+        math::Angle(points[i].X()), math::Angle(points[i].Y()));
+    EXPECT_NEAR(expected, distances[i], 1e-6 + 1e-12 * expected) << i;
+  }
+
+  // Many to many, row major
+  const std::vector<math::Vector2d> from(points.begin(), points.begin() + 7);
+  ASSERT_TRUE(SC::DistanceWGS84(from, points, distances));
+  ASSERT_EQ(from.size() * points.size(), distances.size());
+  std::vector<double> row;
+  for (std::size_t i = 0; i < from.size(); ++i)
+  {
+    ASSERT_TRUE(SC::DistanceWGS84(from[i], points, row));
+    for (std::size_t j = 0; j < points.size(); ++j)
+      EXPECT_DOUBLE_EQ(row[j], distances[i * points.size() + j]);
+  }
+
+  // Close points
+  const std::size_t last = points.size() - 1;
+  ASSERT_TRUE(SC::DistanceWGS84(points[last - 1], {points[last]},
+                                distances));
+  EXPECT_NEAR(SC::DistanceWGS84(
+        math::Angle(points[last - 1].X()), math::Angle(points[last - 1].Y()),
+        math::Angle(points[last].X()), math::Angle(points[last].Y())),
+      distances[0], 1e-8);
+
+  // The surface in use
+  SC moon(SC::MOON_SCS);
+  ASSERT_TRUE(moon.DistanceBetweenPoints(from, points, distances));
+  for (std::size_t i = 0; i < from.size(); ++i)
+  {
+    for (std::size_t j = 0; j < points.size(); ++j)
+    {
+      const double expected = moon.DistanceBetweenPoints(
+          math::Angle(from[i].X()), math::Angle(from[i].Y()),
+          math::Angle(points[j].X()), math::Angle(points[j].Y()));
+      EXPECT_NEAR(expected, distances[i * points.size() + j],
+                  1e-6 + 1e-12 * expected);
+    }
+  }
+  ASSERT_TRUE(moon.DistanceBetweenPoints(from[2], points, row));
+  for (std::size_t j = 0; j < points.size(); ++j)
+    EXPECT_DOUBLE_EQ(row[j], distances[2 * points.size() + j]);
+
+  // Vincenty's reference example, Flinders Peak to Buninyong
+  const math::Vector2d flinders(
+      GZ_DTOR(-(37 + 57 / 60.0 + 3.72030 / 3600)),
+      GZ_DTOR(144 + 25 / 60.0 + 29.52440 / 3600));
+  const math::Vector2d buninyong(
+      GZ_DTOR(-(37 + 39 / 60.0 + 10.15610 / 3600)),
+      GZ_DTOR(143 + 55 / 60.0 + 35.38390 / 3600));
+  ASSERT_TRUE(SC::DistanceWGS84(flinders, {buninyong, flinders},
+                                distances, SC::VINCENTY));
+  EXPECT_NEAR(54972.271, distances[0], 1e-3);
+  EXPECT_DOUBLE_EQ(0.0, distances[1]);
+
+  // Along the equator and a meridian
+  const math::Vector2d zero(0, 0);
+  ASSERT_TRUE(SC::DistanceWGS84(zero,
+        {{0, GZ_DTOR(1.0)}, {GZ_PI / 2, 0}, {-GZ_PI / 2, 0}},
+        distances, SC::VINCENTY));
+  EXPECT_NEAR(6378137.0 * GZ_DTOR(1.0), distances[0], 1e-6);
+  EXPECT_NEAR(10001965.729, distances[1], 1e-3);
+  EXPECT_NEAR(10001965.729, distances[2], 1e-3);
+
+  // Nearly antipodal points fall back to the great circle distance
+  ASSERT_TRUE(SC::DistanceWGS84(zero, {{GZ_DTOR(0.5), GZ_DTOR(179.7)}},
+                                distances, SC::VINCENTY));
+  EXPECT_NEAR(SC::DistanceWGS84(math::Angle(0), math::Angle(0),
+        math::Angle(GZ_DTOR(0.5)), math::Angle(GZ_DTOR(179.7))),
+      distances[0], 1e-6);
+
+  // Threads do not change the results
+  std::vector<math::Vector2d> many;
+  for (int i = 0; i < 3000; ++i)
+    many.emplace_back(GZ_DTOR(-80.0 + 0.05 * i), GZ_DTOR(0.11 * i));
+  std::vector<double> serial;
+  for (const SC::DistanceMethod method : {SC::HAVERSINE, SC::VINCENTY})
+  {
+    ASSERT_TRUE(SC::DistanceWGS84(from, many, serial, method));
+    ASSERT_TRUE(SC::DistanceWGS84(from, many, distances, method, 4));
+    EXPECT_EQ(serial, distances);
+  }
+
+  // Empty sets and unknown methods
+  ASSERT_TRUE(SC::DistanceWGS84(std::vector<math::Vector2d>(), points,
+                                distances));
+  EXPECT_TRUE(distances.empty());
+  EXPECT_FALSE(SC::DistanceWGS84(zero, points, distances,
+                                 static_cast<SC::DistanceMethod>(9)));
+}
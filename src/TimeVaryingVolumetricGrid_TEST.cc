@@ -16,6 +16,13 @@
  */
 #include <gz/math/TimeVaryingVolumetricGrid.hh>
 #include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
 using namespace gz;
 using namespace math;
 /////////////////////////////////////////////////
@@ -122,3 +129,148 @@ TEST(TimeVaryingVolumetricGridTest, TestEmptyGrid)
   // Check validity
   ASSERT_FALSE(grid.IsValid(invalid_session));
 }
+
+/////////////////////////////////////////////////
+TEST(TimeVaryingVolumetricGridTest, TestFileRoundTrip)
+{
+  InMemoryTimeVaryingVolumetricGridFactory<double, double> gridFactory;
+
+  for (double t = 0; t <= 1; t+=0.25)
+  {
+    for (double x = -1; x <= 1; x+=0.5)
+    {
+      for (double y = -1; y <= 2; y+=1)
+      {
+        for (double z = 0; z <= 1; z+=0.5)
+        {
+          // Leave a hole in the grid.
+          if (t > 0.2 && t < 0.3 && x > 0.2 && x < 0.8 && y > -0.5 && y < 0.5)
+            continue;
+          gridFactory.AddPoint(t, Vector3d{x, y, z}, t + x * y - z);
+        }
+      }
+    }
+  }
+
+  const std::string path = (std::filesystem::temp_directory_path() /
+    "TimeVaryingVolumetricGridTest.gzgrid").string();
+  ASSERT_TRUE(gridFactory.WriteFile(
+    path, VolumetricGridEncoding::FLOAT64, {{2, 2, 2}}));
+
+  auto grid = gridFactory.Build();
+  auto loaded =
+    InMemoryTimeVaryingVolumetricGridFactory<double, double>::Load(path);
+  ASSERT_TRUE(loaded.has_value());
+
+  auto bounds = grid.Bounds(grid.CreateSession());
+  auto loadedBounds = loaded->Bounds(loaded->CreateSession());
+  EXPECT_EQ(bounds.first, loadedBounds.first);
+  EXPECT_EQ(bounds.second, loadedBounds.second);
+
+  auto session = grid.CreateSession();
+  auto loadedSession = loaded->CreateSession();
+  for (double t = 0; t <= 1; t += 0.1)
+  {
+    auto next = grid.StepTo(session, t);
+    auto loadedNext = loaded->StepTo(loadedSession, t);
+    ASSERT_EQ(next.has_value(), loadedNext.has_value());
+    if (next)
+    {
+      session = *next;
+      loadedSession = *loadedNext;
+    }
+    for (double x = -1.2; x <= 1.2; x += 0.3)
+    {
+      for (double y = -1.2; y <= 2.2; y += 0.4)
+      {
+        const Vector3d pos{x, y, 0.3};
+        auto val = grid.LookUp(session, pos);
+        auto loadedVal = loaded->LookUp(loadedSession, pos);
+        ASSERT_EQ(val.has_value(), loadedVal.has_value()) << pos;
+        if (val)
+        {
+          EXPECT_DOUBLE_EQ(*val, *loadedVal) << t << " " << pos;
+        }
+      }
+    }
+  }
+
+  std::filesystem::remove(path);
+  using Factory = InMemoryTimeVaryingVolumetricGridFactory<double, double>;
+  EXPECT_FALSE(Factory::Load(path).has_value());
+}
+
+/////////////////////////////////////////////////
+TEST(TimeVaryingVolumetricGridTest, TestLookUpHintsAndBatch)
+{
+  InMemoryTimeVaryingVolumetricGridFactory<double, double> gridFactory;
+
+  for (double t = 0; t <= 1; t+=0.25)
+  {
+    for (double x = 0; x <= 4; x+=1)
+    {
+      for (double y = 0; y <= 4; y+=0.5)
+      {
+        for (double z = 0; z <= 1; z+=0.5)
+        {
+          // The last frame has a hole.
+          if (t > 0.9 && x > 1.5 && x < 2.5)
+            continue;
+          gridFactory.AddPoint(t, Vector3d{x, y, z}, t * t + x * y - z);
+        }
+      }
+    }
+  }
+  auto grid = gridFactory.Build();
+  const Vector3d tol{1e-6, 1e-6, 1e-6};
+
+  // A vehicle moving through the grid, sometimes leaving it, and sometimes
+  // crossing grid points and planes.
+  std::vector<Vector3d> path;
+  for (int i = 0; i < 400; ++i)
+  {
+    path.emplace_back(-0.5 + i * 0.0125, 0.3 + i * 0.01, (i % 40) * 0.025);
+    if (i % 50 == 0)
+      path.emplace_back(2, 1.5, 0.5);
+  }
+
+  // The hints are carried across time steps.
+  auto session = grid.CreateSession();
+  InMemoryLookupHints hints;
+  for (double t = 0; t <= 1.01; t += 0.05)
+  {
+    auto next = grid.StepTo(session, t);
+    if (next)
+      session = *next;
+    for (const auto &pos : path)
+    {
+      auto cached = grid.LookUp(session, hints, pos);
+      auto uncached = grid.LookUp(session, pos, tol);
+      ASSERT_EQ(uncached.has_value(), cached.has_value()) << t << " " << pos;
+      if (cached)
+      {
+        EXPECT_EQ(0, std::memcmp(&*cached, &*uncached, sizeof(double)))
+          << t << " " << pos;
+      }
+    }
+
+    for (unsigned int threads : {1u, 3u})
+    {
+      std::vector<Vector3d> positions;
+      for (int i = 0; i < 4; ++i)
+        positions.insert(positions.end(), path.begin(), path.end());
+      std::vector<std::optional<double>> values;
+      grid.LookUp(session, positions, values, threads);
+      ASSERT_EQ(positions.size(), values.size());
+      for (std::size_t i = 0; i < positions.size(); ++i)
+      {
+        auto expected = grid.LookUp(session, positions[i], tol);
+        ASSERT_EQ(expected.has_value(), values[i].has_value());
+        if (expected)
+        {
+          EXPECT_EQ(0, std::memcmp(&*expected, &*values[i], sizeof(double)));
+        }
+      }
+    }
+  }
+}
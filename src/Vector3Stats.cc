@@ -14,11 +14,45 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
 #include <gz/math/Vector3Stats.hh>
+#include <gz/math/detail/Error.hh>
+#include <gz/math/detail/ParallelFor.hh>
 
 using namespace gz;
 using namespace math;
 
+namespace
+{
+/// \brief Check whether two SignalStats have the same set of statistics.
+/// \param[in] _a First statistics.
+/// \param[in] _b Second statistics.
+/// \return True if the short names of their statistics match.
+bool SameStatistics(const SignalStats &_a, const SignalStats &_b)
+{
+  const auto mapA = _a.Map();
+  const auto mapB = _b.Map();
+  return mapA.size() == mapB.size() &&
+    std::equal(mapA.begin(), mapA.end(), mapB.begin(),
+        [](const auto &_first, const auto &_second)
+        {
+          return _first.first == _second.first;
+        });
+}
+
+/// \brief Add the statistics of one SignalStats to another.
+/// \param[in] _from Statistics to copy the names from.
+/// \param[in,out] _to Statistics to add them to.
+void CopyStatistics(const SignalStats &_from, SignalStats &_to)
+{
+  for (const auto &statistic : _from.Map())
+    _to.InsertStatistic(statistic.first);
+}
+}  // namespace
+
 /// \brief Private data class for the Vector3Stats class.
 class Vector3Stats::Implementation
 {
@@ -50,6 +84,62 @@ void Vector3Stats::InsertData(const Vector3d &_data)
   this->dataPtr->mag.InsertData(_data.Length());
 }
 
+//////////////////////////////////////////////////
+void Vector3Stats::InsertData(const Vector3d *_data, std::size_t _count,
+    unsigned int _threads)
+{
+  // Each thread also builds and merges its own statistics.
+  const unsigned int threads = detail::ThreadCount(_threads, _count, 1 << 14);
+  if (threads <= 1)
+  {
+    for (std::size_t i = 0; i < _count; ++i)
+      this->InsertData(_data[i]);
+    return;
+  }
+
+  // The first chunk is inserted here, the others in empty statistics of
+  // the same types that are merged afterwards in order.
+  std::vector<Vector3Stats> partial(threads - 1);
+  for (auto &stats : partial)
+  {
+    CopyStatistics(this->dataPtr->x, stats.dataPtr->x);
+    CopyStatistics(this->dataPtr->y, stats.dataPtr->y);
+    CopyStatistics(this->dataPtr->z, stats.dataPtr->z);
+    CopyStatistics(this->dataPtr->mag, stats.dataPtr->mag);
+  }
+
+  detail::ParallelFor(_count, threads,
+    [&](std::size_t _begin, std::size_t _end, unsigned int _thread)
+    {
+      Vector3Stats &target = _thread == 0 ? *this : partial[_thread - 1];
+      for (std::size_t i = _begin; i < _end; ++i)
+        target.InsertData(_data[i]);
+    });
+
+  for (auto const &stats : partial)
+    this->Merge(stats);
+}
+
+//////////////////////////////////////////////////
+bool Vector3Stats::Merge(const Vector3Stats &_other)
+{
+  if (!SameStatistics(this->dataPtr->x, _other.dataPtr->x) ||
+      !SameStatistics(this->dataPtr->y, _other.dataPtr->y) ||
+      !SameStatistics(this->dataPtr->z, _other.dataPtr->z) ||
+      !SameStatistics(this->dataPtr->mag, _other.dataPtr->mag))
+  {
+    detail::LogErrorMessage(
+        "Unable to Merge Vector3Stats with different statistics.");
+    return false;
+  }
+
+  bool x = this->dataPtr->x.Merge(_other.dataPtr->x);
+  bool y = this->dataPtr->y.Merge(_other.dataPtr->y);
+  bool z = this->dataPtr->z.Merge(_other.dataPtr->z);
+  bool mag = this->dataPtr->mag.Merge(_other.dataPtr->mag);
+  return x && y && z && mag;
+}
+
 //////////////////////////////////////////////////
 bool Vector3Stats::InsertStatistic(const std::string &_name)
 {
@@ -17,6 +17,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
 #include <gz/math/Vector3Stats.hh>
 
 using namespace gz;
@@ -187,3 +192,52 @@ TEST_F(Vector3StatsTest, Vector3Stats)
     EXPECT_NEAR(this->Mag(name), 1.0, 1e-10);
   }
 }
+
+//////////////////////////////////////////////////
+TEST_F(Vector3StatsTest, Merge)
+{
+  std::vector<math::Vector3d> data;
+  for (int i = 0; i < 100000; ++i)
+    data.emplace_back(std::cos(0.01 * i), 2.0 + std::sin(0.02 * i), 0.1 * i);
+
+  math::Vector3Stats sequential, first, second, parallel;
+  for (auto *v3stats : {&sequential, &first, &second, &parallel})
+    EXPECT_TRUE(v3stats->InsertStatistics("max,maxAbs,mean,min,rms,var"));
+
+  for (const auto &value : data)
+    sequential.InsertData(value);
+  first.InsertData(data.data(), 1000);
+  second.InsertData(data.data() + 1000, data.size() - 1000);
+  EXPECT_TRUE(first.Merge(second));
+  parallel.InsertData(data.data(), data.size(), 3);
+
+  for (auto *merged : {&first, &parallel})
+  {
+    const std::vector<std::pair<const math::SignalStats *,
+      const math::SignalStats *>> components = {
+        {&sequential.X(), &merged->X()}, {&sequential.Y(), &merged->Y()},
+        {&sequential.Z(), &merged->Z()}, {&sequential.Mag(), &merged->Mag()}};
+    for (const auto &[expected, actual] : components)
+    {
+      EXPECT_EQ(expected->Count(), actual->Count());
+      auto expectedMap = expected->Map();
+      for (const auto &[name, value] : actual->Map())
+      {
+        EXPECT_NEAR(expectedMap[name], value,
+                    1e-9 * std::max(1.0, std::abs(value))) << name;
+      }
+    }
+  }
+
+  // Statistics must match component by component
+  math::Vector3Stats other;
+  EXPECT_TRUE(other.InsertStatistics("max,maxAbs,mean,min,rms"));
+  EXPECT_FALSE(first.Merge(other));
+  EXPECT_TRUE(other.X().InsertStatistic("var"));
+  EXPECT_FALSE(first.Merge(other));
+  EXPECT_TRUE(other.Y().InsertStatistic("var"));
+  EXPECT_TRUE(other.Z().InsertStatistic("var"));
+  EXPECT_TRUE(other.Mag().InsertStatistic("var"));
+  EXPECT_TRUE(first.Merge(other));
+  EXPECT_EQ(data.size(), first.X().Count());
+}
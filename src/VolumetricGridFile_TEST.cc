@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "gz/math/MappedTimeVaryingVolumetricGrid.hh"
+
+using namespace gz;
+using namespace math;
+
+//////////////////////////////////////////////////
+TEST(VolumetricGridFileTest, HalfFloat)
+{
+  EXPECT_EQ(0x0000u, detail::FloatToHalf(0.0f));
+  EXPECT_EQ(0x8000u, detail::FloatToHalf(-0.0f));
+  EXPECT_EQ(0x3c00u, detail::FloatToHalf(1.0f));
+  EXPECT_EQ(0xc000u, detail::FloatToHalf(-2.0f));
+  EXPECT_EQ(0x7bffu, detail::FloatToHalf(65504.0f));
+  EXPECT_EQ(0x7c00u, detail::FloatToHalf(65520.0f));
+  EXPECT_EQ(0xfc00u,
+    detail::FloatToHalf(-std::numeric_limits<float>::infinity()));
+  EXPECT_EQ(0x0001u, detail::FloatToHalf(std::ldexp(1.0f, -24)));
+  EXPECT_EQ(0x0000u, detail::FloatToHalf(std::ldexp(1.0f, -26)));
+  EXPECT_TRUE(std::isnan(detail::HalfToFloat(
+    detail::FloatToHalf(std::numeric_limits<float>::quiet_NaN()))));
+  // Ties round to even.
+  EXPECT_EQ(0x3c00u, detail::FloatToHalf(1.0f + std::ldexp(1.0f, -11)));
+  EXPECT_EQ(0x3c02u, detail::FloatToHalf(1.0f + 3 * std::ldexp(1.0f, -11)));
+
+  // Every finite half converts to a float and back unchanged, and floats
+  // between two halves round to the nearest one.
+  for (uint32_t bits = 0; bits < 0x10000u; ++bits)
+  {
+    const auto half = static_cast<uint16_t>(bits);
+    if ((half & 0x7c00u) == 0x7c00u)
+      continue;
+    const float value = detail::HalfToFloat(half);
+    ASSERT_EQ(half, detail::FloatToHalf(value)) << bits;
+
+    if ((half & 0x7fffu) == 0x7bffu)
+      continue;
+    const float next = detail::HalfToFloat(static_cast<uint16_t>(half + 1));
+    const float quarter = value + (next - value) * 0.25f;
+    ASSERT_EQ(half, detail::FloatToHalf(quarter)) << bits;
+    const float threeQuarters = value + (next - value) * 0.75f;
+    ASSERT_EQ(static_cast<uint16_t>(half + 1),
+              detail::FloatToHalf(threeQuarters)) << bits;
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(VolumetricGridFileTest, Encodings)
+{
+  const std::vector<double> x{0, 1, 2, 3, 4};
+  const std::vector<double> y{0, 1, 2};
+  const std::vector<double> z{0, 1};
+  const std::vector<double> times{0, 1};
+  std::vector<double> values;
+  for (int i = 0; i < 60; ++i)
+    values.push_back(std::sin(i * 0.7) * 50.0);
+  values[11] = std::numeric_limits<double>::quiet_NaN();
+
+  const std::string path = (std::filesystem::temp_directory_path() /
+    "VolumetricGridFileTest.gzgrid").string();
+  struct Case
+  {
+    VolumetricGridEncoding encoding;
+    double tolerance;
+    std::size_t valueSize;
+  };
+  for (const Case &c : {
+        Case{VolumetricGridEncoding::FLOAT64, 0.0, 8},
+        Case{VolumetricGridEncoding::FLOAT32, 1e-5, 4},
+        Case{VolumetricGridEncoding::FLOAT16, 50.0 / 1024, 2},
+        Case{VolumetricGridEncoding::QUANTIZED16, 50.0 / 32767, 2}})
+  {
+    ASSERT_TRUE(WriteVolumetricGridFile(
+      path, x, y, z, times, values, c.encoding, {{4, 2, 2}}));
+    MappedFile file;
+    ASSERT_TRUE(file.Open(path));
+    VolumetricGridFileHeader header;
+    ASSERT_TRUE(detail::ReadVolumetricGridHeader(
+      file.Data(), file.Size(), header));
+    EXPECT_EQ(static_cast<uint32_t>(c.encoding), header.encoding);
+    EXPECT_EQ(0u, header.valuesOffset % 4096);
+    // Tiles of 16 values aligned to 64 bytes, 2 x 2 x 1 tiles per frame.
+    EXPECT_EQ(std::max<uint64_t>(64, 16 * c.valueSize), header.tileStride);
+    EXPECT_EQ(4 * header.tileStride, header.frameStride);
+    file.Close();
+
+    MappedTimeVaryingVolumetricGrid<double> grid;
+    ASSERT_TRUE(grid.Open(path));
+    for (std::size_t f = 0; f < times.size(); ++f)
+    {
+      auto session = grid.CreateSession(times[f]);
+      for (std::size_t i = 0; i < 30; ++i)
+      {
+        const Vector3d pos(
+          x[i % x.size()], y[(i / x.size()) % y.size()],
+          z[i / (x.size() * y.size())]);
+        const double expected = values[f * 30 + i];
+        // Missing values are read as zero.
+        EXPECT_NEAR(std::isnan(expected) ? 0.0 : expected,
+                    grid.LookUp(session, pos).value(), c.tolerance)
+          << static_cast<int>(c.encoding) << " " << pos;
+      }
+    }
+  }
+  std::filesystem::remove(path);
+}
+
+//////////////////////////////////////////////////
+TEST(VolumetricGridFileTest, InvalidHeaders)
+{
+  const std::string path = (std::filesystem::temp_directory_path() /
+    "VolumetricGridFileInvalidTest.gzgrid").string();
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+
+  // The writer rejects unordered axes and empty frames.
+  const std::vector<double> values(8, 1.0);
+  EXPECT_FALSE(WriteVolumetricGridFile(path, {1, 0}, {0, 1}, {0, 1}, {0},
+      values));
+  EXPECT_FALSE(WriteVolumetricGridFile(path, {0, 1}, {0, nan}, {0, 1}, {0},
+      values));
+  EXPECT_FALSE(WriteVolumetricGridFile(path, {0, 1}, {0, 1}, {0, 0, 1},
+      {0}, std::vector<double>(12, 1.0)));
+  EXPECT_FALSE(WriteVolumetricGridFile(path, {0, 1}, {0, 1}, {0, 1}, {},
+      std::vector<double>{}));
+
+  ASSERT_TRUE(WriteVolumetricGridFile(path, {0, 1}, {0, 1}, {0, 1}, {0, 1},
+      std::vector<double>(16, 1.0), VolumetricGridEncoding::FLOAT64));
+  std::vector<uint8_t> valid;
+  {
+    MappedFile file;
+    ASSERT_TRUE(file.Open(path));
+    valid.assign(file.Data(), file.Data() + file.Size());
+  }
+  std::filesystem::remove(path);
+
+  VolumetricGridFileHeader header;
+  ASSERT_TRUE(detail::ReadVolumetricGridHeader(
+    valid.data(), valid.size(), header));
+
+  // Check that a modified copy of the file is rejected.
+  auto rejected = [&](auto _modify)
+  {
+    std::vector<uint8_t> data = valid;
+    VolumetricGridFileHeader modified;
+    std::memcpy(&modified, data.data(), sizeof(modified));
+    _modify(modified, data);
+    std::memcpy(data.data(), &modified, sizeof(modified));
+    return !detail::ReadVolumetricGridHeader(
+      data.data(), data.size(), modified);
+  };
+  constexpr uint64_t kMax = std::numeric_limits<uint64_t>::max();
+
+  EXPECT_TRUE(rejected([](auto &_h, auto &) { _h.frames = 0; }));
+  // Sizes whose products or sums overflow.
+  EXPECT_TRUE(rejected([](auto &_h, auto &) { _h.size[0] = kMax; }));
+  EXPECT_TRUE(rejected([](auto &_h, auto &)
+    {
+      _h.size[0] = _h.size[1] = _h.size[2] = uint64_t{1} << 40;
+    }));
+  EXPECT_TRUE(rejected([](auto &_h, auto &)
+    {
+      _h.frames = uint64_t{1} << 62;
+      _h.frameStride = 8;
+    }));
+  EXPECT_TRUE(rejected([](auto &_h, auto &) { _h.axesOffset = kMax - 8; }));
+  EXPECT_TRUE(rejected([](auto &_h, auto &)
+    {
+      _h.tileSize[0] = _h.tileSize[1] = _h.tileSize[2] = 0xffffffffu;
+    }));
+  // Values that are not aligned to their size, in a file that is large
+  // enough for them.
+  auto shift = [&](uint64_t _offset, uint64_t _tile, uint64_t _frame)
+  {
+    return rejected([&](auto &_h, auto &_data)
+      {
+        _h.valuesOffset += _offset;
+        _h.tileStride += _tile;
+        _h.frameStride += _frame;
+        _data.resize(_data.size() + 4096);
+      });
+  };
+  EXPECT_FALSE(shift(8, 8, 16));
+  EXPECT_TRUE(shift(4, 0, 0));
+  EXPECT_TRUE(shift(0, 12, 16));
+  EXPECT_TRUE(shift(0, 0, 12));
+  // Axes that are not strictly increasing.
+  auto setAxisValue = [](const VolumetricGridFileHeader &_h,
+                         std::vector<uint8_t> &_data, std::size_t _index,
+                         double _value)
+  {
+    std::memcpy(_data.data() + _h.axesOffset + _index * sizeof(double),
+                &_value, sizeof(_value));
+  };
+  EXPECT_TRUE(rejected([&](auto &_h, auto &_data)
+    {
+      setAxisValue(_h, _data, 1, 0.0);
+    }));
+  EXPECT_TRUE(rejected([&](auto &_h, auto &_data)
+    {
+      setAxisValue(_h, _data, 4, 2.0);
+    }));
+  EXPECT_TRUE(rejected([&](auto &_h, auto &_data)
+    {
+      setAxisValue(_h, _data, 7, nan);
+    }));
+}
@@ -17,6 +17,9 @@
 
 
 #include <gz/math/VolumetricGridLookupField.hh>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <unordered_set>
 #include <gtest/gtest.h>
 using namespace gz;
@@ -182,6 +185,84 @@ TEST(VolumetricGridLookupField, CheckTrilinearInterpolationBoxEightPoints)
   }
 }
 
+TEST(VolumetricGridLookupField, AllocationFreeAndBatch)
+{
+  // Uneven sparse grid with holes.
+  std::vector<Vector3d> cloud;
+  std::vector<double> values;
+  for (int z = 0; z < 6; ++z)
+  {
+    for (int y = 0; y < 7; ++y)
+    {
+      for (int x = 0; x < 8; ++x)
+      {
+        if ((x + 2 * y + 3 * z) % 11 == 0)
+          continue;
+        cloud.emplace_back(0.3 * x * x, y - 3.0, 0.5 * z);
+        values.push_back(std::sin(x + 0.1 * y) + z);
+      }
+    }
+  }
+  VolumetricGridLookupField<double> field(cloud);
+
+  // Samples along a slow trajectory, including grid points, faces, edges
+  // and points outside of the grid.
+  std::vector<Vector3d> points;
+  for (int i = 0; i < 2000; ++i)
+  {
+    const double s = 0.01 * i;
+    points.emplace_back(-1.0 + s * 1.1, -3.5 + s * 0.4, -0.2 + s * 0.15);
+  }
+  for (const auto &pt : cloud)
+  {
+    points.push_back(pt);
+    points.emplace_back(pt.X(), pt.Y() + 0.25, pt.Z());
+    points.emplace_back(pt.X() + 0.1, pt.Y(), pt.Z() + 0.2);
+  }
+
+  VolumetricGridLookupHint hint;
+  InterpolationCell3D<double> cell;
+  for (const auto &pt : points)
+  {
+    auto expected = field.GetInterpolators(pt);
+    field.GetInterpolators(pt, cell, hint);
+    ASSERT_EQ(expected.size(), cell.count);
+    for (std::size_t i = 0; i < cell.count; ++i)
+    {
+      EXPECT_EQ(expected[i].position, cell.points[i].position);
+      EXPECT_EQ(expected[i].index, cell.points[i].index);
+    }
+
+    // Same arithmetic, so bit-for-bit identical results.
+    auto reference =
+      field.EstimateValueUsingTrilinear(expected, pt, values, -1.0);
+    auto value = field.EstimateValueUsingTrilinear(cell, pt, values, -1.0);
+    ASSERT_EQ(reference.has_value(), value.has_value());
+    if (reference.has_value())
+    {
+      EXPECT_EQ(std::memcmp(&*reference, &*value, sizeof(double)), 0);
+    }
+  }
+
+  for (unsigned int threads : {1u, 3u})
+  {
+    std::vector<std::optional<double>> results;
+    field.EstimateValuesUsingTrilinear(points, values, results, -1.0,
+                                       threads);
+    ASSERT_EQ(points.size(), results.size());
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+      auto expected = field.EstimateValueUsingTrilinear(
+        field.GetInterpolators(points[i]), points[i], values, -1.0);
+      ASSERT_EQ(expected.has_value(), results[i].has_value());
+      if (expected.has_value())
+      {
+        EXPECT_EQ(std::memcmp(&*expected, &*results[i], sizeof(double)), 0);
+      }
+    }
+  }
+}
+
 TEST(VolumetricGridLookupField, AxisIndexTest)
 {
   AxisIndex<double> axis;
@@ -195,3 +276,60 @@ TEST(VolumetricGridLookupField, AxisIndexTest)
   EXPECT_EQ(axis.GetIndex(300).value(), 0UL);
   EXPECT_EQ(axis.GetIndex(200).has_value(), false);
 }
+
+TEST(VolumetricGridLookupField, AxisIndexUniform)
+{
+  // Registered out of order, the index of each key is its insertion order.
+  const std::vector<double> order{3, 0, 7, 1, 5, 2, 6, 4};
+  AxisIndex<double> axis;
+  for (auto i : order)
+  {
+    axis.AddIndexIfNotFound(0.5 * i - 1.0);
+  }
+  EXPECT_TRUE(axis.IsUniform());
+  EXPECT_EQ(axis.GetNumUniqueIndices(), 8UL);
+  EXPECT_DOUBLE_EQ(axis.MinKey(), -1.0);
+  EXPECT_DOUBLE_EQ(axis.MaxKey(), 2.5);
+  for (std::size_t i = 0; i < order.size(); ++i)
+  {
+    EXPECT_EQ(axis.GetIndex(0.5 * order[i] - 1.0).value(), i);
+  }
+
+  auto check = [](const AxisIndex<double> &_axis,
+                  const std::vector<double> &_keys)
+  {
+    for (double value = -2.0; value < 4.0; value += 0.01)
+    {
+      auto interpolators = _axis.GetInterpolators(value);
+      auto upper = std::lower_bound(_keys.begin(), _keys.end(), value);
+      if (upper == _keys.end() ||
+          (upper == _keys.begin() && std::fabs(*upper - value) >= 1e-6))
+      {
+        EXPECT_TRUE(interpolators.empty()) << value;
+      }
+      else if (std::fabs(*upper - value) < 1e-6)
+      {
+        ASSERT_EQ(interpolators.size(), 1UL) << value;
+        EXPECT_DOUBLE_EQ(interpolators[0].position, *upper);
+      }
+      else
+      {
+        ASSERT_EQ(interpolators.size(), 2UL) << value;
+        EXPECT_DOUBLE_EQ(interpolators[0].position, *(upper - 1));
+        EXPECT_DOUBLE_EQ(interpolators[1].position, *upper);
+      }
+    }
+  };
+  check(axis, {-1.0, -0.5, 0.0, 0.5, 1.0, 1.5, 2.0, 2.5});
+
+  // Appending an uneven key switches to binary searches.
+  axis.AddIndexIfNotFound(3.5);
+  EXPECT_FALSE(axis.IsUniform());
+  EXPECT_EQ(axis.GetIndex(3.5).value(), 8UL);
+  check(axis, {-1.0, -0.5, 0.0, 0.5, 1.0, 1.5, 2.0, 2.5, 3.5});
+
+  // Filling the gap makes it even again.
+  axis.AddIndexIfNotFound(3.0);
+  EXPECT_TRUE(axis.IsUniform());
+  check(axis, {-1.0, -0.5, 0.0, 0.5, 1.0, 1.5, 2.0, 2.5, 3.0, 3.5});
+}
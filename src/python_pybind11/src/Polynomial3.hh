@@ -63,7 +63,7 @@ void helpDefineMathPolynomial3(py::module &m, const std::string &typestr)
          &Class::Coeffs,
          "Get the polynomial coefficients")
     .def("evaluate",
-         &Class::Evaluate,
+         py::overload_cast<const T &>(&Class::Evaluate, py::const_),
          "Evaluate the polynomial at `_x`. For non-finite `_x`, this function "
          "computes p(z) as z tends to `_x`.")
     .def("minimum",
@@ -16,8 +16,11 @@
 */
 #include <pybind11/stl.h>
 
+#include <cstdint>
 #include <map>
 #include <string>
+#include <tuple>
+#include <vector>
 
 #include "SignalStats.hh"
 #include <gz/math/SignalStats.hh>
@@ -45,8 +48,15 @@ void defineMathSignalStats(py::module &m, const std::string &typestr)
        "Get the current values of each statistical measure, "
        "stored in a map using the short name as the key.")
   .def("insert_data",
-       &Class::InsertData,
+       py::overload_cast<const double>(&Class::InsertData),
        "Add a new sample to the statistical measures.")
+  .def("merge",
+       &Class::Merge,
+       "Combine with statistics computed over other data.")
+  .def("statistic",
+       &Class::Statistic,
+       py::return_value_policy::reference_internal,
+       "Get a statistic by short name, None if it has not been inserted.")
   .def("insert_statistic",
        &Class::InsertStatistic,
        "Add a new type of statistic.")
@@ -139,6 +149,9 @@ void defineMathSignalStatistic(py::module &m, const std::string &typestr)
   .def("insert_data",
        &Class::InsertData,
        "Add a new sample to the statistical measure.")
+  .def("merge",
+       &Class::Merge,
+       "Combine with a statistic of the same type computed over other data.")
   .def("reset",
        &Class::Reset,
        "Forget all previous data.");
@@ -546,6 +559,45 @@ void defineMathSignalMaxAbsoluteValue(py::module &m, const std::string &typestr)
        &Class::InsertData,
        "Add a new sample to the statistical measure.");
 }
+
+//////////////////////////////////////////////////
+void defineMathSignalQuantile(py::module &m, const std::string &typestr)
+{
+  using Class = gz::math::SignalQuantile;
+  std::string pyclass_name = typestr;
+  py::class_<Class, gz::math::SignalStatistic>(m,
+                    pyclass_name.c_str(),
+                    py::buffer_protocol(),
+                    py::dynamic_attr())
+  .def(py::init<double, double>(),
+       py::arg("quantile") = 0.5,
+       py::arg("relative_accuracy") = 0.01)
+  .def("quantile",
+       &Class::Quantile,
+       "Get the quantile to estimate.");
+}
+
+//////////////////////////////////////////////////
+void defineMathSignalHistogram(py::module &m, const std::string &typestr)
+{
+  using Class = gz::math::SignalHistogram;
+  std::string pyclass_name = typestr;
+  py::class_<Class, gz::math::SignalStatistic>(m,
+                    pyclass_name.c_str(),
+                    py::buffer_protocol(),
+                    py::dynamic_attr())
+  .def(py::init<double>(),
+       py::arg("relative_accuracy") = 0.1)
+  .def("buckets",
+       [](const Class &self)
+       {
+         std::vector<std::tuple<double, double, uint64_t>> buckets;
+         for (const auto &bucket : self.Buckets())
+           buckets.emplace_back(bucket.min, bucket.max, bucket.count);
+         return buckets;
+       },
+       "Get the non-empty buckets of the histogram as (min, max, count).");
+}
 }  // namespace python
 }  // namespace math
 }  // namespace gz
@@ -85,6 +85,20 @@ void defineMathSignalRootMeanSquare(py::module &m, const std::string &typestr);
  * \param[in] typestr name of the type used by Python
  */
 void defineMathSignalMean(py::module &m, const std::string &typestr);
+
+/// Define a pybind11 wrapper for a gz::math::SignalQuantile
+/**
+ * \param[in] module a pybind11 module to add the definition to
+ * \param[in] typestr name of the type used by Python
+ */
+void defineMathSignalQuantile(py::module &m, const std::string &typestr);
+
+/// Define a pybind11 wrapper for a gz::math::SignalHistogram
+/**
+ * \param[in] module a pybind11 module to add the definition to
+ * \param[in] typestr name of the type used by Python
+ */
+void defineMathSignalHistogram(py::module &m, const std::string &typestr);
 }  // namespace python
 }  // namespace math
 }  // namespace gz
@@ -39,8 +39,11 @@ void defineMathVector3Stats(py::module &m, const std::string &typestr)
                     py::dynamic_attr())
     .def(py::init<>())
     .def("insert_data",
-         &Class::InsertData,
+         py::overload_cast<const gz::math::Vector3d &>(&Class::InsertData),
          "Add a new sample to the statistical measures")
+    .def("merge",
+         &Class::Merge,
+         "Combine with statistics computed over other data.")
     .def("insert_statistic",
          &Class::InsertStatistic,
          "Add a new type of statistic.")
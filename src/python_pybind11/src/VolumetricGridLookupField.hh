@@ -57,7 +57,8 @@ void helpDefineMathVolumetricGridLookupField(py::module &m,
     .def(py::init<const std::vector<Vector3Type>&>())
     .def(py::init<const std::vector<Vector3Type>&, const std::vector<I>&>())
     .def("get_interpolators",
-         &Class::GetInterpolators,
+         py::overload_cast<const Vector3Type &, double, double, double>(
+           &Class::GetInterpolators, py::const_),
          "Get interpolators for a given point",
          py::arg("point"),
          py::arg("x_tol") = 1e-6,
@@ -119,6 +119,8 @@ PYBIND11_MODULE(BINDINGS_MODULE_NAME, m)
   gz::math::python::defineMathSignalRootMeanSquare(
     m, "SignalRootMeanSquare");
   gz::math::python::defineMathSignalMean(m, "SignalMean");
+  gz::math::python::defineMathSignalQuantile(m, "SignalQuantile");
+  gz::math::python::defineMathSignalHistogram(m, "SignalHistogram");
 
   gz::math::python::defineMathRotationSpline(m, "RotationSpline");
 
@@ -18,7 +18,9 @@ from gz.math import Rand
 from gz.math import SignalMaxAbsoluteValue
 from gz.math import SignalMaximum
 from gz.math import SignalMean
+from gz.math import SignalHistogram
 from gz.math import SignalMinimum
+from gz.math import SignalQuantile
 from gz.math import SignalRootMeanSquare
 from gz.math import SignalStats
 from gz.math import SignalVariance
@@ -524,5 +526,63 @@ class TestSignalStats(unittest.TestCase):
         self.assertAlmostEqual(map["mean"], 0.0)
 
 
+    def test_signal_stats_merge(self):
+        stats = SignalStats()
+        stats_a = SignalStats()
+        stats_b = SignalStats()
+        for s in [stats, stats_a, stats_b]:
+            self.assertTrue(s.insert_statistics("max,mean,min,var"))
+
+        for i in range(50):
+            value = Rand.dbl_uniform(-1.0, 1.0)
+            stats.insert_data(value)
+            (stats_a if i < 20 else stats_b).insert_data(value)
+
+        self.assertTrue(stats_a.merge(stats_b))
+        self.assertEqual(stats.count(), stats_a.count())
+        expected = stats.map()
+        for name, value in stats_a.map().items():
+            self.assertAlmostEqual(expected[name], value)
+
+        # Different sets of statistics cannot be merged
+        other = SignalStats()
+        self.assertTrue(other.insert_statistics("max"))
+        self.assertFalse(stats_a.merge(other))
+
+    def test_signal_quantile(self):
+        median = SignalQuantile()
+        p99 = SignalQuantile(0.99)
+        self.assertEqual(median.short_name(), "p50")
+        self.assertEqual(p99.short_name(), "p99")
+        self.assertAlmostEqual(p99.quantile(), 0.99)
+        for i in range(1, 1001):
+            median.insert_data(i)
+            p99.insert_data(i)
+        self.assertEqual(median.count(), 1000)
+        self.assertAlmostEqual(median.value(), 500.5, delta=5.005)
+        self.assertAlmostEqual(p99.value(), 990.01, delta=9.9001)
+        self.assertFalse(median.merge(p99))
+
+        stats = SignalStats()
+        self.assertTrue(stats.insert_statistics("p99,hist"))
+        self.assertFalse(stats.insert_statistic("p99.0"))
+        for i in range(1, 1001):
+            stats.insert_data(i)
+        self.assertAlmostEqual(stats.map()["p99"], 990.01, delta=9.9001)
+        self.assertIsNone(stats.statistic("var"))
+        self.assertEqual(stats.statistic("hist").count(), 1000)
+
+    def test_signal_histogram(self):
+        histogram = SignalHistogram()
+        self.assertEqual(histogram.short_name(), "hist")
+        for value in [-1.0, 0.0, 2.0, 2.05]:
+            histogram.insert_data(value)
+        buckets = histogram.buckets()
+        self.assertEqual(len(buckets), 3)
+        self.assertEqual(buckets[1], (0.0, 0.0, 1))
+        self.assertEqual(buckets[2][2], 2)
+        self.assertLessEqual(buckets[2][0], 2.0)
+        self.assertGreaterEqual(buckets[2][1], 2.05)
+
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+// Benchmarks for updating many Gauss-Markov processes, one object per
+// process and as a GaussMarkovProcessBank.
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "gz/math/GaussMarkovProcess.hh"
+#include "gz/math/GaussMarkovProcessBank.hh"
+
+using namespace gz;
+using namespace math;
+
+namespace {
+
+/// \brief Number of processes.
+constexpr int kProcesses = 1 << 15;
+
+}  // namespace
+
+/////////////////////////////////////////////////
+static void BM_ProcessObjects(benchmark::State &_state)
+{
+  std::vector<GaussMarkovProcess> processes;
+  for (int i = 0; i < kProcesses; ++i)
+    processes.emplace_back(0.0, 0.1 + 0.001 * i, 1.0, 0.1);
+  for (auto _ : _state)
+  {
+    for (auto &process : processes)
+      benchmark::DoNotOptimize(process.Update(0.01));
+  }
+  _state.SetItemsProcessed(_state.iterations() * kProcesses);
+}
+BENCHMARK(BM_ProcessObjects);
+
+/////////////////////////////////////////////////
+static void BM_ProcessBank(benchmark::State &_state)
+{
+  GaussMarkovProcessBank bank(1, 0);
+  for (int i = 0; i < kProcesses; ++i)
+    bank.Add(0.0, 0.1 + 0.001 * i, 1.0, 0.1);
+  const unsigned int threads = static_cast<unsigned int>(_state.range(0));
+  for (auto _ : _state)
+    benchmark::DoNotOptimize(bank.Update(0.01, threads).data());
+  _state.SetItemsProcessed(_state.iterations() * kProcesses);
+}
+BENCHMARK(BM_ProcessBank)->Arg(1)->Arg(4)->UseRealTime();
+
+BENCHMARK_MAIN();
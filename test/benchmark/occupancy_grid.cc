@@ -0,0 +1,260 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+// Benchmarks for OccupancyGrid updates driven by range sensors. For stable
+// numbers, run pinned to a single CPU using your platform's affinity tool
+// (on Linux, e.g., `taskset -c 1 ./bin/BENCHMARK_occupancy_grid`).
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gz/math/Helpers.hh"
+#include "gz/math/OccupancyGrid.hh"
+#include "gz/math/Vector2.hh"
+
+using namespace gz;
+using namespace math;
+
+namespace {
+
+/// \brief Resolution of the benchmark grids in meters per cell.
+constexpr double kResolution = 0.05;
+
+/// \brief Build a 2D lidar scan around an origin.
+/// \param[in] _originX World X coordinate of the sensor.
+/// \param[in] _originY World Y coordinate of the sensor.
+/// \param[in] _beams Number of beams over 270 degrees.
+/// \param[in] _maxRange Maximum range of the beams in meters.
+/// \return The endpoint of each beam in world coordinates.
+std::vector<Vector2d> makeScan(double _originX, double _originY,
+                               std::size_t _beams, double _maxRange)
+{
+  std::mt19937 rng(0xCAFE);
+  std::uniform_real_distribution<double> range(0.2 * _maxRange, _maxRange);
+  std::vector<Vector2d> endpoints;
+  endpoints.reserve(_beams);
+  for (std::size_t i = 0; i < _beams; ++i)
+  {
+    const double angle = -0.75 * GZ_PI +
+      1.5 * GZ_PI * static_cast<double>(i) / static_cast<double>(_beams);
+    const double r = range(rng);
+    endpoints.emplace_back(_originX + r * std::cos(angle),
+                           _originY + r * std::sin(angle));
+  }
+  return endpoints;
+}
+
+/// \brief Radius in cells of the viewpoint scoring benchmarks.
+constexpr int kGainRadius = 40;
+
+/// \brief Number of rays cast per viewpoint by the per-ray scoring.
+constexpr int kGainRays = 64;
+
+/// \brief Build a partially explored grid and collect its frontiers.
+/// \param[out] _frontiers Frontier cells of the grid.
+/// \return A 1000x1000 grid explored by a few scans.
+OccupancyGrid makeExploredGrid(std::vector<Vector2i> &_frontiers)
+{
+  OccupancyGrid grid(kResolution, 1000, 1000);
+  for (int i = 0; i < 5; ++i)
+  {
+    const double x = 10.0 + 7.0 * i;
+    grid.InsertScan(x, 25.0, makeScan(x, 25.0, 1080, 12.0));
+  }
+  grid.Frontiers(_frontiers);
+  return grid;
+}
+
+}  // namespace
+
+/////////////////////////////////////////////////
+static void BM_ScanPerCall(benchmark::State &_state)
+{
+  OccupancyGrid grid(kResolution, 2000, 2000);
+  auto scan = makeScan(50.0, 50.0, static_cast<std::size_t>(_state.range(0)),
+                       30.0);
+  for (auto _ : _state)
+  {
+    for (const auto &end : scan)
+    {
+      grid.MarkFree(50.0, 50.0, end.X(), end.Y());
+      grid.MarkOccupied(end.X(), end.Y());
+    }
+    benchmark::ClobberMemory();
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(BM_ScanPerCall)->Arg(360)->Arg(1080)->Arg(4096);
+
+/////////////////////////////////////////////////
+static void BM_InsertScan(benchmark::State &_state)
+{
+  OccupancyGrid grid(kResolution, 2000, 2000);
+  auto scan = makeScan(50.0, 50.0, static_cast<std::size_t>(_state.range(0)),
+                       30.0);
+  for (auto _ : _state)
+  {
+    grid.InsertScan(50.0, 50.0, scan);
+    benchmark::ClobberMemory();
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(BM_InsertScan)->Arg(360)->Arg(1080)->Arg(4096);
+
+/////////////////////////////////////////////////
+static void BM_InsertScanThreads(benchmark::State &_state)
+{
+  OccupancyGrid grid(kResolution, 2000, 2000);
+  auto scan = makeScan(50.0, 50.0, 1080, 30.0);
+  const auto threads = static_cast<unsigned int>(_state.range(0));
+  for (auto _ : _state)
+  {
+    grid.InsertScan(50.0, 50.0, scan, threads);
+    benchmark::ClobberMemory();
+  }
+  _state.SetItemsProcessed(_state.iterations() * 1080);
+}
+BENCHMARK(BM_InsertScanThreads)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+/////////////////////////////////////////////////
+static void BM_InsertScanLogOdds(benchmark::State &_state)
+{
+  OccupancyGrid grid(kResolution, 2000, 2000);
+  OccupancyLogOddsParams params;
+  params.precision = (_state.range(0) == 8) ?
+    OccupancyLogOddsPrecision::Int8 : OccupancyLogOddsPrecision::Int16;
+  grid.EnableLogOdds(params);
+  auto scan = makeScan(50.0, 50.0, 1080, 30.0);
+  for (auto _ : _state)
+  {
+    grid.InsertScan(50.0, 50.0, scan);
+    benchmark::ClobberMemory();
+  }
+  _state.SetItemsProcessed(_state.iterations() * 1080);
+}
+BENCHMARK(BM_InsertScanLogOdds)->Arg(8)->Arg(16);
+
+/////////////////////////////////////////////////
+static void BM_Frontiers(benchmark::State &_state)
+{
+  std::vector<Vector2i> frontiers;
+  OccupancyGrid grid = makeExploredGrid(frontiers);
+  for (auto _ : _state)
+  {
+    grid.Frontiers(frontiers);
+    benchmark::DoNotOptimize(frontiers.data());
+  }
+}
+BENCHMARK(BM_Frontiers);
+
+/////////////////////////////////////////////////
+static void BM_ScoreViewpointsPerRay(benchmark::State &_state)
+{
+  std::vector<Vector2i> frontiers;
+  OccupancyGrid grid = makeExploredGrid(frontiers);
+  for (auto _ : _state)
+  {
+    int64_t total = 0;
+    for (const auto &viewpoint : frontiers)
+    {
+      for (int i = 0; i < kGainRays; ++i)
+      {
+        const double angle = 2.0 * GZ_PI * i / kGainRays;
+        total += grid.CalculateIGain(viewpoint.X(), viewpoint.Y(),
+            viewpoint.X() + static_cast<int>(kGainRadius * std::cos(angle)),
+            viewpoint.Y() + static_cast<int>(kGainRadius * std::sin(angle)));
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  _state.SetItemsProcessed(_state.iterations() * frontiers.size());
+}
+BENCHMARK(BM_ScoreViewpointsPerRay)->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void BM_ScoreViewpointsGainMap(benchmark::State &_state)
+{
+  std::vector<Vector2i> frontiers;
+  OccupancyGrid grid = makeExploredGrid(frontiers);
+  grid.EnableInformationGainMap(kGainRadius);
+  for (auto _ : _state)
+  {
+    int64_t total = 0;
+    for (const auto &viewpoint : frontiers)
+      total += grid.InformationGain(viewpoint.X(), viewpoint.Y());
+    benchmark::DoNotOptimize(total);
+  }
+  _state.SetItemsProcessed(_state.iterations() * frontiers.size());
+}
+BENCHMARK(BM_ScoreViewpointsGainMap);
+
+/////////////////////////////////////////////////
+static void BM_UpdateGainMapAfterScan(benchmark::State &_state)
+{
+  std::vector<Vector2i> frontiers;
+  OccupancyGrid grid = makeExploredGrid(frontiers);
+  grid.EnableInformationGainMap(kGainRadius);
+  auto scan = makeScan(20.0, 25.0, 360, 4.0);
+  for (auto _ : _state)
+  {
+    grid.InsertScan(20.0, 25.0, scan);
+    grid.UpdateInformationGainMap();
+  }
+}
+BENCHMARK(BM_UpdateGainMapAfterScan)->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void BM_ComputeDistanceField(benchmark::State &_state)
+{
+  std::vector<Vector2i> frontiers;
+  OccupancyGrid grid = makeExploredGrid(frontiers);
+  const auto threads = static_cast<unsigned int>(_state.range(0));
+  for (auto _ : _state)
+    grid.ComputeDistanceField(threads);
+}
+BENCHMARK(BM_ComputeDistanceField)->Arg(1)->Arg(2)->Arg(4)
+  ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/////////////////////////////////////////////////
+static void BM_UpdateDistanceFieldAfterScan(benchmark::State &_state)
+{
+  std::vector<Vector2i> frontiers;
+  OccupancyGrid grid = makeExploredGrid(frontiers);
+  grid.ComputeDistanceField();
+  auto scan = makeScan(20.0, 25.0, 360, 4.0);
+  auto moved = makeScan(20.0, 25.0, 360, 3.0);
+  bool flip = false;
+  for (auto _ : _state)
+  {
+    // Alternate two scans so that obstacles keep appearing and vanishing.
+    grid.InsertScan(20.0, 25.0, flip ? scan : moved);
+    for (const auto &end : flip ? moved : scan)
+    {
+      int x, y;
+      if (grid.WorldToGrid(end.X(), end.Y(), x, y))
+        grid.CellState(x, y, OccupancyCellState::Free);
+    }
+    flip = !flip;
+    grid.UpdateDistanceField();
+  }
+}
+BENCHMARK(BM_UpdateDistanceFieldAfterScan)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
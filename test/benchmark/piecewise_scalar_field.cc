@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+// Benchmarks for PiecewiseScalarField3 evaluation with many pieces, such as
+// terrain friction or density maps made of tiles.
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "gz/math/AdditivelySeparableScalarField3.hh"
+#include "gz/math/PiecewiseScalarField3.hh"
+#include "gz/math/Polynomial3.hh"
+#include "gz/math/Vector3.hh"
+
+using namespace gz;
+using namespace math;
+
+namespace {
+
+using TileField = AdditivelySeparableScalarField3d<Polynomial3d>;
+using Field = PiecewiseScalarField3d<TileField>;
+
+/// \brief Number of points per benchmark iteration.
+constexpr std::size_t kPoints = 4096;
+
+/// \brief Build a field made of side x side x 4 tiles of unit size.
+/// \param[in] _side number of tiles along x and y
+Field makeField(int _side)
+{
+  std::vector<Field::Piece> pieces;
+  for (int z = 0; z < 4; ++z)
+  {
+    for (int y = 0; y < _side; ++y)
+    {
+      for (int x = 0; x < _side; ++x)
+      {
+        pieces.push_back({
+          Region3d(Intervald::LeftClosed(x, x + 1.0),
+                   Intervald::LeftClosed(y, y + 1.0),
+                   Intervald::LeftClosed(z, z + 1.0)),
+          TileField(1.0,
+                    Polynomial3d(Vector4d(0, 0, 0.1 * x, 1)),
+                    Polynomial3d(Vector4d(0, 0.01 * y, 0, 0)),
+                    Polynomial3d::Constant(z))});
+      }
+    }
+  }
+  return Field(pieces);
+}
+
+/// \brief Points of a vehicle path through the field.
+/// \param[in] _side number of tiles along x and y
+std::vector<Vector3d> makePath(int _side)
+{
+  std::vector<Vector3d> points;
+  for (std::size_t i = 0; i < kPoints; ++i)
+  {
+    const double s = static_cast<double>(i) / kPoints;
+    points.emplace_back(s * _side, 0.5 * s * _side, 0.5 + 3 * s);
+  }
+  return points;
+}
+
+/// \brief Random points in the field.
+/// \param[in] _side number of tiles along x and y
+std::vector<Vector3d> makeRandomPoints(int _side)
+{
+  std::mt19937 rng(0xF00D);
+  std::uniform_real_distribution<double> horizontal(0.0, _side);
+  std::uniform_real_distribution<double> vertical(0.0, 4.0);
+  std::vector<Vector3d> points;
+  for (std::size_t i = 0; i < kPoints; ++i)
+    points.emplace_back(horizontal(rng), horizontal(rng), vertical(rng));
+  return points;
+}
+
+}  // namespace
+
+/////////////////////////////////////////////////
+static void BM_EvaluateRandom(benchmark::State &_state)
+{
+  const int side = static_cast<int>(_state.range(0));
+  const Field field = makeField(side);
+  const auto points = makeRandomPoints(side);
+  for (auto _ : _state)
+  {
+    double total = 0;
+    for (const auto &p : points)
+      total += field.Evaluate(p);
+    benchmark::DoNotOptimize(total);
+  }
+  _state.SetItemsProcessed(_state.iterations() * kPoints);
+}
+BENCHMARK(BM_EvaluateRandom)->Arg(4)->Arg(16)->Arg(64);
+
+/////////////////////////////////////////////////
+static void BM_EvaluateBatchPath(benchmark::State &_state)
+{
+  const int side = static_cast<int>(_state.range(0));
+  const Field field = makeField(side);
+  const auto points = makePath(side);
+  std::vector<double> values;
+  for (auto _ : _state)
+  {
+    field.Evaluate(points, values);
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kPoints);
+}
+BENCHMARK(BM_EvaluateBatchPath)->Arg(4)->Arg(16)->Arg(64);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+// Benchmarks for the shared Rand generator and per-thread RandStream
+// generators, with increasing numbers of threads, and for bulk fills.
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "gz/math/Rand.hh"
+
+using namespace gz;
+using namespace math;
+
+namespace {
+
+/// \brief Number of samples per benchmark iteration.
+constexpr int kSamples = 4096;
+
+}  // namespace
+
+/////////////////////////////////////////////////
+static void BM_StaticNormal(benchmark::State &_state)
+{
+  for (auto _ : _state)
+  {
+    for (int i = 0; i < kSamples; ++i)
+      benchmark::DoNotOptimize(Rand::DblNormal(0, 1));
+  }
+  _state.SetItemsProcessed(_state.iterations() * kSamples);
+}
+BENCHMARK(BM_StaticNormal)->ThreadRange(1, 8)->UseRealTime();
+
+/////////////////////////////////////////////////
+static void BM_ThreadStreamNormal(benchmark::State &_state)
+{
+  RandStream &stream = Rand::ThreadStream();
+  for (auto _ : _state)
+  {
+    for (int i = 0; i < kSamples; ++i)
+      benchmark::DoNotOptimize(stream.DblNormal(0, 1));
+  }
+  _state.SetItemsProcessed(_state.iterations() * kSamples);
+}
+BENCHMARK(BM_ThreadStreamNormal)->ThreadRange(1, 8)->UseRealTime();
+
+/////////////////////////////////////////////////
+static void BM_StaticUniform(benchmark::State &_state)
+{
+  for (auto _ : _state)
+  {
+    for (int i = 0; i < kSamples; ++i)
+      benchmark::DoNotOptimize(Rand::DblUniform(0, 1));
+  }
+  _state.SetItemsProcessed(_state.iterations() * kSamples);
+}
+BENCHMARK(BM_StaticUniform)->ThreadRange(1, 8)->UseRealTime();
+
+/////////////////////////////////////////////////
+static void BM_ThreadStreamUniform(benchmark::State &_state)
+{
+  RandStream &stream = Rand::ThreadStream();
+  for (auto _ : _state)
+  {
+    for (int i = 0; i < kSamples; ++i)
+      benchmark::DoNotOptimize(stream.DblUniform(0, 1));
+  }
+  _state.SetItemsProcessed(_state.iterations() * kSamples);
+}
+BENCHMARK(BM_ThreadStreamUniform)->ThreadRange(1, 8)->UseRealTime();
+
+/////////////////////////////////////////////////
+static void BM_StreamNormalLoop(benchmark::State &_state)
+{
+  RandStream stream(1, 0);
+  std::vector<double> values(1 << 20);
+  for (auto _ : _state)
+  {
+    for (double &value : values)
+      value = stream.DblNormal(0, 1);
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * values.size());
+}
+BENCHMARK(BM_StreamNormalLoop);
+
+/////////////////////////////////////////////////
+static void BM_FillNormal(benchmark::State &_state)
+{
+  RandStream stream(1, 0);
+  std::vector<double> values(1 << 20);
+  const unsigned int threads = static_cast<unsigned int>(_state.range(0));
+  for (auto _ : _state)
+  {
+    stream.FillNormal(values.data(), values.size(), 0, 1, threads);
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * values.size());
+}
+BENCHMARK(BM_FillNormal)->Arg(1)->Arg(4)->UseRealTime();
+
+/////////////////////////////////////////////////
+static void BM_FillNormalFloat(benchmark::State &_state)
+{
+  RandStream stream(1, 0);
+  std::vector<float> values(1 << 20);
+  for (auto _ : _state)
+  {
+    stream.FillNormal(values.data(), values.size());
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * values.size());
+}
+BENCHMARK(BM_FillNormalFloat);
+
+/////////////////////////////////////////////////
+static void BM_StreamUniformLoop(benchmark::State &_state)
+{
+  RandStream stream(1, 0);
+  std::vector<double> values(1 << 20);
+  for (auto _ : _state)
+  {
+    for (double &value : values)
+      value = stream.DblUniform(0, 1);
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * values.size());
+}
+BENCHMARK(BM_StreamUniformLoop);
+
+/////////////////////////////////////////////////
+static void BM_FillUniform(benchmark::State &_state)
+{
+  RandStream stream(1, 0);
+  std::vector<double> values(1 << 20);
+  for (auto _ : _state)
+  {
+    stream.FillUniform(values.data(), values.size());
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * values.size());
+}
+BENCHMARK(BM_FillUniform);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+// Benchmarks for Polynomial3 and AdditivelySeparableScalarField3
+// evaluation over many arguments, point by point and in batches.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "gz/math/AdditivelySeparableScalarField3.hh"
+#include "gz/math/Polynomial3.hh"
+#include "gz/math/Vector3.hh"
+#include "gz/math/Vector4.hh"
+
+using namespace gz;
+using namespace math;
+
+namespace {
+
+using Field = AdditivelySeparableScalarField3d<Polynomial3d>;
+
+/// \brief Number of arguments per benchmark iteration.
+constexpr std::size_t kCount = 1 << 14;
+
+/// \brief A field with cubic terms along every axis.
+Field makeField()
+{
+  return Field(0.5,
+               Polynomial3d(Vector4d(1., -2., 0.5, 3.)),
+               Polynomial3d(Vector4d(0.1, 1., 1., 1.)),
+               Polynomial3d(Vector4d(-0.5, 0., 2., 0.)));
+}
+
+/// \brief Random values in [-10, 10).
+std::vector<double> makeValues()
+{
+  std::mt19937 rng(0xF00D);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  std::vector<double> values(kCount);
+  for (double &value : values)
+    value = dist(rng);
+  return values;
+}
+
+/// \brief Random points in [-10, 10)^3.
+std::vector<Vector3d> makePoints()
+{
+  const std::vector<double> values = makeValues();
+  std::vector<Vector3d> points;
+  for (std::size_t i = 0; i < kCount; ++i)
+  {
+    points.emplace_back(values[i], values[(i + 1) % kCount],
+                        values[(i + 2) % kCount]);
+  }
+  return points;
+}
+
+/// \brief Evenly spaced coordinates of a lattice axis.
+std::vector<double> makeAxis(std::size_t _size)
+{
+  std::vector<double> axis(_size);
+  for (std::size_t i = 0; i < _size; ++i)
+    axis[i] = -10.0 + 20.0 * static_cast<double>(i) / _size;
+  return axis;
+}
+
+}  // namespace
+
+/////////////////////////////////////////////////
+static void BM_PolynomialScalar(benchmark::State &_state)
+{
+  const Polynomial3d poly(Vector4d(1., -2., 0.5, 3.));
+  const std::vector<double> x = makeValues();
+  std::vector<double> y(kCount);
+  for (auto _ : _state)
+  {
+    for (std::size_t i = 0; i < kCount; ++i)
+      y[i] = poly.Evaluate(x[i]);
+    benchmark::DoNotOptimize(y.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kCount);
+}
+BENCHMARK(BM_PolynomialScalar);
+
+/////////////////////////////////////////////////
+static void BM_PolynomialBatch(benchmark::State &_state)
+{
+  const Polynomial3d poly(Vector4d(1., -2., 0.5, 3.));
+  const std::vector<double> x = makeValues();
+  std::vector<double> y;
+  for (auto _ : _state)
+  {
+    poly.Evaluate(x, y);
+    benchmark::DoNotOptimize(y.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kCount);
+}
+BENCHMARK(BM_PolynomialBatch);
+
+/////////////////////////////////////////////////
+static void BM_FieldScalar(benchmark::State &_state)
+{
+  const Field field = makeField();
+  const std::vector<Vector3d> points = makePoints();
+  std::vector<double> values(kCount);
+  for (auto _ : _state)
+  {
+    for (std::size_t i = 0; i < kCount; ++i)
+      values[i] = field.Evaluate(points[i]);
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kCount);
+}
+BENCHMARK(BM_FieldScalar);
+
+/////////////////////////////////////////////////
+static void BM_FieldBatch(benchmark::State &_state)
+{
+  const Field field = makeField();
+  const std::vector<Vector3d> points = makePoints();
+  std::vector<double> values;
+  for (auto _ : _state)
+  {
+    field.Evaluate(points, values);
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kCount);
+}
+BENCHMARK(BM_FieldBatch);
+
+/////////////////////////////////////////////////
+static void BM_LatticeScalar(benchmark::State &_state)
+{
+  const Field field = makeField();
+  const std::size_t side = static_cast<std::size_t>(_state.range(0));
+  const std::vector<double> axis = makeAxis(side);
+  std::vector<double> values(side * side * side);
+  for (auto _ : _state)
+  {
+    std::size_t index = 0;
+    for (double z : axis)
+      for (double y : axis)
+        for (double x : axis)
+          values[index++] = field.Evaluate(Vector3d(x, y, z));
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * values.size());
+}
+BENCHMARK(BM_LatticeScalar)->Arg(16)->Arg(64);
+
+/////////////////////////////////////////////////
+static void BM_LatticeSeparable(benchmark::State &_state)
+{
+  const Field field = makeField();
+  const std::size_t side = static_cast<std::size_t>(_state.range(0));
+  const std::vector<double> axis = makeAxis(side);
+  std::vector<double> values;
+  for (auto _ : _state)
+  {
+    field.EvaluateLattice(axis, axis, axis, values);
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * values.size());
+}
+BENCHMARK(BM_LatticeSeparable)->Arg(16)->Arg(64);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+// Benchmarks for computing statistics of a signal with SignalStats,
+// sequentially or split over threads, and with a SignalAccumulator.
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "gz/math/Rand.hh"
+#include "gz/math/SignalAccumulator.hh"
+#include "gz/math/SignalStats.hh"
+
+using namespace gz;
+using namespace math;
+
+namespace {
+
+/// \brief Number of samples.
+constexpr int kSamples = 1 << 18;
+
+/// \brief Accumulator of the statistics of SignalStats.
+using AllStats = SignalAccumulator<stats::Mean, stats::Variance,
+  stats::RootMeanSquare, stats::Minimum, stats::Maximum,
+  stats::MaxAbsoluteValue>;
+
+/// \brief Make a noisy signal.
+/// \return Samples.
+std::vector<double> Samples()
+{
+  RandStream stream(1, 0);
+  std::vector<double> samples(kSamples);
+  stream.FillNormal(samples.data(), samples.size(), 10.0, 2.0);
+  return samples;
+}
+
+}  // namespace
+
+/////////////////////////////////////////////////
+static void BM_SignalStats(benchmark::State &_state)
+{
+  const std::vector<double> samples = Samples();
+  SignalStats signalStats;
+  signalStats.InsertStatistics("max,mean,min,rms,maxAbs,var");
+  for (auto _ : _state)
+  {
+    signalStats.Reset();
+    for (double sample : samples)
+      signalStats.InsertData(sample);
+    benchmark::DoNotOptimize(signalStats.Map());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kSamples);
+}
+BENCHMARK(BM_SignalStats);
+
+/////////////////////////////////////////////////
+static void BM_SignalStatsBatch(benchmark::State &_state)
+{
+  const std::vector<double> samples = Samples();
+  SignalStats signalStats;
+  signalStats.InsertStatistics("max,mean,min,rms,maxAbs,var");
+  const unsigned int threads = static_cast<unsigned int>(_state.range(0));
+  for (auto _ : _state)
+  {
+    signalStats.Reset();
+    signalStats.InsertData(samples.data(), samples.size(), threads);
+    benchmark::DoNotOptimize(signalStats.Map());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kSamples);
+}
+BENCHMARK(BM_SignalStatsBatch)->Arg(1)->Arg(4)->UseRealTime();
+
+/////////////////////////////////////////////////
+static void BM_SignalStatsQuantiles(benchmark::State &_state)
+{
+  const std::vector<double> samples = Samples();
+  SignalStats signalStats;
+  signalStats.InsertStatistics("p50,p99,hist");
+  for (auto _ : _state)
+  {
+    signalStats.Reset();
+    for (double sample : samples)
+      signalStats.InsertData(sample);
+    benchmark::DoNotOptimize(signalStats.Map());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kSamples);
+}
+BENCHMARK(BM_SignalStatsQuantiles);
+
+/////////////////////////////////////////////////
+static void BM_SignalAccumulatorSingle(benchmark::State &_state)
+{
+  const std::vector<double> samples = Samples();
+  AllStats accumulator;
+  for (auto _ : _state)
+  {
+    accumulator.Reset();
+    for (double sample : samples)
+      accumulator.InsertData(sample);
+    benchmark::DoNotOptimize(accumulator.Map());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kSamples);
+}
+BENCHMARK(BM_SignalAccumulatorSingle);
+
+/////////////////////////////////////////////////
+static void BM_SignalAccumulatorBatch(benchmark::State &_state)
+{
+  const std::vector<double> samples = Samples();
+  AllStats accumulator;
+  for (auto _ : _state)
+  {
+    accumulator.Reset();
+    accumulator.InsertData(samples.data(), samples.size());
+    benchmark::DoNotOptimize(accumulator.Map());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kSamples);
+}
+BENCHMARK(BM_SignalAccumulatorBatch);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,340 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+// Benchmarks for SphericalCoordinates conversions, such as the ones done
+// for GPS sensors and terrain tiles every simulation step.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "gz/math/Angle.hh"
+#include "gz/math/CoordinateVector3.hh"
+#include "gz/math/SphericalCoordinates.hh"
+#include "gz/math/Vector2.hh"
+#include "gz/math/Vector3.hh"
+
+using namespace gz;
+using namespace math;
+
+namespace {
+
+/// \brief Number of positions per benchmark iteration.
+constexpr std::size_t kPoints = 4096;
+
+/// \brief Spherical coordinates of a world a few kilometers wide.
+SphericalCoordinates makeWorld()
+{
+  return SphericalCoordinates(SphericalCoordinates::EARTH_WGS84,
+      Angle(GZ_DTOR(37.4)), Angle(GZ_DTOR(-122.1)), 30.0, Angle(0.3));
+}
+
+/// \brief Random local positions within the world.
+std::vector<Vector3d> makeLocalPositions()
+{
+  std::mt19937 rng(0xF00D);
+  std::uniform_real_distribution<double> horizontal(-2000.0, 2000.0);
+  std::uniform_real_distribution<double> vertical(-50.0, 300.0);
+  std::vector<Vector3d> positions;
+  for (std::size_t i = 0; i < kPoints; ++i)
+    positions.emplace_back(horizontal(rng), horizontal(rng), vertical(rng));
+  return positions;
+}
+
+/// \brief Convert positions with the single point transform.
+std::vector<Vector3d> convert(const SphericalCoordinates &_sc,
+                              const std::vector<Vector3d> &_positions,
+                              SphericalCoordinates::CoordinateType _out)
+{
+  std::vector<Vector3d> result;
+  _sc.PositionTransform(_positions, result, SphericalCoordinates::LOCAL,
+                        _out);
+  return result;
+}
+
+/// \brief Wrap positions for the single point transform.
+std::vector<CoordinateVector3> wrap(const std::vector<Vector3d> &_positions,
+                                    bool _spherical)
+{
+  std::vector<CoordinateVector3> result;
+  for (const auto &p : _positions)
+  {
+    result.push_back(_spherical ?
+        CoordinateVector3::Spherical(Angle(p.X()), Angle(p.Y()), p.Z()) :
+        CoordinateVector3::Metric(p));
+  }
+  return result;
+}
+
+/// \brief Benchmark the single point transform.
+/// \param[in] _approximate Whether to enable the local approximation.
+void positionSingle(benchmark::State &_state,
+                    SphericalCoordinates::CoordinateType _in,
+                    SphericalCoordinates::CoordinateType _out,
+                    bool _approximate = false)
+{
+  SphericalCoordinates sc = makeWorld();
+  if (_approximate)
+    sc.EnableLocalApproximation();
+  const auto input = wrap(convert(sc, makeLocalPositions(), _in),
+                          _in == SphericalCoordinates::SPHERICAL);
+  for (auto _ : _state)
+  {
+    for (const auto &p : input)
+      benchmark::DoNotOptimize(sc.PositionTransform(p, _in, _out));
+  }
+  _state.SetItemsProcessed(_state.iterations() * kPoints);
+}
+
+/// \brief Benchmark the batch transform. The first argument is the number
+/// of threads, the optional second one the geodetic conversion method.
+/// \param[in] _approximate Whether to enable the local approximation.
+void positionBatch(benchmark::State &_state,
+                   SphericalCoordinates::CoordinateType _in,
+                   SphericalCoordinates::CoordinateType _out,
+                   bool _approximate = false)
+{
+  SphericalCoordinates sc = makeWorld();
+  const auto input = convert(sc, makeLocalPositions(), _in);
+  if (_approximate)
+    sc.EnableLocalApproximation();
+  const unsigned int threads = static_cast<unsigned int>(_state.range(0));
+  if (_state.range(1) > 0)
+  {
+    sc.SetGeodeticConversion(
+        static_cast<SphericalCoordinates::GeodeticMethod>(_state.range(1)));
+  }
+  std::vector<Vector3d> result;
+  for (auto _ : _state)
+  {
+    sc.PositionTransform(input, result, _in, _out, threads);
+    benchmark::DoNotOptimize(result.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kPoints);
+}
+
+/// \brief Random latitudes and longitudes in radians.
+std::vector<Vector2d> makeLatLons(std::size_t _count)
+{
+  std::mt19937 rng(0xBEEF);
+  std::uniform_real_distribution<double> lat(-1.5, 1.5);
+  std::uniform_real_distribution<double> lon(-GZ_PI, GZ_PI);
+  std::vector<Vector2d> latLons;
+  for (std::size_t i = 0; i < _count; ++i)
+    latLons.emplace_back(lat(rng), lon(rng));
+  return latLons;
+}
+
+}  // namespace
+
+/////////////////////////////////////////////////
+static void BM_EcefToSphericalSingle(benchmark::State &_state)
+{
+  SphericalCoordinates sc = makeWorld();
+  sc.SetGeodeticConversion(
+      static_cast<SphericalCoordinates::GeodeticMethod>(_state.range(0)));
+  const auto input = wrap(
+      convert(sc, makeLocalPositions(), SphericalCoordinates::ECEF), false);
+  for (auto _ : _state)
+  {
+    for (const auto &p : input)
+    {
+      benchmark::DoNotOptimize(sc.PositionTransform(
+          p, SphericalCoordinates::ECEF, SphericalCoordinates::SPHERICAL));
+    }
+  }
+  _state.SetItemsProcessed(_state.iterations() * kPoints);
+}
+BENCHMARK(BM_EcefToSphericalSingle)
+  ->Arg(SphericalCoordinates::BOWRING)
+  ->Arg(SphericalCoordinates::FAST_BOWRING)
+  ->Arg(SphericalCoordinates::VERMEILLE);
+
+/////////////////////////////////////////////////
+static void BM_LocalToSphericalSingle(benchmark::State &_state)
+{
+  positionSingle(_state, SphericalCoordinates::LOCAL,
+                 SphericalCoordinates::SPHERICAL);
+}
+BENCHMARK(BM_LocalToSphericalSingle);
+
+/////////////////////////////////////////////////
+static void BM_LocalToSphericalApproxSingle(benchmark::State &_state)
+{
+  positionSingle(_state, SphericalCoordinates::LOCAL,
+                 SphericalCoordinates::SPHERICAL, true);
+}
+BENCHMARK(BM_LocalToSphericalApproxSingle);
+
+/////////////////////////////////////////////////
+static void BM_LocalToSphericalBatch(benchmark::State &_state)
+{
+  positionBatch(_state, SphericalCoordinates::LOCAL,
+                SphericalCoordinates::SPHERICAL);
+}
+BENCHMARK(BM_LocalToSphericalBatch)
+  ->Args({1, SphericalCoordinates::BOWRING})
+  ->Args({1, SphericalCoordinates::FAST_BOWRING})
+  ->Args({1, SphericalCoordinates::VERMEILLE})
+  ->Args({4, SphericalCoordinates::FAST_BOWRING});
+
+/////////////////////////////////////////////////
+static void BM_LocalToSphericalApproxBatch(benchmark::State &_state)
+{
+  positionBatch(_state, SphericalCoordinates::LOCAL,
+                SphericalCoordinates::SPHERICAL, true);
+}
+BENCHMARK(BM_LocalToSphericalApproxBatch)->Args({1, 0});
+
+/////////////////////////////////////////////////
+static void BM_LocalToSphericalBatchFloat(benchmark::State &_state)
+{
+  SphericalCoordinates sc = makeWorld();
+  sc.SetGeodeticConversion(SphericalCoordinates::FAST_BOWRING);
+  std::vector<Vector3f> input;
+  for (const auto &p : makeLocalPositions())
+  {
+    input.emplace_back(static_cast<float>(p.X()), static_cast<float>(p.Y()),
+                       static_cast<float>(p.Z()));
+  }
+  std::vector<Vector3f> result;
+  for (auto _ : _state)
+  {
+    sc.PositionTransform(input, result, SphericalCoordinates::LOCAL,
+                         SphericalCoordinates::SPHERICAL);
+    benchmark::DoNotOptimize(result.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kPoints);
+}
+BENCHMARK(BM_LocalToSphericalBatchFloat);
+
+/////////////////////////////////////////////////
+static void BM_SphericalToLocalSingle(benchmark::State &_state)
+{
+  positionSingle(_state, SphericalCoordinates::SPHERICAL,
+                 SphericalCoordinates::LOCAL);
+}
+BENCHMARK(BM_SphericalToLocalSingle);
+
+/////////////////////////////////////////////////
+static void BM_SphericalToLocalApproxSingle(benchmark::State &_state)
+{
+  positionSingle(_state, SphericalCoordinates::SPHERICAL,
+                 SphericalCoordinates::LOCAL, true);
+}
+BENCHMARK(BM_SphericalToLocalApproxSingle);
+
+/////////////////////////////////////////////////
+static void BM_SphericalToLocalBatch(benchmark::State &_state)
+{
+  positionBatch(_state, SphericalCoordinates::SPHERICAL,
+                SphericalCoordinates::LOCAL);
+}
+BENCHMARK(BM_SphericalToLocalBatch)->Args({1, 0})->Args({4, 0});
+
+/////////////////////////////////////////////////
+static void BM_LocalToGlobalSingle(benchmark::State &_state)
+{
+  positionSingle(_state, SphericalCoordinates::LOCAL,
+                 SphericalCoordinates::GLOBAL);
+}
+BENCHMARK(BM_LocalToGlobalSingle);
+
+/////////////////////////////////////////////////
+static void BM_LocalToGlobalBatch(benchmark::State &_state)
+{
+  positionBatch(_state, SphericalCoordinates::LOCAL,
+                SphericalCoordinates::GLOBAL);
+}
+BENCHMARK(BM_LocalToGlobalBatch)->Args({1, 0})->Args({4, 0});
+
+/////////////////////////////////////////////////
+static void BM_VelocityBatch(benchmark::State &_state)
+{
+  const SphericalCoordinates sc = makeWorld();
+  const auto input = makeLocalPositions();
+  std::vector<Vector3d> result;
+  for (auto _ : _state)
+  {
+    sc.VelocityTransform(input, result, SphericalCoordinates::LOCAL,
+                         SphericalCoordinates::ECEF);
+    benchmark::DoNotOptimize(result.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kPoints);
+}
+BENCHMARK(BM_VelocityBatch);
+
+/////////////////////////////////////////////////
+static void BM_DistanceWGS84Single(benchmark::State &_state)
+{
+  const auto points = makeLatLons(kPoints);
+  const Angle latA(points[0].X());
+  const Angle lonA(points[0].Y());
+  for (auto _ : _state)
+  {
+    for (const auto &p : points)
+    {
+      benchmark::DoNotOptimize(SphericalCoordinates::DistanceWGS84(
+          latA, lonA, Angle(p.X()), Angle(p.Y())));
+    }
+  }
+  _state.SetItemsProcessed(_state.iterations() * kPoints);
+}
+BENCHMARK(BM_DistanceWGS84Single);
+
+/////////////////////////////////////////////////
+static void BM_DistanceWGS84OneToMany(benchmark::State &_state)
+{
+  const auto points = makeLatLons(kPoints);
+  const auto method =
+    static_cast<SphericalCoordinates::DistanceMethod>(_state.range(0));
+  std::vector<double> distances;
+  for (auto _ : _state)
+  {
+    SphericalCoordinates::DistanceWGS84(points[0], points, distances,
+                                        method);
+    benchmark::DoNotOptimize(distances.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kPoints);
+}
+BENCHMARK(BM_DistanceWGS84OneToMany)
+  ->Arg(SphericalCoordinates::HAVERSINE)
+  ->Arg(SphericalCoordinates::VINCENTY);
+
+/////////////////////////////////////////////////
+static void BM_DistanceWGS84ManyToMany(benchmark::State &_state)
+{
+  const auto from = makeLatLons(256);
+  const auto to = makeLatLons(1024);
+  const auto method =
+    static_cast<SphericalCoordinates::DistanceMethod>(_state.range(0));
+  const unsigned int threads = static_cast<unsigned int>(_state.range(1));
+  std::vector<double> distances;
+  for (auto _ : _state)
+  {
+    SphericalCoordinates::DistanceWGS84(from, to, distances, method,
+                                        threads);
+    benchmark::DoNotOptimize(distances.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * from.size() * to.size());
+}
+BENCHMARK(BM_DistanceWGS84ManyToMany)
+  ->Args({SphericalCoordinates::HAVERSINE, 1})
+  ->Args({SphericalCoordinates::HAVERSINE, 4})
+  ->Args({SphericalCoordinates::VINCENTY, 1});
+
+BENCHMARK_MAIN();
@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+// Benchmarks for TimeVaryingVolumetricGrid lookups by a vehicle moving
+// through a time varying field, as done every simulation step.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gz/math/MappedTimeVaryingVolumetricGrid.hh"
+#include "gz/math/TimeVaryingVolumetricGrid.hh"
+#include "gz/math/Vector3.hh"
+
+using namespace gz;
+using namespace math;
+
+namespace {
+
+/// \brief Number of grid points along x and y.
+constexpr int kSide = 60;
+
+/// \brief Number of grid points along z.
+constexpr int kLayers = 20;
+
+/// \brief Number of time frames.
+constexpr int kFrames = 6;
+
+/// \brief Number of lookups per benchmark iteration.
+constexpr int kQueries = 4096;
+
+/// \brief Value of the field.
+double fieldValue(int _t, int _x, int _y, int _z)
+{
+  return std::sin(0.1 * _x + 0.3 * _t) * std::cos(0.1 * _y) + 0.01 * _z;
+}
+
+/// \brief Build an in memory grid of the field.
+InMemoryTimeVaryingVolumetricGrid<double> makeInMemoryGrid()
+{
+  InMemoryTimeVaryingVolumetricGridFactory<double, double> factory;
+  for (int t = 0; t < kFrames; ++t)
+    for (int z = 0; z < kLayers; ++z)
+      for (int y = 0; y < kSide; ++y)
+        for (int x = 0; x < kSide; ++x)
+        {
+          factory.AddPoint(t * 10.0, Vector3d(x * 10.0, y * 10.0, -z * 2.0),
+                           fieldValue(t, x, y, z));
+        }
+  return factory.Build();
+}
+
+/// \brief Write the field to a volumetric grid file.
+/// \return Path of the file.
+std::string makeGridFile()
+{
+  std::vector<double> xs, ys, zs, times, values;
+  for (int x = 0; x < kSide; ++x)
+    xs.push_back(x * 10.0);
+  ys = xs;
+  for (int z = 0; z < kLayers; ++z)
+    zs.push_back(-z * 2.0);
+  for (int t = 0; t < kFrames; ++t)
+  {
+    times.push_back(t * 10.0);
+    for (int z = 0; z < kLayers; ++z)
+      for (int y = 0; y < kSide; ++y)
+        for (int x = 0; x < kSide; ++x)
+          values.push_back(fieldValue(t, x, y, z));
+  }
+  const std::string path = (std::filesystem::temp_directory_path() /
+    "time_varying_grid_benchmark.gzgrid").string();
+  WriteVolumetricGridFile(path, xs, ys, zs, times, values);
+  return path;
+}
+
+/// \brief Look up the field along the path of a vehicle, stepping the
+/// session forward in time.
+/// \param[in] _grid The grid.
+/// \param[in] _hint Lookup hint of the grid, carried along the path.
+/// \return Sum of the values.
+template<typename Grid, typename Hint>
+double followPath(const Grid &_grid, Hint _hint)
+{
+  double total = 0;
+  auto session = _grid.CreateSession(0.0);
+  for (int i = 0; i < kQueries; ++i)
+  {
+    const double time = i * (kFrames - 1) * 10.0 / kQueries;
+    if (auto next = _grid.StepTo(session, time))
+      session = *next;
+    const Vector3d pos(3.0 + 0.12 * i, 5.0 + 0.1 * i, -1.0 - 0.008 * i);
+    total += _grid.LookUp(session, _hint, pos).value_or(0.0);
+  }
+  return total;
+}
+
+}  // namespace
+
+/////////////////////////////////////////////////
+static void BM_InMemoryLookUp(benchmark::State &_state)
+{
+  const auto grid = makeInMemoryGrid();
+  for (auto _ : _state)
+    benchmark::DoNotOptimize(followPath(grid, InMemoryLookupHints{}));
+  _state.SetItemsProcessed(_state.iterations() * kQueries);
+}
+BENCHMARK(BM_InMemoryLookUp);
+
+/////////////////////////////////////////////////
+static void BM_InMemoryLookUpWithoutHints(benchmark::State &_state)
+{
+  // Lookups without hints search the axes from scratch.
+  const auto grid = makeInMemoryGrid();
+  for (auto _ : _state)
+  {
+    double total = 0;
+    auto session = grid.CreateSession(0.0);
+    for (int i = 0; i < kQueries; ++i)
+    {
+      const double time = i * (kFrames - 1) * 10.0 / kQueries;
+      if (auto next = grid.StepTo(session, time))
+        session = *next;
+      const Vector3d pos(3.0 + 0.12 * i, 5.0 + 0.1 * i, -1.0 - 0.008 * i);
+      total += grid.LookUp(session, pos).value_or(0.0);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  _state.SetItemsProcessed(_state.iterations() * kQueries);
+}
+BENCHMARK(BM_InMemoryLookUpWithoutHints);
+
+/////////////////////////////////////////////////
+static void BM_InMemoryLookUpBatch(benchmark::State &_state)
+{
+  const auto grid = makeInMemoryGrid();
+  std::vector<Vector3d> positions;
+  for (int i = 0; i < kQueries; ++i)
+    positions.emplace_back(3.0 + 0.12 * i, 5.0 + 0.1 * i, -1.0 - 0.008 * i);
+  std::vector<std::optional<double>> values;
+  const auto threads = static_cast<unsigned int>(_state.range(0));
+  auto session = *grid.StepTo(grid.CreateSession(0.0), 15.0);
+  for (auto _ : _state)
+  {
+    grid.LookUp(session, positions, values, threads);
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kQueries);
+}
+BENCHMARK(BM_InMemoryLookUpBatch)->Arg(1)->Arg(4)->UseRealTime();
+
+/////////////////////////////////////////////////
+static void BM_MappedLookUp(benchmark::State &_state)
+{
+  const std::string path = makeGridFile();
+  MappedTimeVaryingVolumetricGrid<double> grid;
+  grid.Open(path, static_cast<std::size_t>(_state.range(0)));
+  for (auto _ : _state)
+    benchmark::DoNotOptimize(followPath(grid, VolumetricGridLookupHint{}));
+  _state.SetItemsProcessed(_state.iterations() * kQueries);
+  std::filesystem::remove(path);
+}
+BENCHMARK(BM_MappedLookUp)->Arg(16)->Arg(256);
+
+/////////////////////////////////////////////////
+static void BM_BuildFromPoints(benchmark::State &_state)
+{
+  for (auto _ : _state)
+  {
+    auto grid = makeInMemoryGrid();
+    benchmark::DoNotOptimize(grid);
+  }
+  _state.SetItemsProcessed(
+    _state.iterations() * kFrames * kLayers * kSide * kSide);
+}
+BENCHMARK(BM_BuildFromPoints)->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void BM_LoadFile(benchmark::State &_state)
+{
+  const std::string path = makeGridFile();
+  for (auto _ : _state)
+  {
+    auto grid = InMemoryTimeVaryingVolumetricGridFactory<double, double>::Load(
+      path);
+    benchmark::DoNotOptimize(grid);
+  }
+  _state.SetItemsProcessed(
+    _state.iterations() * kFrames * kLayers * kSide * kSide);
+  std::filesystem::remove(path);
+}
+BENCHMARK(BM_LoadFile)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
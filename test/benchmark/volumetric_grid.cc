@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+// Benchmarks for VolumetricGridLookupField queries, as done by vehicles
+// sampling an ocean current or wind field every simulation step.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "gz/math/Vector3.hh"
+#include "gz/math/VolumetricGridLookupField.hh"
+
+using namespace gz;
+using namespace math;
+
+namespace {
+
+/// \brief Number of grid points along x and y.
+constexpr int kSide = 100;
+
+/// \brief Number of grid points along z.
+constexpr int kLayers = 50;
+
+/// \brief Number of queries per benchmark iteration.
+constexpr std::size_t kQueries = 4096;
+
+/// \brief Build a regular grid of kSide x kSide x kLayers points.
+/// \param[out] _values Value at each grid point.
+/// \return The grid points.
+std::vector<Vector3d> makeGrid(std::vector<double> &_values)
+{
+  std::vector<Vector3d> cloud;
+  _values.clear();
+  for (int z = 0; z < kLayers; ++z)
+  {
+    for (int y = 0; y < kSide; ++y)
+    {
+      for (int x = 0; x < kSide; ++x)
+      {
+        cloud.emplace_back(x * 10.0, y * 10.0, -z * 2.0);
+        _values.push_back(std::sin(0.1 * x) * std::cos(0.1 * y) + 0.01 * z);
+      }
+    }
+  }
+  return cloud;
+}
+
+/// \brief Random query positions inside the grid.
+/// \return kQueries positions.
+std::vector<Vector3d> makeRandomQueries()
+{
+  std::mt19937 rng(0xBEEF);
+  std::uniform_real_distribution<double> horizontal(0.0, (kSide - 1) * 10.0);
+  std::uniform_real_distribution<double> depth(-(kLayers - 1) * 2.0, 0.0);
+  std::vector<Vector3d> queries;
+  for (std::size_t i = 0; i < kQueries; ++i)
+    queries.emplace_back(horizontal(rng), horizontal(rng), depth(rng));
+  return queries;
+}
+
+/// \brief Positions of a vehicle moving slowly through the grid, so that
+/// consecutive queries usually fall in the same cell.
+/// \return kQueries positions.
+std::vector<Vector3d> makeTrajectory()
+{
+  std::vector<Vector3d> queries;
+  for (std::size_t i = 0; i < kQueries; ++i)
+  {
+    const double t = static_cast<double>(i);
+    queries.emplace_back(3.0 + 0.2 * t, 5.0 + 0.1 * t, -1.0 - 0.01 * t);
+  }
+  return queries;
+}
+
+}  // namespace
+
+/////////////////////////////////////////////////
+static void BM_EstimateWithVectors(benchmark::State &_state)
+{
+  std::vector<double> values;
+  VolumetricGridLookupField<double> field(makeGrid(values));
+  auto queries = makeRandomQueries();
+  for (auto _ : _state)
+  {
+    double total = 0;
+    for (const auto &pt : queries)
+    {
+      auto interpolators = field.GetInterpolators(pt);
+      total += field.EstimateValueUsingTrilinear(
+        interpolators, pt, values).value_or(0.0);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  _state.SetItemsProcessed(_state.iterations() * kQueries);
+}
+BENCHMARK(BM_EstimateWithVectors);
+
+/////////////////////////////////////////////////
+static void BM_EstimateAllocationFree(benchmark::State &_state)
+{
+  std::vector<double> values;
+  VolumetricGridLookupField<double> field(makeGrid(values));
+  auto queries = makeRandomQueries();
+  for (auto _ : _state)
+  {
+    double total = 0;
+    for (const auto &pt : queries)
+      total += field.EstimateValueUsingTrilinear(pt, values).value_or(0.0);
+    benchmark::DoNotOptimize(total);
+  }
+  _state.SetItemsProcessed(_state.iterations() * kQueries);
+}
+BENCHMARK(BM_EstimateAllocationFree);
+
+/////////////////////////////////////////////////
+static void BM_EstimateTrajectory(benchmark::State &_state)
+{
+  std::vector<double> values;
+  VolumetricGridLookupField<double> field(makeGrid(values));
+  auto queries = makeTrajectory();
+  const bool useHint = _state.range(0) != 0;
+  for (auto _ : _state)
+  {
+    double total = 0;
+    VolumetricGridLookupHint hint;
+    for (const auto &pt : queries)
+    {
+      if (useHint)
+      {
+        total += field.EstimateValueUsingTrilinear(
+          pt, values, hint).value_or(0.0);
+      }
+      else
+      {
+        total += field.EstimateValueUsingTrilinear(pt, values).value_or(0.0);
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  _state.SetItemsProcessed(_state.iterations() * kQueries);
+}
+BENCHMARK(BM_EstimateTrajectory)->Arg(0)->Arg(1);
+
+/////////////////////////////////////////////////
+static void BM_EstimateBatch(benchmark::State &_state)
+{
+  std::vector<double> values;
+  VolumetricGridLookupField<double> field(makeGrid(values));
+  auto queries = makeRandomQueries();
+  std::vector<std::optional<double>> results;
+  const auto threads = static_cast<unsigned int>(_state.range(0));
+  for (auto _ : _state)
+  {
+    field.EstimateValuesUsingTrilinear(queries, values, results, 0.0,
+                                       threads);
+    benchmark::DoNotOptimize(results.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kQueries);
+}
+BENCHMARK(BM_EstimateBatch)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+BENCHMARK_MAIN();